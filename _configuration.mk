@@ -5,1099 +5,1521 @@
 
 
 ######
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 ######
 
-4b8575ee_dirs_0 = .csconfig/4b8575ee/obj
-4b8575ee_objs_0 = .csconfig/4b8575ee/obj/cache.o\
-  .csconfig/4b8575ee/obj/cache_queues.o\
-  .csconfig/4b8575ee/obj/champsim.o\
-  .csconfig/4b8575ee/obj/dram_controller.o\
-  .csconfig/4b8575ee/obj/json_printer.o\
-  .csconfig/4b8575ee/obj/main.o\
-  .csconfig/4b8575ee/obj/module_defs.o\
-  .csconfig/4b8575ee/obj/ooo_cpu.o\
-  .csconfig/4b8575ee/obj/plain_printer.o\
-  .csconfig/4b8575ee/obj/ptw.o\
-  .csconfig/4b8575ee/obj/tracereader.o\
-  .csconfig/4b8575ee/obj/vmem.o
-$(4b8575ee_objs_0): .csconfig/4b8575ee/obj/%.o: src/%.cc | $(4b8575ee_dirs_0)
--include $(wildcard .csconfig/4b8575ee/obj/*.d))
-
-$(4b8575ee_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-bin/UCP: $(4b8575ee_objs_0)
-build_dirs += $(4b8575ee_dirs_0)
-build_objs += $(4b8575ee_objs_0)
+cf7df5df_dirs_0 = .csconfig/cf7df5df/obj
+cf7df5df_objs_0 = .csconfig/cf7df5df/obj/cache.o\
+  .csconfig/cf7df5df/obj/cache_queues.o\
+  .csconfig/cf7df5df/obj/champsim.o\
+  .csconfig/cf7df5df/obj/dram_controller.o\
+  .csconfig/cf7df5df/obj/json_printer.o\
+  .csconfig/cf7df5df/obj/main.o\
+  .csconfig/cf7df5df/obj/module_defs.o\
+  .csconfig/cf7df5df/obj/ooo_cpu.o\
+  .csconfig/cf7df5df/obj/plain_printer.o\
+  .csconfig/cf7df5df/obj/ptw.o\
+  .csconfig/cf7df5df/obj/tracereader.o\
+  .csconfig/cf7df5df/obj/vmem.o
+$(cf7df5df_objs_0): .csconfig/cf7df5df/obj/%.o: src/%.cc | $(cf7df5df_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/obj/*.d)
+
+$(cf7df5df_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+bin/UCP: $(cf7df5df_objs_0)
+build_dirs += $(cf7df5df_dirs_0)
+build_objs += $(cf7df5df_objs_0)
 bin/UCP: | bin
 build_dirs += bin
 executable_name += bin/UCP
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
+# Module: uop_replacementDhotloop
+# Source: uop_replacement/hotloop
+# Destination: .csconfig/cf7df5df/uop_replacementDhotloop
+###
+
+cf7df5df_uop_replacementDhotloop_dirs_0 = .csconfig/cf7df5df/uop_replacementDhotloop
+cf7df5df_uop_replacementDhotloop_objs_0 = .csconfig/cf7df5df/uop_replacementDhotloop/hotloop.o
+$(cf7df5df_uop_replacementDhotloop_objs_0): .csconfig/cf7df5df/uop_replacementDhotloop/%.o: uop_replacement/hotloop/%.cc | $(cf7df5df_uop_replacementDhotloop_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDhotloop/*.d)
+
+$(cf7df5df_uop_replacementDhotloop_objs_0): CPPFLAGS += -Iuop_replacement/hotloop
+$(cf7df5df_uop_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDhotloop_objs_0): CPPFLAGS += -include uop_replacementDhotloop.inc
+$(cf7df5df_uop_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDhotloop_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDhotloop_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDhotloop_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDhotloopcritical
+# Source: uop_replacement/hotloopcritical
+# Destination: .csconfig/cf7df5df/uop_replacementDhotloopcritical
+###
+
+cf7df5df_uop_replacementDhotloopcritical_dirs_0 = .csconfig/cf7df5df/uop_replacementDhotloopcritical
+cf7df5df_uop_replacementDhotloopcritical_objs_0 = .csconfig/cf7df5df/uop_replacementDhotloopcritical/hotloopcritical.o
+$(cf7df5df_uop_replacementDhotloopcritical_objs_0): .csconfig/cf7df5df/uop_replacementDhotloopcritical/%.o: uop_replacement/hotloopcritical/%.cc | $(cf7df5df_uop_replacementDhotloopcritical_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDhotloopcritical/*.d)
+
+$(cf7df5df_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -Iuop_replacement/hotloopcritical
+$(cf7df5df_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -include uop_replacementDhotloopcritical.inc
+$(cf7df5df_uop_replacementDhotloopcritical_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDhotloopcritical_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDhotloopcritical_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDhotloopcritical_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDlru
+# Source: uop_replacement/lru
+# Destination: .csconfig/cf7df5df/uop_replacementDlru
+###
+
+cf7df5df_uop_replacementDlru_dirs_0 = .csconfig/cf7df5df/uop_replacementDlru
+cf7df5df_uop_replacementDlru_objs_0 = .csconfig/cf7df5df/uop_replacementDlru/lru.o
+$(cf7df5df_uop_replacementDlru_objs_0): .csconfig/cf7df5df/uop_replacementDlru/%.o: uop_replacement/lru/%.cc | $(cf7df5df_uop_replacementDlru_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDlru/*.d)
+
+$(cf7df5df_uop_replacementDlru_objs_0): CPPFLAGS += -Iuop_replacement/lru
+$(cf7df5df_uop_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDlru_objs_0): CPPFLAGS += -include uop_replacementDlru.inc
+$(cf7df5df_uop_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDlru_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDlru_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDlru_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDlrucritical
+# Source: uop_replacement/lrucritical
+# Destination: .csconfig/cf7df5df/uop_replacementDlrucritical
+###
+
+cf7df5df_uop_replacementDlrucritical_dirs_0 = .csconfig/cf7df5df/uop_replacementDlrucritical
+cf7df5df_uop_replacementDlrucritical_objs_0 = .csconfig/cf7df5df/uop_replacementDlrucritical/lrucritical.o
+$(cf7df5df_uop_replacementDlrucritical_objs_0): .csconfig/cf7df5df/uop_replacementDlrucritical/%.o: uop_replacement/lrucritical/%.cc | $(cf7df5df_uop_replacementDlrucritical_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDlrucritical/*.d)
+
+$(cf7df5df_uop_replacementDlrucritical_objs_0): CPPFLAGS += -Iuop_replacement/lrucritical
+$(cf7df5df_uop_replacementDlrucritical_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDlrucritical_objs_0): CPPFLAGS += -include uop_replacementDlrucritical.inc
+$(cf7df5df_uop_replacementDlrucritical_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDlrucritical_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDlrucritical_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDlrucritical_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDlruhotloop
+# Source: uop_replacement/lruhotloop
+# Destination: .csconfig/cf7df5df/uop_replacementDlruhotloop
+###
+
+cf7df5df_uop_replacementDlruhotloop_dirs_0 = .csconfig/cf7df5df/uop_replacementDlruhotloop
+cf7df5df_uop_replacementDlruhotloop_objs_0 = .csconfig/cf7df5df/uop_replacementDlruhotloop/lruhotloop.o
+$(cf7df5df_uop_replacementDlruhotloop_objs_0): .csconfig/cf7df5df/uop_replacementDlruhotloop/%.o: uop_replacement/lruhotloop/%.cc | $(cf7df5df_uop_replacementDlruhotloop_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDlruhotloop/*.d)
+
+$(cf7df5df_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -Iuop_replacement/lruhotloop
+$(cf7df5df_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -include uop_replacementDlruhotloop.inc
+$(cf7df5df_uop_replacementDlruhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDlruhotloop_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDlruhotloop_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDlruhotloop_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDsmartlru
+# Source: uop_replacement/smartlru
+# Destination: .csconfig/cf7df5df/uop_replacementDsmartlru
+###
+
+cf7df5df_uop_replacementDsmartlru_dirs_0 = .csconfig/cf7df5df/uop_replacementDsmartlru
+cf7df5df_uop_replacementDsmartlru_objs_0 = .csconfig/cf7df5df/uop_replacementDsmartlru/smartlru.o
+$(cf7df5df_uop_replacementDsmartlru_objs_0): .csconfig/cf7df5df/uop_replacementDsmartlru/%.o: uop_replacement/smartlru/%.cc | $(cf7df5df_uop_replacementDsmartlru_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDsmartlru/*.d)
+
+$(cf7df5df_uop_replacementDsmartlru_objs_0): CPPFLAGS += -Iuop_replacement/smartlru
+$(cf7df5df_uop_replacementDsmartlru_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDsmartlru_objs_0): CPPFLAGS += -include uop_replacementDsmartlru.inc
+$(cf7df5df_uop_replacementDsmartlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDsmartlru_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDsmartlru_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDsmartlru_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: uop_replacementDsrrip
+# Source: uop_replacement/srrip
+# Destination: .csconfig/cf7df5df/uop_replacementDsrrip
+###
+
+cf7df5df_uop_replacementDsrrip_dirs_0 = .csconfig/cf7df5df/uop_replacementDsrrip
+cf7df5df_uop_replacementDsrrip_objs_0 = .csconfig/cf7df5df/uop_replacementDsrrip/srrip.o
+$(cf7df5df_uop_replacementDsrrip_objs_0): .csconfig/cf7df5df/uop_replacementDsrrip/%.o: uop_replacement/srrip/%.cc | $(cf7df5df_uop_replacementDsrrip_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/uop_replacementDsrrip/*.d)
+
+$(cf7df5df_uop_replacementDsrrip_objs_0): CPPFLAGS += -Iuop_replacement/srrip
+$(cf7df5df_uop_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_uop_replacementDsrrip_objs_0): CPPFLAGS += -include uop_replacementDsrrip.inc
+$(cf7df5df_uop_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_uop_replacementDsrrip_objs_0)
+module_dirs += $(cf7df5df_uop_replacementDsrrip_dirs_0)
+module_objs += $(cf7df5df_uop_replacementDsrrip_objs_0)
+
+###
+# Build ID: cf7df5df
 # Module: btbDbasic_btb
 # Source: btb/basic_btb
-# Destination: .csconfig/4b8575ee/btbDbasic_btb
+# Destination: .csconfig/cf7df5df/btbDbasic_btb
 ###
 
-4b8575ee_btbDbasic_btb_dirs_0 = .csconfig/4b8575ee/btbDbasic_btb
-4b8575ee_btbDbasic_btb_objs_0 = .csconfig/4b8575ee/btbDbasic_btb/basic_btb.o
-$(4b8575ee_btbDbasic_btb_objs_0): .csconfig/4b8575ee/btbDbasic_btb/%.o: btb/basic_btb/%.cc | $(4b8575ee_btbDbasic_btb_dirs_0)
--include $(wildcard .csconfig/4b8575ee/btbDbasic_btb/*.d))
+cf7df5df_btbDbasic_btb_dirs_0 = .csconfig/cf7df5df/btbDbasic_btb
+cf7df5df_btbDbasic_btb_objs_0 = .csconfig/cf7df5df/btbDbasic_btb/basic_btb.o
+$(cf7df5df_btbDbasic_btb_objs_0): .csconfig/cf7df5df/btbDbasic_btb/%.o: btb/basic_btb/%.cc | $(cf7df5df_btbDbasic_btb_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/btbDbasic_btb/*.d)
 
-$(4b8575ee_btbDbasic_btb_objs_0): CPPFLAGS += -Ibtb/basic_btb
-$(4b8575ee_btbDbasic_btb_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
-$(4b8575ee_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_btbDbasic_btb_objs_0)
-module_dirs += $(4b8575ee_btbDbasic_btb_dirs_0)
-module_objs += $(4b8575ee_btbDbasic_btb_objs_0)
+$(cf7df5df_btbDbasic_btb_objs_0): CPPFLAGS += -Ibtb/basic_btb
+$(cf7df5df_btbDbasic_btb_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+$(cf7df5df_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_btbDbasic_btb_objs_0)
+module_dirs += $(cf7df5df_btbDbasic_btb_dirs_0)
+module_objs += $(cf7df5df_btbDbasic_btb_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: btbDittage_64KB
 # Source: btb/ittage_64KB
-# Destination: .csconfig/4b8575ee/btbDittage_64KB
+# Destination: .csconfig/cf7df5df/btbDittage_64KB
 ###
 
-4b8575ee_btbDittage_64KB_dirs_0 = .csconfig/4b8575ee/btbDittage_64KB
-4b8575ee_btbDittage_64KB_objs_0 = .csconfig/4b8575ee/btbDittage_64KB/basic_btb.o
-$(4b8575ee_btbDittage_64KB_objs_0): .csconfig/4b8575ee/btbDittage_64KB/%.o: btb/ittage_64KB/%.cc | $(4b8575ee_btbDittage_64KB_dirs_0)
--include $(wildcard .csconfig/4b8575ee/btbDittage_64KB/*.d))
+cf7df5df_btbDittage_64KB_dirs_0 = .csconfig/cf7df5df/btbDittage_64KB
+cf7df5df_btbDittage_64KB_objs_0 = .csconfig/cf7df5df/btbDittage_64KB/basic_btb.o
+$(cf7df5df_btbDittage_64KB_objs_0): .csconfig/cf7df5df/btbDittage_64KB/%.o: btb/ittage_64KB/%.cc | $(cf7df5df_btbDittage_64KB_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/btbDittage_64KB/*.d)
 
-$(4b8575ee_btbDittage_64KB_objs_0): CPPFLAGS += -Ibtb/ittage_64KB
-$(4b8575ee_btbDittage_64KB_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_btbDittage_64KB_objs_0): CPPFLAGS += -include btbDittage_64KB.inc
-$(4b8575ee_btbDittage_64KB_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_btbDittage_64KB_objs_0)
-module_dirs += $(4b8575ee_btbDittage_64KB_dirs_0)
-module_objs += $(4b8575ee_btbDittage_64KB_objs_0)
+$(cf7df5df_btbDittage_64KB_objs_0): CPPFLAGS += -Ibtb/ittage_64KB
+$(cf7df5df_btbDittage_64KB_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_btbDittage_64KB_objs_0): CPPFLAGS += -include btbDittage_64KB.inc
+$(cf7df5df_btbDittage_64KB_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_btbDittage_64KB_objs_0)
+module_dirs += $(cf7df5df_btbDittage_64KB_dirs_0)
+module_objs += $(cf7df5df_btbDittage_64KB_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
 # Source: btb/twolevel_btb_1Ke_32Ke_gshare_ittage
-# Destination: .csconfig/4b8575ee/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
+# Destination: .csconfig/cf7df5df/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
 ###
 
-4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0 = .csconfig/4b8575ee/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
-4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0 = .csconfig/4b8575ee/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/target_predictor.o
-$(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): .csconfig/4b8575ee/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/%.o: btb/twolevel_btb_1Ke_32Ke_gshare_ittage/%.cc | $(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
--include $(wildcard .csconfig/4b8575ee/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/*.d))
+cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0 = .csconfig/cf7df5df/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
+cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0 = .csconfig/cf7df5df/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/target_predictor.o
+$(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): .csconfig/cf7df5df/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/%.o: btb/twolevel_btb_1Ke_32Ke_gshare_ittage/%.cc | $(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/*.d)
 
-$(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -Ibtb/twolevel_btb_1Ke_32Ke_gshare_ittage
-$(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -include btbDtwolevel_btb_1Ke_32Ke_gshare_ittage.inc
-$(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
-module_dirs += $(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
-module_objs += $(4b8575ee_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
+$(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -Ibtb/twolevel_btb_1Ke_32Ke_gshare_ittage
+$(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -include btbDtwolevel_btb_1Ke_32Ke_gshare_ittage.inc
+$(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
+module_dirs += $(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
+module_objs += $(cf7df5df_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDbatage
 # Source: branch/batage
-# Destination: .csconfig/4b8575ee/branchDbatage
+# Destination: .csconfig/cf7df5df/branchDbatage
 ###
 
-4b8575ee_branchDbatage_dirs_0 = .csconfig/4b8575ee/branchDbatage
-4b8575ee_branchDbatage_objs_0 = .csconfig/4b8575ee/branchDbatage/batage.o\
-  .csconfig/4b8575ee/branchDbatage/btage_predictor.o
-$(4b8575ee_branchDbatage_objs_0): .csconfig/4b8575ee/branchDbatage/%.o: branch/batage/%.cc | $(4b8575ee_branchDbatage_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDbatage/*.d))
+cf7df5df_branchDbatage_dirs_0 = .csconfig/cf7df5df/branchDbatage
+cf7df5df_branchDbatage_objs_0 = .csconfig/cf7df5df/branchDbatage/batage.o\
+  .csconfig/cf7df5df/branchDbatage/btage_predictor.o
+$(cf7df5df_branchDbatage_objs_0): .csconfig/cf7df5df/branchDbatage/%.o: branch/batage/%.cc | $(cf7df5df_branchDbatage_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDbatage/*.d)
 
-$(4b8575ee_branchDbatage_objs_0): CPPFLAGS += -Ibranch/batage
-$(4b8575ee_branchDbatage_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDbatage_objs_0): CPPFLAGS += -include branchDbatage.inc
-$(4b8575ee_branchDbatage_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDbatage_objs_0)
-module_dirs += $(4b8575ee_branchDbatage_dirs_0)
-module_objs += $(4b8575ee_branchDbatage_objs_0)
+$(cf7df5df_branchDbatage_objs_0): CPPFLAGS += -Ibranch/batage
+$(cf7df5df_branchDbatage_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDbatage_objs_0): CPPFLAGS += -include branchDbatage.inc
+$(cf7df5df_branchDbatage_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDbatage_objs_0)
+module_dirs += $(cf7df5df_branchDbatage_dirs_0)
+module_objs += $(cf7df5df_branchDbatage_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDbimodal
 # Source: branch/bimodal
-# Destination: .csconfig/4b8575ee/branchDbimodal
+# Destination: .csconfig/cf7df5df/branchDbimodal
 ###
 
-4b8575ee_branchDbimodal_dirs_0 = .csconfig/4b8575ee/branchDbimodal
-4b8575ee_branchDbimodal_objs_0 = .csconfig/4b8575ee/branchDbimodal/bimodal.o
-$(4b8575ee_branchDbimodal_objs_0): .csconfig/4b8575ee/branchDbimodal/%.o: branch/bimodal/%.cc | $(4b8575ee_branchDbimodal_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDbimodal/*.d))
+cf7df5df_branchDbimodal_dirs_0 = .csconfig/cf7df5df/branchDbimodal
+cf7df5df_branchDbimodal_objs_0 = .csconfig/cf7df5df/branchDbimodal/bimodal.o
+$(cf7df5df_branchDbimodal_objs_0): .csconfig/cf7df5df/branchDbimodal/%.o: branch/bimodal/%.cc | $(cf7df5df_branchDbimodal_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDbimodal/*.d)
 
-$(4b8575ee_branchDbimodal_objs_0): CPPFLAGS += -Ibranch/bimodal
-$(4b8575ee_branchDbimodal_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
-$(4b8575ee_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDbimodal_objs_0)
-module_dirs += $(4b8575ee_branchDbimodal_dirs_0)
-module_objs += $(4b8575ee_branchDbimodal_objs_0)
+$(cf7df5df_branchDbimodal_objs_0): CPPFLAGS += -Ibranch/bimodal
+$(cf7df5df_branchDbimodal_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+$(cf7df5df_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDbimodal_objs_0)
+module_dirs += $(cf7df5df_branchDbimodal_dirs_0)
+module_objs += $(cf7df5df_branchDbimodal_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDgshare
 # Source: branch/gshare
-# Destination: .csconfig/4b8575ee/branchDgshare
+# Destination: .csconfig/cf7df5df/branchDgshare
 ###
 
-4b8575ee_branchDgshare_dirs_0 = .csconfig/4b8575ee/branchDgshare
-4b8575ee_branchDgshare_objs_0 = .csconfig/4b8575ee/branchDgshare/gshare.o
-$(4b8575ee_branchDgshare_objs_0): .csconfig/4b8575ee/branchDgshare/%.o: branch/gshare/%.cc | $(4b8575ee_branchDgshare_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDgshare/*.d))
+cf7df5df_branchDgshare_dirs_0 = .csconfig/cf7df5df/branchDgshare
+cf7df5df_branchDgshare_objs_0 = .csconfig/cf7df5df/branchDgshare/gshare.o
+$(cf7df5df_branchDgshare_objs_0): .csconfig/cf7df5df/branchDgshare/%.o: branch/gshare/%.cc | $(cf7df5df_branchDgshare_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDgshare/*.d)
 
-$(4b8575ee_branchDgshare_objs_0): CPPFLAGS += -Ibranch/gshare
-$(4b8575ee_branchDgshare_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
-$(4b8575ee_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDgshare_objs_0)
-module_dirs += $(4b8575ee_branchDgshare_dirs_0)
-module_objs += $(4b8575ee_branchDgshare_objs_0)
+$(cf7df5df_branchDgshare_objs_0): CPPFLAGS += -Ibranch/gshare
+$(cf7df5df_branchDgshare_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
+$(cf7df5df_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDgshare_objs_0)
+module_dirs += $(cf7df5df_branchDgshare_dirs_0)
+module_objs += $(cf7df5df_branchDgshare_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDhashed_perceptron
 # Source: branch/hashed_perceptron
-# Destination: .csconfig/4b8575ee/branchDhashed_perceptron
+# Destination: .csconfig/cf7df5df/branchDhashed_perceptron
 ###
 
-4b8575ee_branchDhashed_perceptron_dirs_0 = .csconfig/4b8575ee/branchDhashed_perceptron
-4b8575ee_branchDhashed_perceptron_objs_0 = .csconfig/4b8575ee/branchDhashed_perceptron/hashed_perceptron.o
-$(4b8575ee_branchDhashed_perceptron_objs_0): .csconfig/4b8575ee/branchDhashed_perceptron/%.o: branch/hashed_perceptron/%.cc | $(4b8575ee_branchDhashed_perceptron_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDhashed_perceptron/*.d))
+cf7df5df_branchDhashed_perceptron_dirs_0 = .csconfig/cf7df5df/branchDhashed_perceptron
+cf7df5df_branchDhashed_perceptron_objs_0 = .csconfig/cf7df5df/branchDhashed_perceptron/hashed_perceptron.o
+$(cf7df5df_branchDhashed_perceptron_objs_0): .csconfig/cf7df5df/branchDhashed_perceptron/%.o: branch/hashed_perceptron/%.cc | $(cf7df5df_branchDhashed_perceptron_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDhashed_perceptron/*.d)
 
-$(4b8575ee_branchDhashed_perceptron_objs_0): CPPFLAGS += -Ibranch/hashed_perceptron
-$(4b8575ee_branchDhashed_perceptron_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
-$(4b8575ee_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDhashed_perceptron_objs_0)
-module_dirs += $(4b8575ee_branchDhashed_perceptron_dirs_0)
-module_objs += $(4b8575ee_branchDhashed_perceptron_objs_0)
+$(cf7df5df_branchDhashed_perceptron_objs_0): CPPFLAGS += -Ibranch/hashed_perceptron
+$(cf7df5df_branchDhashed_perceptron_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
+$(cf7df5df_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDhashed_perceptron_objs_0)
+module_dirs += $(cf7df5df_branchDhashed_perceptron_dirs_0)
+module_objs += $(cf7df5df_branchDhashed_perceptron_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDperceptron
 # Source: branch/perceptron
-# Destination: .csconfig/4b8575ee/branchDperceptron
+# Destination: .csconfig/cf7df5df/branchDperceptron
 ###
 
-4b8575ee_branchDperceptron_dirs_0 = .csconfig/4b8575ee/branchDperceptron
-4b8575ee_branchDperceptron_objs_0 = .csconfig/4b8575ee/branchDperceptron/perceptron.o
-$(4b8575ee_branchDperceptron_objs_0): .csconfig/4b8575ee/branchDperceptron/%.o: branch/perceptron/%.cc | $(4b8575ee_branchDperceptron_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDperceptron/*.d))
+cf7df5df_branchDperceptron_dirs_0 = .csconfig/cf7df5df/branchDperceptron
+cf7df5df_branchDperceptron_objs_0 = .csconfig/cf7df5df/branchDperceptron/perceptron.o
+$(cf7df5df_branchDperceptron_objs_0): .csconfig/cf7df5df/branchDperceptron/%.o: branch/perceptron/%.cc | $(cf7df5df_branchDperceptron_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDperceptron/*.d)
 
-$(4b8575ee_branchDperceptron_objs_0): CPPFLAGS += -Ibranch/perceptron
-$(4b8575ee_branchDperceptron_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
-$(4b8575ee_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDperceptron_objs_0)
-module_dirs += $(4b8575ee_branchDperceptron_dirs_0)
-module_objs += $(4b8575ee_branchDperceptron_objs_0)
+$(cf7df5df_branchDperceptron_objs_0): CPPFLAGS += -Ibranch/perceptron
+$(cf7df5df_branchDperceptron_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
+$(cf7df5df_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDperceptron_objs_0)
+module_dirs += $(cf7df5df_branchDperceptron_dirs_0)
+module_objs += $(cf7df5df_branchDperceptron_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: branchDtage_sc_l
 # Source: branch/tage_sc_l
-# Destination: .csconfig/4b8575ee/branchDtage_sc_l
+# Destination: .csconfig/cf7df5df/branchDtage_sc_l
 ###
 
-4b8575ee_branchDtage_sc_l_dirs_0 = .csconfig/4b8575ee/branchDtage_sc_l
-4b8575ee_branchDtage_sc_l_objs_0 = .csconfig/4b8575ee/branchDtage_sc_l/tage_sc_l.o
-$(4b8575ee_branchDtage_sc_l_objs_0): .csconfig/4b8575ee/branchDtage_sc_l/%.o: branch/tage_sc_l/%.cc | $(4b8575ee_branchDtage_sc_l_dirs_0)
--include $(wildcard .csconfig/4b8575ee/branchDtage_sc_l/*.d))
+cf7df5df_branchDtage_sc_l_dirs_0 = .csconfig/cf7df5df/branchDtage_sc_l
+cf7df5df_branchDtage_sc_l_objs_0 = .csconfig/cf7df5df/branchDtage_sc_l/tage_sc_l.o
+$(cf7df5df_branchDtage_sc_l_objs_0): .csconfig/cf7df5df/branchDtage_sc_l/%.o: branch/tage_sc_l/%.cc | $(cf7df5df_branchDtage_sc_l_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/branchDtage_sc_l/*.d)
 
-$(4b8575ee_branchDtage_sc_l_objs_0): CPPFLAGS += -Ibranch/tage_sc_l
-$(4b8575ee_branchDtage_sc_l_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_branchDtage_sc_l_objs_0): CPPFLAGS += -include branchDtage_sc_l.inc
-$(4b8575ee_branchDtage_sc_l_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_branchDtage_sc_l_objs_0)
-module_dirs += $(4b8575ee_branchDtage_sc_l_dirs_0)
-module_objs += $(4b8575ee_branchDtage_sc_l_objs_0)
+$(cf7df5df_branchDtage_sc_l_objs_0): CPPFLAGS += -Ibranch/tage_sc_l
+$(cf7df5df_branchDtage_sc_l_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_branchDtage_sc_l_objs_0): CPPFLAGS += -include branchDtage_sc_l.inc
+$(cf7df5df_branchDtage_sc_l_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_branchDtage_sc_l_objs_0)
+module_dirs += $(cf7df5df_branchDtage_sc_l_dirs_0)
+module_objs += $(cf7df5df_branchDtage_sc_l_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDDHJOLT_instr
 # Source: prefetcher/D-JOLT_instr
-# Destination: .csconfig/4b8575ee/prefetcherDDHJOLT_instr
+# Destination: .csconfig/cf7df5df/prefetcherDDHJOLT_instr
 ###
 
-4b8575ee_prefetcherDDHJOLT_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDDHJOLT_instr
-4b8575ee_prefetcherDDHJOLT_instr_objs_0 = .csconfig/4b8575ee/prefetcherDDHJOLT_instr/d_jolt.o
-$(4b8575ee_prefetcherDDHJOLT_instr_objs_0): .csconfig/4b8575ee/prefetcherDDHJOLT_instr/%.o: prefetcher/D-JOLT_instr/%.cc | $(4b8575ee_prefetcherDDHJOLT_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDDHJOLT_instr/*.d))
+cf7df5df_prefetcherDDHJOLT_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDDHJOLT_instr
+cf7df5df_prefetcherDDHJOLT_instr_objs_0 = .csconfig/cf7df5df/prefetcherDDHJOLT_instr/d_jolt.o
+$(cf7df5df_prefetcherDDHJOLT_instr_objs_0): .csconfig/cf7df5df/prefetcherDDHJOLT_instr/%.o: prefetcher/D-JOLT_instr/%.cc | $(cf7df5df_prefetcherDDHJOLT_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDDHJOLT_instr/*.d)
 
-$(4b8575ee_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -Iprefetcher/D-JOLT_instr
-$(4b8575ee_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -include prefetcherDDHJOLT_instr.inc
-$(4b8575ee_prefetcherDDHJOLT_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDDHJOLT_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDDHJOLT_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDDHJOLT_instr_objs_0)
+$(cf7df5df_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -Iprefetcher/D-JOLT_instr
+$(cf7df5df_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -include prefetcherDDHJOLT_instr.inc
+$(cf7df5df_prefetcherDDHJOLT_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDDHJOLT_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDDHJOLT_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDDHJOLT_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDFNLHMMA_instr
 # Source: prefetcher/FNL-MMA_instr
-# Destination: .csconfig/4b8575ee/prefetcherDFNLHMMA_instr
+# Destination: .csconfig/cf7df5df/prefetcherDFNLHMMA_instr
 ###
 
-4b8575ee_prefetcherDFNLHMMA_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDFNLHMMA_instr
-4b8575ee_prefetcherDFNLHMMA_instr_objs_0 = .csconfig/4b8575ee/prefetcherDFNLHMMA_instr/fnl_mma.o
-$(4b8575ee_prefetcherDFNLHMMA_instr_objs_0): .csconfig/4b8575ee/prefetcherDFNLHMMA_instr/%.o: prefetcher/FNL-MMA_instr/%.cc | $(4b8575ee_prefetcherDFNLHMMA_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDFNLHMMA_instr/*.d))
+cf7df5df_prefetcherDFNLHMMA_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDFNLHMMA_instr
+cf7df5df_prefetcherDFNLHMMA_instr_objs_0 = .csconfig/cf7df5df/prefetcherDFNLHMMA_instr/fnl_mma.o
+$(cf7df5df_prefetcherDFNLHMMA_instr_objs_0): .csconfig/cf7df5df/prefetcherDFNLHMMA_instr/%.o: prefetcher/FNL-MMA_instr/%.cc | $(cf7df5df_prefetcherDFNLHMMA_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDFNLHMMA_instr/*.d)
 
-$(4b8575ee_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -Iprefetcher/FNL-MMA_instr
-$(4b8575ee_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -include prefetcherDFNLHMMA_instr.inc
-$(4b8575ee_prefetcherDFNLHMMA_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDFNLHMMA_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDFNLHMMA_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDFNLHMMA_instr_objs_0)
+$(cf7df5df_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -Iprefetcher/FNL-MMA_instr
+$(cf7df5df_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -include prefetcherDFNLHMMA_instr.inc
+$(cf7df5df_prefetcherDFNLHMMA_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDFNLHMMA_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDFNLHMMA_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDFNLHMMA_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDISCA_Entangling_4Ke_instr
 # Source: prefetcher/ISCA_Entangling_4Ke_instr
-# Destination: .csconfig/4b8575ee/prefetcherDISCA_Entangling_4Ke_instr
+# Destination: .csconfig/cf7df5df/prefetcherDISCA_Entangling_4Ke_instr
 ###
 
-4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDISCA_Entangling_4Ke_instr
-4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0 = .csconfig/4b8575ee/prefetcherDISCA_Entangling_4Ke_instr/ISCA_Entangling_4Ke.o
-$(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0): .csconfig/4b8575ee/prefetcherDISCA_Entangling_4Ke_instr/%.o: prefetcher/ISCA_Entangling_4Ke_instr/%.cc | $(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDISCA_Entangling_4Ke_instr/*.d))
+cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDISCA_Entangling_4Ke_instr
+cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0 = .csconfig/cf7df5df/prefetcherDISCA_Entangling_4Ke_instr/ISCA_Entangling_4Ke.o
+$(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0): .csconfig/cf7df5df/prefetcherDISCA_Entangling_4Ke_instr/%.o: prefetcher/ISCA_Entangling_4Ke_instr/%.cc | $(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDISCA_Entangling_4Ke_instr/*.d)
 
-$(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -Iprefetcher/ISCA_Entangling_4Ke_instr
-$(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -include prefetcherDISCA_Entangling_4Ke_instr.inc
-$(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
+$(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -Iprefetcher/ISCA_Entangling_4Ke_instr
+$(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -include prefetcherDISCA_Entangling_4Ke_instr.inc
+$(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
+# Module: prefetcherDfdip_instr
+# Source: prefetcher/fdip_instr
+# Destination: .csconfig/cf7df5df/prefetcherDfdip_instr
+###
+
+cf7df5df_prefetcherDfdip_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDfdip_instr
+cf7df5df_prefetcherDfdip_instr_objs_0 = .csconfig/cf7df5df/prefetcherDfdip_instr/fdip.o
+$(cf7df5df_prefetcherDfdip_instr_objs_0): .csconfig/cf7df5df/prefetcherDfdip_instr/%.o: prefetcher/fdip_instr/%.cc | $(cf7df5df_prefetcherDfdip_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDfdip_instr/*.d)
+
+$(cf7df5df_prefetcherDfdip_instr_objs_0): CPPFLAGS += -Iprefetcher/fdip_instr
+$(cf7df5df_prefetcherDfdip_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDfdip_instr_objs_0): CPPFLAGS += -include prefetcherDfdip_instr.inc
+$(cf7df5df_prefetcherDfdip_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDfdip_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDfdip_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDfdip_instr_objs_0)
+
+###
+# Build ID: cf7df5df
 # Module: prefetcherDip_stride
 # Source: prefetcher/ip_stride
-# Destination: .csconfig/4b8575ee/prefetcherDip_stride
+# Destination: .csconfig/cf7df5df/prefetcherDip_stride
 ###
 
-4b8575ee_prefetcherDip_stride_dirs_0 = .csconfig/4b8575ee/prefetcherDip_stride
-4b8575ee_prefetcherDip_stride_objs_0 = .csconfig/4b8575ee/prefetcherDip_stride/ip_stride.o
-$(4b8575ee_prefetcherDip_stride_objs_0): .csconfig/4b8575ee/prefetcherDip_stride/%.o: prefetcher/ip_stride/%.cc | $(4b8575ee_prefetcherDip_stride_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDip_stride/*.d))
+cf7df5df_prefetcherDip_stride_dirs_0 = .csconfig/cf7df5df/prefetcherDip_stride
+cf7df5df_prefetcherDip_stride_objs_0 = .csconfig/cf7df5df/prefetcherDip_stride/ip_stride.o
+$(cf7df5df_prefetcherDip_stride_objs_0): .csconfig/cf7df5df/prefetcherDip_stride/%.o: prefetcher/ip_stride/%.cc | $(cf7df5df_prefetcherDip_stride_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDip_stride/*.d)
 
-$(4b8575ee_prefetcherDip_stride_objs_0): CPPFLAGS += -Iprefetcher/ip_stride
-$(4b8575ee_prefetcherDip_stride_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
-$(4b8575ee_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDip_stride_objs_0)
-module_dirs += $(4b8575ee_prefetcherDip_stride_dirs_0)
-module_objs += $(4b8575ee_prefetcherDip_stride_objs_0)
+$(cf7df5df_prefetcherDip_stride_objs_0): CPPFLAGS += -Iprefetcher/ip_stride
+$(cf7df5df_prefetcherDip_stride_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+$(cf7df5df_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDip_stride_objs_0)
+module_dirs += $(cf7df5df_prefetcherDip_stride_dirs_0)
+module_objs += $(cf7df5df_prefetcherDip_stride_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDmini_djolt_instr
 # Source: prefetcher/mini_djolt_instr
-# Destination: .csconfig/4b8575ee/prefetcherDmini_djolt_instr
+# Destination: .csconfig/cf7df5df/prefetcherDmini_djolt_instr
 ###
 
-4b8575ee_prefetcherDmini_djolt_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDmini_djolt_instr
-4b8575ee_prefetcherDmini_djolt_instr_objs_0 = .csconfig/4b8575ee/prefetcherDmini_djolt_instr/mini_djolt.o
-$(4b8575ee_prefetcherDmini_djolt_instr_objs_0): .csconfig/4b8575ee/prefetcherDmini_djolt_instr/%.o: prefetcher/mini_djolt_instr/%.cc | $(4b8575ee_prefetcherDmini_djolt_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDmini_djolt_instr/*.d))
+cf7df5df_prefetcherDmini_djolt_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDmini_djolt_instr
+cf7df5df_prefetcherDmini_djolt_instr_objs_0 = .csconfig/cf7df5df/prefetcherDmini_djolt_instr/mini_djolt.o
+$(cf7df5df_prefetcherDmini_djolt_instr_objs_0): .csconfig/cf7df5df/prefetcherDmini_djolt_instr/%.o: prefetcher/mini_djolt_instr/%.cc | $(cf7df5df_prefetcherDmini_djolt_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDmini_djolt_instr/*.d)
 
-$(4b8575ee_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -Iprefetcher/mini_djolt_instr
-$(4b8575ee_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -include prefetcherDmini_djolt_instr.inc
-$(4b8575ee_prefetcherDmini_djolt_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDmini_djolt_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDmini_djolt_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDmini_djolt_instr_objs_0)
+$(cf7df5df_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -Iprefetcher/mini_djolt_instr
+$(cf7df5df_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -include prefetcherDmini_djolt_instr.inc
+$(cf7df5df_prefetcherDmini_djolt_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDmini_djolt_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDmini_djolt_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDmini_djolt_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDnext_line
 # Source: prefetcher/next_line
-# Destination: .csconfig/4b8575ee/prefetcherDnext_line
+# Destination: .csconfig/cf7df5df/prefetcherDnext_line
 ###
 
-4b8575ee_prefetcherDnext_line_dirs_0 = .csconfig/4b8575ee/prefetcherDnext_line
-4b8575ee_prefetcherDnext_line_objs_0 = .csconfig/4b8575ee/prefetcherDnext_line/next_line.o
-$(4b8575ee_prefetcherDnext_line_objs_0): .csconfig/4b8575ee/prefetcherDnext_line/%.o: prefetcher/next_line/%.cc | $(4b8575ee_prefetcherDnext_line_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDnext_line/*.d))
+cf7df5df_prefetcherDnext_line_dirs_0 = .csconfig/cf7df5df/prefetcherDnext_line
+cf7df5df_prefetcherDnext_line_objs_0 = .csconfig/cf7df5df/prefetcherDnext_line/next_line.o
+$(cf7df5df_prefetcherDnext_line_objs_0): .csconfig/cf7df5df/prefetcherDnext_line/%.o: prefetcher/next_line/%.cc | $(cf7df5df_prefetcherDnext_line_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDnext_line/*.d)
 
-$(4b8575ee_prefetcherDnext_line_objs_0): CPPFLAGS += -Iprefetcher/next_line
-$(4b8575ee_prefetcherDnext_line_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
-$(4b8575ee_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDnext_line_objs_0)
-module_dirs += $(4b8575ee_prefetcherDnext_line_dirs_0)
-module_objs += $(4b8575ee_prefetcherDnext_line_objs_0)
+$(cf7df5df_prefetcherDnext_line_objs_0): CPPFLAGS += -Iprefetcher/next_line
+$(cf7df5df_prefetcherDnext_line_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+$(cf7df5df_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDnext_line_objs_0)
+module_dirs += $(cf7df5df_prefetcherDnext_line_dirs_0)
+module_objs += $(cf7df5df_prefetcherDnext_line_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDnext_line_instr
 # Source: prefetcher/next_line_instr
-# Destination: .csconfig/4b8575ee/prefetcherDnext_line_instr
+# Destination: .csconfig/cf7df5df/prefetcherDnext_line_instr
 ###
 
-4b8575ee_prefetcherDnext_line_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDnext_line_instr
-4b8575ee_prefetcherDnext_line_instr_objs_0 = .csconfig/4b8575ee/prefetcherDnext_line_instr/next_line.o
-$(4b8575ee_prefetcherDnext_line_instr_objs_0): .csconfig/4b8575ee/prefetcherDnext_line_instr/%.o: prefetcher/next_line_instr/%.cc | $(4b8575ee_prefetcherDnext_line_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDnext_line_instr/*.d))
+cf7df5df_prefetcherDnext_line_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDnext_line_instr
+cf7df5df_prefetcherDnext_line_instr_objs_0 = .csconfig/cf7df5df/prefetcherDnext_line_instr/next_line.o
+$(cf7df5df_prefetcherDnext_line_instr_objs_0): .csconfig/cf7df5df/prefetcherDnext_line_instr/%.o: prefetcher/next_line_instr/%.cc | $(cf7df5df_prefetcherDnext_line_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDnext_line_instr/*.d)
 
-$(4b8575ee_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -Iprefetcher/next_line_instr
-$(4b8575ee_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
-$(4b8575ee_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDnext_line_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDnext_line_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDnext_line_instr_objs_0)
+$(cf7df5df_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -Iprefetcher/next_line_instr
+$(cf7df5df_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+$(cf7df5df_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDnext_line_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDnext_line_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDno
 # Source: prefetcher/no
-# Destination: .csconfig/4b8575ee/prefetcherDno
+# Destination: .csconfig/cf7df5df/prefetcherDno
 ###
 
-4b8575ee_prefetcherDno_dirs_0 = .csconfig/4b8575ee/prefetcherDno
-4b8575ee_prefetcherDno_objs_0 = .csconfig/4b8575ee/prefetcherDno/no.o
-$(4b8575ee_prefetcherDno_objs_0): .csconfig/4b8575ee/prefetcherDno/%.o: prefetcher/no/%.cc | $(4b8575ee_prefetcherDno_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDno/*.d))
+cf7df5df_prefetcherDno_dirs_0 = .csconfig/cf7df5df/prefetcherDno
+cf7df5df_prefetcherDno_objs_0 = .csconfig/cf7df5df/prefetcherDno/no.o
+$(cf7df5df_prefetcherDno_objs_0): .csconfig/cf7df5df/prefetcherDno/%.o: prefetcher/no/%.cc | $(cf7df5df_prefetcherDno_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDno/*.d)
 
-$(4b8575ee_prefetcherDno_objs_0): CPPFLAGS += -Iprefetcher/no
-$(4b8575ee_prefetcherDno_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
-$(4b8575ee_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDno_objs_0)
-module_dirs += $(4b8575ee_prefetcherDno_dirs_0)
-module_objs += $(4b8575ee_prefetcherDno_objs_0)
+$(cf7df5df_prefetcherDno_objs_0): CPPFLAGS += -Iprefetcher/no
+$(cf7df5df_prefetcherDno_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+$(cf7df5df_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDno_objs_0)
+module_dirs += $(cf7df5df_prefetcherDno_dirs_0)
+module_objs += $(cf7df5df_prefetcherDno_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDno_instr
 # Source: prefetcher/no_instr
-# Destination: .csconfig/4b8575ee/prefetcherDno_instr
+# Destination: .csconfig/cf7df5df/prefetcherDno_instr
 ###
 
-4b8575ee_prefetcherDno_instr_dirs_0 = .csconfig/4b8575ee/prefetcherDno_instr
-4b8575ee_prefetcherDno_instr_objs_0 = .csconfig/4b8575ee/prefetcherDno_instr/no.o
-$(4b8575ee_prefetcherDno_instr_objs_0): .csconfig/4b8575ee/prefetcherDno_instr/%.o: prefetcher/no_instr/%.cc | $(4b8575ee_prefetcherDno_instr_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDno_instr/*.d))
+cf7df5df_prefetcherDno_instr_dirs_0 = .csconfig/cf7df5df/prefetcherDno_instr
+cf7df5df_prefetcherDno_instr_objs_0 = .csconfig/cf7df5df/prefetcherDno_instr/no.o
+$(cf7df5df_prefetcherDno_instr_objs_0): .csconfig/cf7df5df/prefetcherDno_instr/%.o: prefetcher/no_instr/%.cc | $(cf7df5df_prefetcherDno_instr_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDno_instr/*.d)
 
-$(4b8575ee_prefetcherDno_instr_objs_0): CPPFLAGS += -Iprefetcher/no_instr
-$(4b8575ee_prefetcherDno_instr_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
-$(4b8575ee_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDno_instr_objs_0)
-module_dirs += $(4b8575ee_prefetcherDno_instr_dirs_0)
-module_objs += $(4b8575ee_prefetcherDno_instr_objs_0)
+$(cf7df5df_prefetcherDno_instr_objs_0): CPPFLAGS += -Iprefetcher/no_instr
+$(cf7df5df_prefetcherDno_instr_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
+$(cf7df5df_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDno_instr_objs_0)
+module_dirs += $(cf7df5df_prefetcherDno_instr_dirs_0)
+module_objs += $(cf7df5df_prefetcherDno_instr_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDspp_dev
 # Source: prefetcher/spp_dev
-# Destination: .csconfig/4b8575ee/prefetcherDspp_dev
+# Destination: .csconfig/cf7df5df/prefetcherDspp_dev
+###
+
+cf7df5df_prefetcherDspp_dev_dirs_0 = .csconfig/cf7df5df/prefetcherDspp_dev
+cf7df5df_prefetcherDspp_dev_objs_0 = .csconfig/cf7df5df/prefetcherDspp_dev/spp_dev.o
+$(cf7df5df_prefetcherDspp_dev_objs_0): .csconfig/cf7df5df/prefetcherDspp_dev/%.o: prefetcher/spp_dev/%.cc | $(cf7df5df_prefetcherDspp_dev_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDspp_dev/*.d)
+
+$(cf7df5df_prefetcherDspp_dev_objs_0): CPPFLAGS += -Iprefetcher/spp_dev
+$(cf7df5df_prefetcherDspp_dev_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
+$(cf7df5df_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDspp_dev_objs_0)
+module_dirs += $(cf7df5df_prefetcherDspp_dev_dirs_0)
+module_objs += $(cf7df5df_prefetcherDspp_dev_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: prefetcherDstlb_next_page
+# Source: prefetcher/stlb_next_page
+# Destination: .csconfig/cf7df5df/prefetcherDstlb_next_page
 ###
 
-4b8575ee_prefetcherDspp_dev_dirs_0 = .csconfig/4b8575ee/prefetcherDspp_dev
-4b8575ee_prefetcherDspp_dev_objs_0 = .csconfig/4b8575ee/prefetcherDspp_dev/spp_dev.o
-$(4b8575ee_prefetcherDspp_dev_objs_0): .csconfig/4b8575ee/prefetcherDspp_dev/%.o: prefetcher/spp_dev/%.cc | $(4b8575ee_prefetcherDspp_dev_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDspp_dev/*.d))
+cf7df5df_prefetcherDstlb_next_page_dirs_0 = .csconfig/cf7df5df/prefetcherDstlb_next_page
+cf7df5df_prefetcherDstlb_next_page_objs_0 = .csconfig/cf7df5df/prefetcherDstlb_next_page/stlb_next_page.o
+$(cf7df5df_prefetcherDstlb_next_page_objs_0): .csconfig/cf7df5df/prefetcherDstlb_next_page/%.o: prefetcher/stlb_next_page/%.cc | $(cf7df5df_prefetcherDstlb_next_page_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDstlb_next_page/*.d)
 
-$(4b8575ee_prefetcherDspp_dev_objs_0): CPPFLAGS += -Iprefetcher/spp_dev
-$(4b8575ee_prefetcherDspp_dev_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
-$(4b8575ee_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDspp_dev_objs_0)
-module_dirs += $(4b8575ee_prefetcherDspp_dev_dirs_0)
-module_objs += $(4b8575ee_prefetcherDspp_dev_objs_0)
+$(cf7df5df_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -Iprefetcher/stlb_next_page
+$(cf7df5df_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -include prefetcherDstlb_next_page.inc
+$(cf7df5df_prefetcherDstlb_next_page_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDstlb_next_page_objs_0)
+module_dirs += $(cf7df5df_prefetcherDstlb_next_page_dirs_0)
+module_objs += $(cf7df5df_prefetcherDstlb_next_page_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: prefetcherDva_ampm_lite
 # Source: prefetcher/va_ampm_lite
-# Destination: .csconfig/4b8575ee/prefetcherDva_ampm_lite
+# Destination: .csconfig/cf7df5df/prefetcherDva_ampm_lite
 ###
 
-4b8575ee_prefetcherDva_ampm_lite_dirs_0 = .csconfig/4b8575ee/prefetcherDva_ampm_lite
-4b8575ee_prefetcherDva_ampm_lite_objs_0 = .csconfig/4b8575ee/prefetcherDva_ampm_lite/va_ampm_lite.o
-$(4b8575ee_prefetcherDva_ampm_lite_objs_0): .csconfig/4b8575ee/prefetcherDva_ampm_lite/%.o: prefetcher/va_ampm_lite/%.cc | $(4b8575ee_prefetcherDva_ampm_lite_dirs_0)
--include $(wildcard .csconfig/4b8575ee/prefetcherDva_ampm_lite/*.d))
+cf7df5df_prefetcherDva_ampm_lite_dirs_0 = .csconfig/cf7df5df/prefetcherDva_ampm_lite
+cf7df5df_prefetcherDva_ampm_lite_objs_0 = .csconfig/cf7df5df/prefetcherDva_ampm_lite/va_ampm_lite.o
+$(cf7df5df_prefetcherDva_ampm_lite_objs_0): .csconfig/cf7df5df/prefetcherDva_ampm_lite/%.o: prefetcher/va_ampm_lite/%.cc | $(cf7df5df_prefetcherDva_ampm_lite_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/prefetcherDva_ampm_lite/*.d)
 
-$(4b8575ee_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -Iprefetcher/va_ampm_lite
-$(4b8575ee_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
-$(4b8575ee_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_prefetcherDva_ampm_lite_objs_0)
-module_dirs += $(4b8575ee_prefetcherDva_ampm_lite_dirs_0)
-module_objs += $(4b8575ee_prefetcherDva_ampm_lite_objs_0)
+$(cf7df5df_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -Iprefetcher/va_ampm_lite
+$(cf7df5df_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
+$(cf7df5df_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_prefetcherDva_ampm_lite_objs_0)
+module_dirs += $(cf7df5df_prefetcherDva_ampm_lite_dirs_0)
+module_objs += $(cf7df5df_prefetcherDva_ampm_lite_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDdrrip
 # Source: replacement/drrip
-# Destination: .csconfig/4b8575ee/replacementDdrrip
+# Destination: .csconfig/cf7df5df/replacementDdrrip
+###
+
+cf7df5df_replacementDdrrip_dirs_0 = .csconfig/cf7df5df/replacementDdrrip
+cf7df5df_replacementDdrrip_objs_0 = .csconfig/cf7df5df/replacementDdrrip/drrip.o
+$(cf7df5df_replacementDdrrip_objs_0): .csconfig/cf7df5df/replacementDdrrip/%.o: replacement/drrip/%.cc | $(cf7df5df_replacementDdrrip_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDdrrip/*.d)
+
+$(cf7df5df_replacementDdrrip_objs_0): CPPFLAGS += -Ireplacement/drrip
+$(cf7df5df_replacementDdrrip_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
+$(cf7df5df_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDdrrip_objs_0)
+module_dirs += $(cf7df5df_replacementDdrrip_dirs_0)
+module_objs += $(cf7df5df_replacementDdrrip_objs_0)
+
+###
+# Build ID: cf7df5df
+# Module: replacementDhawkeye
+# Source: replacement/hawkeye
+# Destination: .csconfig/cf7df5df/replacementDhawkeye
 ###
 
-4b8575ee_replacementDdrrip_dirs_0 = .csconfig/4b8575ee/replacementDdrrip
-4b8575ee_replacementDdrrip_objs_0 = .csconfig/4b8575ee/replacementDdrrip/drrip.o
-$(4b8575ee_replacementDdrrip_objs_0): .csconfig/4b8575ee/replacementDdrrip/%.o: replacement/drrip/%.cc | $(4b8575ee_replacementDdrrip_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDdrrip/*.d))
+cf7df5df_replacementDhawkeye_dirs_0 = .csconfig/cf7df5df/replacementDhawkeye
+cf7df5df_replacementDhawkeye_objs_0 = .csconfig/cf7df5df/replacementDhawkeye/hawkeye.o
+$(cf7df5df_replacementDhawkeye_objs_0): .csconfig/cf7df5df/replacementDhawkeye/%.o: replacement/hawkeye/%.cc | $(cf7df5df_replacementDhawkeye_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDhawkeye/*.d)
 
-$(4b8575ee_replacementDdrrip_objs_0): CPPFLAGS += -Ireplacement/drrip
-$(4b8575ee_replacementDdrrip_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
-$(4b8575ee_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDdrrip_objs_0)
-module_dirs += $(4b8575ee_replacementDdrrip_dirs_0)
-module_objs += $(4b8575ee_replacementDdrrip_objs_0)
+$(cf7df5df_replacementDhawkeye_objs_0): CPPFLAGS += -Ireplacement/hawkeye
+$(cf7df5df_replacementDhawkeye_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDhawkeye_objs_0): CPPFLAGS += -include replacementDhawkeye.inc
+$(cf7df5df_replacementDhawkeye_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDhawkeye_objs_0)
+module_dirs += $(cf7df5df_replacementDhawkeye_dirs_0)
+module_objs += $(cf7df5df_replacementDhawkeye_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDhotloop
 # Source: replacement/hotloop
-# Destination: .csconfig/4b8575ee/replacementDhotloop
+# Destination: .csconfig/cf7df5df/replacementDhotloop
 ###
 
-4b8575ee_replacementDhotloop_dirs_0 = .csconfig/4b8575ee/replacementDhotloop
-4b8575ee_replacementDhotloop_objs_0 = .csconfig/4b8575ee/replacementDhotloop/hotloop.o
-$(4b8575ee_replacementDhotloop_objs_0): .csconfig/4b8575ee/replacementDhotloop/%.o: replacement/hotloop/%.cc | $(4b8575ee_replacementDhotloop_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDhotloop/*.d))
+cf7df5df_replacementDhotloop_dirs_0 = .csconfig/cf7df5df/replacementDhotloop
+cf7df5df_replacementDhotloop_objs_0 = .csconfig/cf7df5df/replacementDhotloop/hotloop.o
+$(cf7df5df_replacementDhotloop_objs_0): .csconfig/cf7df5df/replacementDhotloop/%.o: replacement/hotloop/%.cc | $(cf7df5df_replacementDhotloop_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDhotloop/*.d)
 
-$(4b8575ee_replacementDhotloop_objs_0): CPPFLAGS += -Ireplacement/hotloop
-$(4b8575ee_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDhotloop_objs_0): CPPFLAGS += -include replacementDhotloop.inc
-$(4b8575ee_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDhotloop_objs_0)
-module_dirs += $(4b8575ee_replacementDhotloop_dirs_0)
-module_objs += $(4b8575ee_replacementDhotloop_objs_0)
+$(cf7df5df_replacementDhotloop_objs_0): CPPFLAGS += -Ireplacement/hotloop
+$(cf7df5df_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDhotloop_objs_0): CPPFLAGS += -include replacementDhotloop.inc
+$(cf7df5df_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDhotloop_objs_0)
+module_dirs += $(cf7df5df_replacementDhotloop_dirs_0)
+module_objs += $(cf7df5df_replacementDhotloop_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDhotloop_lru
 # Source: replacement/hotloop_lru
-# Destination: .csconfig/4b8575ee/replacementDhotloop_lru
+# Destination: .csconfig/cf7df5df/replacementDhotloop_lru
 ###
 
-4b8575ee_replacementDhotloop_lru_dirs_0 = .csconfig/4b8575ee/replacementDhotloop_lru
-4b8575ee_replacementDhotloop_lru_objs_0 = .csconfig/4b8575ee/replacementDhotloop_lru/hotloop_lru.o
-$(4b8575ee_replacementDhotloop_lru_objs_0): .csconfig/4b8575ee/replacementDhotloop_lru/%.o: replacement/hotloop_lru/%.cc | $(4b8575ee_replacementDhotloop_lru_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDhotloop_lru/*.d))
+cf7df5df_replacementDhotloop_lru_dirs_0 = .csconfig/cf7df5df/replacementDhotloop_lru
+cf7df5df_replacementDhotloop_lru_objs_0 = .csconfig/cf7df5df/replacementDhotloop_lru/hotloop_lru.o
+$(cf7df5df_replacementDhotloop_lru_objs_0): .csconfig/cf7df5df/replacementDhotloop_lru/%.o: replacement/hotloop_lru/%.cc | $(cf7df5df_replacementDhotloop_lru_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDhotloop_lru/*.d)
 
-$(4b8575ee_replacementDhotloop_lru_objs_0): CPPFLAGS += -Ireplacement/hotloop_lru
-$(4b8575ee_replacementDhotloop_lru_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDhotloop_lru_objs_0): CPPFLAGS += -include replacementDhotloop_lru.inc
-$(4b8575ee_replacementDhotloop_lru_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDhotloop_lru_objs_0)
-module_dirs += $(4b8575ee_replacementDhotloop_lru_dirs_0)
-module_objs += $(4b8575ee_replacementDhotloop_lru_objs_0)
+$(cf7df5df_replacementDhotloop_lru_objs_0): CPPFLAGS += -Ireplacement/hotloop_lru
+$(cf7df5df_replacementDhotloop_lru_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDhotloop_lru_objs_0): CPPFLAGS += -include replacementDhotloop_lru.inc
+$(cf7df5df_replacementDhotloop_lru_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDhotloop_lru_objs_0)
+module_dirs += $(cf7df5df_replacementDhotloop_lru_dirs_0)
+module_objs += $(cf7df5df_replacementDhotloop_lru_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDlru
 # Source: replacement/lru
-# Destination: .csconfig/4b8575ee/replacementDlru
+# Destination: .csconfig/cf7df5df/replacementDlru
 ###
 
-4b8575ee_replacementDlru_dirs_0 = .csconfig/4b8575ee/replacementDlru
-4b8575ee_replacementDlru_objs_0 = .csconfig/4b8575ee/replacementDlru/lru.o
-$(4b8575ee_replacementDlru_objs_0): .csconfig/4b8575ee/replacementDlru/%.o: replacement/lru/%.cc | $(4b8575ee_replacementDlru_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDlru/*.d))
+cf7df5df_replacementDlru_dirs_0 = .csconfig/cf7df5df/replacementDlru
+cf7df5df_replacementDlru_objs_0 = .csconfig/cf7df5df/replacementDlru/lru.o
+$(cf7df5df_replacementDlru_objs_0): .csconfig/cf7df5df/replacementDlru/%.o: replacement/lru/%.cc | $(cf7df5df_replacementDlru_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDlru/*.d)
 
-$(4b8575ee_replacementDlru_objs_0): CPPFLAGS += -Ireplacement/lru
-$(4b8575ee_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
-$(4b8575ee_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDlru_objs_0)
-module_dirs += $(4b8575ee_replacementDlru_dirs_0)
-module_objs += $(4b8575ee_replacementDlru_objs_0)
+$(cf7df5df_replacementDlru_objs_0): CPPFLAGS += -Ireplacement/lru
+$(cf7df5df_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+$(cf7df5df_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDlru_objs_0)
+module_dirs += $(cf7df5df_replacementDlru_dirs_0)
+module_objs += $(cf7df5df_replacementDlru_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDship
 # Source: replacement/ship
-# Destination: .csconfig/4b8575ee/replacementDship
+# Destination: .csconfig/cf7df5df/replacementDship
 ###
 
-4b8575ee_replacementDship_dirs_0 = .csconfig/4b8575ee/replacementDship
-4b8575ee_replacementDship_objs_0 = .csconfig/4b8575ee/replacementDship/ship.o
-$(4b8575ee_replacementDship_objs_0): .csconfig/4b8575ee/replacementDship/%.o: replacement/ship/%.cc | $(4b8575ee_replacementDship_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDship/*.d))
+cf7df5df_replacementDship_dirs_0 = .csconfig/cf7df5df/replacementDship
+cf7df5df_replacementDship_objs_0 = .csconfig/cf7df5df/replacementDship/ship.o
+$(cf7df5df_replacementDship_objs_0): .csconfig/cf7df5df/replacementDship/%.o: replacement/ship/%.cc | $(cf7df5df_replacementDship_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDship/*.d)
 
-$(4b8575ee_replacementDship_objs_0): CPPFLAGS += -Ireplacement/ship
-$(4b8575ee_replacementDship_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
-$(4b8575ee_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDship_objs_0)
-module_dirs += $(4b8575ee_replacementDship_dirs_0)
-module_objs += $(4b8575ee_replacementDship_objs_0)
+$(cf7df5df_replacementDship_objs_0): CPPFLAGS += -Ireplacement/ship
+$(cf7df5df_replacementDship_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
+$(cf7df5df_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDship_objs_0)
+module_dirs += $(cf7df5df_replacementDship_dirs_0)
+module_objs += $(cf7df5df_replacementDship_objs_0)
 
 ###
-# Build ID: 4b8575ee
+# Build ID: cf7df5df
 # Module: replacementDsrrip
 # Source: replacement/srrip
-# Destination: .csconfig/4b8575ee/replacementDsrrip
+# Destination: .csconfig/cf7df5df/replacementDsrrip
 ###
 
-4b8575ee_replacementDsrrip_dirs_0 = .csconfig/4b8575ee/replacementDsrrip
-4b8575ee_replacementDsrrip_objs_0 = .csconfig/4b8575ee/replacementDsrrip/srrip.o
-$(4b8575ee_replacementDsrrip_objs_0): .csconfig/4b8575ee/replacementDsrrip/%.o: replacement/srrip/%.cc | $(4b8575ee_replacementDsrrip_dirs_0)
--include $(wildcard .csconfig/4b8575ee/replacementDsrrip/*.d))
+cf7df5df_replacementDsrrip_dirs_0 = .csconfig/cf7df5df/replacementDsrrip
+cf7df5df_replacementDsrrip_objs_0 = .csconfig/cf7df5df/replacementDsrrip/srrip.o
+$(cf7df5df_replacementDsrrip_objs_0): .csconfig/cf7df5df/replacementDsrrip/%.o: replacement/srrip/%.cc | $(cf7df5df_replacementDsrrip_dirs_0)
+-include $(wildcard .csconfig/cf7df5df/replacementDsrrip/*.d)
 
-$(4b8575ee_replacementDsrrip_objs_0): CPPFLAGS += -Ireplacement/srrip
-$(4b8575ee_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/4b8575ee/inc
-$(4b8575ee_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
-$(4b8575ee_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
-bin/UCP: $(4b8575ee_replacementDsrrip_objs_0)
-module_dirs += $(4b8575ee_replacementDsrrip_dirs_0)
-module_objs += $(4b8575ee_replacementDsrrip_objs_0)
+$(cf7df5df_replacementDsrrip_objs_0): CPPFLAGS += -Ireplacement/srrip
+$(cf7df5df_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/cf7df5df/inc
+$(cf7df5df_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
+$(cf7df5df_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+bin/UCP: $(cf7df5df_replacementDsrrip_objs_0)
+module_dirs += $(cf7df5df_replacementDsrrip_dirs_0)
+module_objs += $(cf7df5df_replacementDsrrip_objs_0)
 
 ######
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 ######
 
-d6ee6fa2_dirs_0 = .csconfig/test/d6ee6fa2/obj
-d6ee6fa2_objs_0 = .csconfig/test/d6ee6fa2/obj/cache.o\
-  .csconfig/test/d6ee6fa2/obj/cache_queues.o\
-  .csconfig/test/d6ee6fa2/obj/champsim.o\
-  .csconfig/test/d6ee6fa2/obj/dram_controller.o\
-  .csconfig/test/d6ee6fa2/obj/json_printer.o\
-  .csconfig/test/d6ee6fa2/obj/main.o\
-  .csconfig/test/d6ee6fa2/obj/module_defs.o\
-  .csconfig/test/d6ee6fa2/obj/ooo_cpu.o\
-  .csconfig/test/d6ee6fa2/obj/plain_printer.o\
-  .csconfig/test/d6ee6fa2/obj/ptw.o\
-  .csconfig/test/d6ee6fa2/obj/tracereader.o\
-  .csconfig/test/d6ee6fa2/obj/vmem.o
-$(d6ee6fa2_objs_0): .csconfig/test/d6ee6fa2/obj/%.o: src/%.cc | $(d6ee6fa2_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/obj/*.d))
-
-$(d6ee6fa2_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-test/bin/000-test-main: $(d6ee6fa2_objs_0)
-build_dirs += $(d6ee6fa2_dirs_0)
-build_objs += $(d6ee6fa2_objs_0)
+f77d9fda_dirs_0 = .csconfig/test/f77d9fda/obj
+f77d9fda_objs_0 = .csconfig/test/f77d9fda/obj/cache.o\
+  .csconfig/test/f77d9fda/obj/cache_queues.o\
+  .csconfig/test/f77d9fda/obj/champsim.o\
+  .csconfig/test/f77d9fda/obj/dram_controller.o\
+  .csconfig/test/f77d9fda/obj/json_printer.o\
+  .csconfig/test/f77d9fda/obj/main.o\
+  .csconfig/test/f77d9fda/obj/module_defs.o\
+  .csconfig/test/f77d9fda/obj/ooo_cpu.o\
+  .csconfig/test/f77d9fda/obj/plain_printer.o\
+  .csconfig/test/f77d9fda/obj/ptw.o\
+  .csconfig/test/f77d9fda/obj/tracereader.o\
+  .csconfig/test/f77d9fda/obj/vmem.o
+$(f77d9fda_objs_0): .csconfig/test/f77d9fda/obj/%.o: src/%.cc | $(f77d9fda_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/obj/*.d)
+
+f77d9fda_dirs_1 = .csconfig/test/f77d9fda/obj
+f77d9fda_objs_1 = .csconfig/test/f77d9fda/obj/000-test-main.o\
+  .csconfig/test/f77d9fda/obj/010-fetch-block-predictor.o\
+  .csconfig/test/f77d9fda/obj/020-dram-timing-model.o\
+  .csconfig/test/f77d9fda/obj/030-ptw-walks.o\
+  .csconfig/test/f77d9fda/obj/040-slab-allocator.o\
+  .csconfig/test/f77d9fda/obj/050-bloom-filter.o\
+  .csconfig/test/f77d9fda/obj/060-optgen.o\
+  .csconfig/test/f77d9fda/obj/070-uop-cache-capacity.o\
+  .csconfig/test/f77d9fda/obj/080-hashed-perceptron-kernel.o\
+  .csconfig/test/f77d9fda/obj/090-prefetch-controller.o\
+  .csconfig/test/f77d9fda/obj/100-uop-pref-throttle.o\
+  .csconfig/test/f77d9fda/obj/110-loop-stream-detector.o\
+  .csconfig/test/f77d9fda/obj/120-bounded-hash-map.o\
+  .csconfig/test/f77d9fda/obj/130-replacement-state.o\
+  .csconfig/test/f77d9fda/obj/140-dram-queue-index.o\
+  .csconfig/test/f77d9fda/obj/150-small-vector.o\
+  .csconfig/test/f77d9fda/obj/160-cache-queue-collisions.o\
+  .csconfig/test/f77d9fda/obj/170-uop-cache-replacement.o
+$(f77d9fda_objs_1): .csconfig/test/f77d9fda/obj/%.o: test/%.cc | $(f77d9fda_dirs_1)
+-include $(wildcard .csconfig/test/f77d9fda/obj/*.d)
+
+$(f77d9fda_objs_0) $(f77d9fda_objs_1): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+test/bin/000-test-main: $(f77d9fda_objs_0) $(f77d9fda_objs_1)
+build_dirs += $(f77d9fda_dirs_0) $(f77d9fda_dirs_1)
+build_objs += $(f77d9fda_objs_0) $(f77d9fda_objs_1)
 test/bin/000-test-main: | test/bin
 build_dirs += test/bin
 executable_name += test/bin/000-test-main
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
+# Module: uop_replacementDhotloop
+# Source: uop_replacement/hotloop
+# Destination: .csconfig/test/f77d9fda/uop_replacementDhotloop
+###
+
+f77d9fda_uop_replacementDhotloop_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDhotloop
+f77d9fda_uop_replacementDhotloop_objs_0 = .csconfig/test/f77d9fda/uop_replacementDhotloop/hotloop.o
+$(f77d9fda_uop_replacementDhotloop_objs_0): .csconfig/test/f77d9fda/uop_replacementDhotloop/%.o: uop_replacement/hotloop/%.cc | $(f77d9fda_uop_replacementDhotloop_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDhotloop/*.d)
+
+$(f77d9fda_uop_replacementDhotloop_objs_0): CPPFLAGS += -Iuop_replacement/hotloop
+$(f77d9fda_uop_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDhotloop_objs_0): CPPFLAGS += -include uop_replacementDhotloop.inc
+$(f77d9fda_uop_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDhotloop_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDhotloop_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDhotloop_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDhotloopcritical
+# Source: uop_replacement/hotloopcritical
+# Destination: .csconfig/test/f77d9fda/uop_replacementDhotloopcritical
+###
+
+f77d9fda_uop_replacementDhotloopcritical_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDhotloopcritical
+f77d9fda_uop_replacementDhotloopcritical_objs_0 = .csconfig/test/f77d9fda/uop_replacementDhotloopcritical/hotloopcritical.o
+$(f77d9fda_uop_replacementDhotloopcritical_objs_0): .csconfig/test/f77d9fda/uop_replacementDhotloopcritical/%.o: uop_replacement/hotloopcritical/%.cc | $(f77d9fda_uop_replacementDhotloopcritical_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDhotloopcritical/*.d)
+
+$(f77d9fda_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -Iuop_replacement/hotloopcritical
+$(f77d9fda_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDhotloopcritical_objs_0): CPPFLAGS += -include uop_replacementDhotloopcritical.inc
+$(f77d9fda_uop_replacementDhotloopcritical_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDhotloopcritical_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDhotloopcritical_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDhotloopcritical_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDlru
+# Source: uop_replacement/lru
+# Destination: .csconfig/test/f77d9fda/uop_replacementDlru
+###
+
+f77d9fda_uop_replacementDlru_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDlru
+f77d9fda_uop_replacementDlru_objs_0 = .csconfig/test/f77d9fda/uop_replacementDlru/lru.o
+$(f77d9fda_uop_replacementDlru_objs_0): .csconfig/test/f77d9fda/uop_replacementDlru/%.o: uop_replacement/lru/%.cc | $(f77d9fda_uop_replacementDlru_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDlru/*.d)
+
+$(f77d9fda_uop_replacementDlru_objs_0): CPPFLAGS += -Iuop_replacement/lru
+$(f77d9fda_uop_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDlru_objs_0): CPPFLAGS += -include uop_replacementDlru.inc
+$(f77d9fda_uop_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDlru_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDlru_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDlru_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDlrucritical
+# Source: uop_replacement/lrucritical
+# Destination: .csconfig/test/f77d9fda/uop_replacementDlrucritical
+###
+
+f77d9fda_uop_replacementDlrucritical_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDlrucritical
+f77d9fda_uop_replacementDlrucritical_objs_0 = .csconfig/test/f77d9fda/uop_replacementDlrucritical/lrucritical.o
+$(f77d9fda_uop_replacementDlrucritical_objs_0): .csconfig/test/f77d9fda/uop_replacementDlrucritical/%.o: uop_replacement/lrucritical/%.cc | $(f77d9fda_uop_replacementDlrucritical_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDlrucritical/*.d)
+
+$(f77d9fda_uop_replacementDlrucritical_objs_0): CPPFLAGS += -Iuop_replacement/lrucritical
+$(f77d9fda_uop_replacementDlrucritical_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDlrucritical_objs_0): CPPFLAGS += -include uop_replacementDlrucritical.inc
+$(f77d9fda_uop_replacementDlrucritical_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDlrucritical_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDlrucritical_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDlrucritical_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDlruhotloop
+# Source: uop_replacement/lruhotloop
+# Destination: .csconfig/test/f77d9fda/uop_replacementDlruhotloop
+###
+
+f77d9fda_uop_replacementDlruhotloop_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDlruhotloop
+f77d9fda_uop_replacementDlruhotloop_objs_0 = .csconfig/test/f77d9fda/uop_replacementDlruhotloop/lruhotloop.o
+$(f77d9fda_uop_replacementDlruhotloop_objs_0): .csconfig/test/f77d9fda/uop_replacementDlruhotloop/%.o: uop_replacement/lruhotloop/%.cc | $(f77d9fda_uop_replacementDlruhotloop_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDlruhotloop/*.d)
+
+$(f77d9fda_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -Iuop_replacement/lruhotloop
+$(f77d9fda_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDlruhotloop_objs_0): CPPFLAGS += -include uop_replacementDlruhotloop.inc
+$(f77d9fda_uop_replacementDlruhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDlruhotloop_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDlruhotloop_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDlruhotloop_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDsmartlru
+# Source: uop_replacement/smartlru
+# Destination: .csconfig/test/f77d9fda/uop_replacementDsmartlru
+###
+
+f77d9fda_uop_replacementDsmartlru_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDsmartlru
+f77d9fda_uop_replacementDsmartlru_objs_0 = .csconfig/test/f77d9fda/uop_replacementDsmartlru/smartlru.o
+$(f77d9fda_uop_replacementDsmartlru_objs_0): .csconfig/test/f77d9fda/uop_replacementDsmartlru/%.o: uop_replacement/smartlru/%.cc | $(f77d9fda_uop_replacementDsmartlru_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDsmartlru/*.d)
+
+$(f77d9fda_uop_replacementDsmartlru_objs_0): CPPFLAGS += -Iuop_replacement/smartlru
+$(f77d9fda_uop_replacementDsmartlru_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDsmartlru_objs_0): CPPFLAGS += -include uop_replacementDsmartlru.inc
+$(f77d9fda_uop_replacementDsmartlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDsmartlru_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDsmartlru_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDsmartlru_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: uop_replacementDsrrip
+# Source: uop_replacement/srrip
+# Destination: .csconfig/test/f77d9fda/uop_replacementDsrrip
+###
+
+f77d9fda_uop_replacementDsrrip_dirs_0 = .csconfig/test/f77d9fda/uop_replacementDsrrip
+f77d9fda_uop_replacementDsrrip_objs_0 = .csconfig/test/f77d9fda/uop_replacementDsrrip/srrip.o
+$(f77d9fda_uop_replacementDsrrip_objs_0): .csconfig/test/f77d9fda/uop_replacementDsrrip/%.o: uop_replacement/srrip/%.cc | $(f77d9fda_uop_replacementDsrrip_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/uop_replacementDsrrip/*.d)
+
+$(f77d9fda_uop_replacementDsrrip_objs_0): CPPFLAGS += -Iuop_replacement/srrip
+$(f77d9fda_uop_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_uop_replacementDsrrip_objs_0): CPPFLAGS += -include uop_replacementDsrrip.inc
+$(f77d9fda_uop_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_uop_replacementDsrrip_objs_0)
+module_dirs += $(f77d9fda_uop_replacementDsrrip_dirs_0)
+module_objs += $(f77d9fda_uop_replacementDsrrip_objs_0)
+
+###
+# Build ID: f77d9fda
 # Module: btbDbasic_btb
 # Source: btb/basic_btb
-# Destination: .csconfig/test/d6ee6fa2/btbDbasic_btb
+# Destination: .csconfig/test/f77d9fda/btbDbasic_btb
 ###
 
-d6ee6fa2_btbDbasic_btb_dirs_0 = .csconfig/test/d6ee6fa2/btbDbasic_btb
-d6ee6fa2_btbDbasic_btb_objs_0 = .csconfig/test/d6ee6fa2/btbDbasic_btb/basic_btb.o
-$(d6ee6fa2_btbDbasic_btb_objs_0): .csconfig/test/d6ee6fa2/btbDbasic_btb/%.o: btb/basic_btb/%.cc | $(d6ee6fa2_btbDbasic_btb_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/btbDbasic_btb/*.d))
+f77d9fda_btbDbasic_btb_dirs_0 = .csconfig/test/f77d9fda/btbDbasic_btb
+f77d9fda_btbDbasic_btb_objs_0 = .csconfig/test/f77d9fda/btbDbasic_btb/basic_btb.o
+$(f77d9fda_btbDbasic_btb_objs_0): .csconfig/test/f77d9fda/btbDbasic_btb/%.o: btb/basic_btb/%.cc | $(f77d9fda_btbDbasic_btb_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/btbDbasic_btb/*.d)
 
-$(d6ee6fa2_btbDbasic_btb_objs_0): CPPFLAGS += -Ibtb/basic_btb
-$(d6ee6fa2_btbDbasic_btb_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
-$(d6ee6fa2_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_btbDbasic_btb_objs_0)
-module_dirs += $(d6ee6fa2_btbDbasic_btb_dirs_0)
-module_objs += $(d6ee6fa2_btbDbasic_btb_objs_0)
+$(f77d9fda_btbDbasic_btb_objs_0): CPPFLAGS += -Ibtb/basic_btb
+$(f77d9fda_btbDbasic_btb_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_btbDbasic_btb_objs_0): CPPFLAGS += -include btbDbasic_btb.inc
+$(f77d9fda_btbDbasic_btb_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_btbDbasic_btb_objs_0)
+module_dirs += $(f77d9fda_btbDbasic_btb_dirs_0)
+module_objs += $(f77d9fda_btbDbasic_btb_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: btbDittage_64KB
 # Source: btb/ittage_64KB
-# Destination: .csconfig/test/d6ee6fa2/btbDittage_64KB
+# Destination: .csconfig/test/f77d9fda/btbDittage_64KB
 ###
 
-d6ee6fa2_btbDittage_64KB_dirs_0 = .csconfig/test/d6ee6fa2/btbDittage_64KB
-d6ee6fa2_btbDittage_64KB_objs_0 = .csconfig/test/d6ee6fa2/btbDittage_64KB/basic_btb.o
-$(d6ee6fa2_btbDittage_64KB_objs_0): .csconfig/test/d6ee6fa2/btbDittage_64KB/%.o: btb/ittage_64KB/%.cc | $(d6ee6fa2_btbDittage_64KB_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/btbDittage_64KB/*.d))
+f77d9fda_btbDittage_64KB_dirs_0 = .csconfig/test/f77d9fda/btbDittage_64KB
+f77d9fda_btbDittage_64KB_objs_0 = .csconfig/test/f77d9fda/btbDittage_64KB/basic_btb.o
+$(f77d9fda_btbDittage_64KB_objs_0): .csconfig/test/f77d9fda/btbDittage_64KB/%.o: btb/ittage_64KB/%.cc | $(f77d9fda_btbDittage_64KB_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/btbDittage_64KB/*.d)
 
-$(d6ee6fa2_btbDittage_64KB_objs_0): CPPFLAGS += -Ibtb/ittage_64KB
-$(d6ee6fa2_btbDittage_64KB_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_btbDittage_64KB_objs_0): CPPFLAGS += -include btbDittage_64KB.inc
-$(d6ee6fa2_btbDittage_64KB_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_btbDittage_64KB_objs_0)
-module_dirs += $(d6ee6fa2_btbDittage_64KB_dirs_0)
-module_objs += $(d6ee6fa2_btbDittage_64KB_objs_0)
+$(f77d9fda_btbDittage_64KB_objs_0): CPPFLAGS += -Ibtb/ittage_64KB
+$(f77d9fda_btbDittage_64KB_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_btbDittage_64KB_objs_0): CPPFLAGS += -include btbDittage_64KB.inc
+$(f77d9fda_btbDittage_64KB_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_btbDittage_64KB_objs_0)
+module_dirs += $(f77d9fda_btbDittage_64KB_dirs_0)
+module_objs += $(f77d9fda_btbDittage_64KB_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
 # Source: btb/twolevel_btb_1Ke_32Ke_gshare_ittage
-# Destination: .csconfig/test/d6ee6fa2/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
+# Destination: .csconfig/test/f77d9fda/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
 ###
 
-d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0 = .csconfig/test/d6ee6fa2/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
-d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0 = .csconfig/test/d6ee6fa2/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/target_predictor.o
-$(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): .csconfig/test/d6ee6fa2/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/%.o: btb/twolevel_btb_1Ke_32Ke_gshare_ittage/%.cc | $(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/*.d))
+f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0 = .csconfig/test/f77d9fda/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage
+f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0 = .csconfig/test/f77d9fda/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/target_predictor.o
+$(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): .csconfig/test/f77d9fda/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/%.o: btb/twolevel_btb_1Ke_32Ke_gshare_ittage/%.cc | $(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/btbDtwolevel_btb_1Ke_32Ke_gshare_ittage/*.d)
 
-$(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -Ibtb/twolevel_btb_1Ke_32Ke_gshare_ittage
-$(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -include btbDtwolevel_btb_1Ke_32Ke_gshare_ittage.inc
-$(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
-module_dirs += $(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
-module_objs += $(d6ee6fa2_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
+$(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -Ibtb/twolevel_btb_1Ke_32Ke_gshare_ittage
+$(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CPPFLAGS += -include btbDtwolevel_btb_1Ke_32Ke_gshare_ittage.inc
+$(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
+module_dirs += $(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_dirs_0)
+module_objs += $(f77d9fda_btbDtwolevel_btb_1Ke_32Ke_gshare_ittage_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDbatage
 # Source: branch/batage
-# Destination: .csconfig/test/d6ee6fa2/branchDbatage
+# Destination: .csconfig/test/f77d9fda/branchDbatage
 ###
 
-d6ee6fa2_branchDbatage_dirs_0 = .csconfig/test/d6ee6fa2/branchDbatage
-d6ee6fa2_branchDbatage_objs_0 = .csconfig/test/d6ee6fa2/branchDbatage/batage.o\
-  .csconfig/test/d6ee6fa2/branchDbatage/btage_predictor.o
-$(d6ee6fa2_branchDbatage_objs_0): .csconfig/test/d6ee6fa2/branchDbatage/%.o: branch/batage/%.cc | $(d6ee6fa2_branchDbatage_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDbatage/*.d))
+f77d9fda_branchDbatage_dirs_0 = .csconfig/test/f77d9fda/branchDbatage
+f77d9fda_branchDbatage_objs_0 = .csconfig/test/f77d9fda/branchDbatage/batage.o\
+  .csconfig/test/f77d9fda/branchDbatage/btage_predictor.o
+$(f77d9fda_branchDbatage_objs_0): .csconfig/test/f77d9fda/branchDbatage/%.o: branch/batage/%.cc | $(f77d9fda_branchDbatage_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDbatage/*.d)
 
-$(d6ee6fa2_branchDbatage_objs_0): CPPFLAGS += -Ibranch/batage
-$(d6ee6fa2_branchDbatage_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDbatage_objs_0): CPPFLAGS += -include branchDbatage.inc
-$(d6ee6fa2_branchDbatage_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDbatage_objs_0)
-module_dirs += $(d6ee6fa2_branchDbatage_dirs_0)
-module_objs += $(d6ee6fa2_branchDbatage_objs_0)
+$(f77d9fda_branchDbatage_objs_0): CPPFLAGS += -Ibranch/batage
+$(f77d9fda_branchDbatage_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDbatage_objs_0): CPPFLAGS += -include branchDbatage.inc
+$(f77d9fda_branchDbatage_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDbatage_objs_0)
+module_dirs += $(f77d9fda_branchDbatage_dirs_0)
+module_objs += $(f77d9fda_branchDbatage_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDbimodal
 # Source: branch/bimodal
-# Destination: .csconfig/test/d6ee6fa2/branchDbimodal
+# Destination: .csconfig/test/f77d9fda/branchDbimodal
 ###
 
-d6ee6fa2_branchDbimodal_dirs_0 = .csconfig/test/d6ee6fa2/branchDbimodal
-d6ee6fa2_branchDbimodal_objs_0 = .csconfig/test/d6ee6fa2/branchDbimodal/bimodal.o
-$(d6ee6fa2_branchDbimodal_objs_0): .csconfig/test/d6ee6fa2/branchDbimodal/%.o: branch/bimodal/%.cc | $(d6ee6fa2_branchDbimodal_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDbimodal/*.d))
+f77d9fda_branchDbimodal_dirs_0 = .csconfig/test/f77d9fda/branchDbimodal
+f77d9fda_branchDbimodal_objs_0 = .csconfig/test/f77d9fda/branchDbimodal/bimodal.o
+$(f77d9fda_branchDbimodal_objs_0): .csconfig/test/f77d9fda/branchDbimodal/%.o: branch/bimodal/%.cc | $(f77d9fda_branchDbimodal_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDbimodal/*.d)
 
-$(d6ee6fa2_branchDbimodal_objs_0): CPPFLAGS += -Ibranch/bimodal
-$(d6ee6fa2_branchDbimodal_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
-$(d6ee6fa2_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDbimodal_objs_0)
-module_dirs += $(d6ee6fa2_branchDbimodal_dirs_0)
-module_objs += $(d6ee6fa2_branchDbimodal_objs_0)
+$(f77d9fda_branchDbimodal_objs_0): CPPFLAGS += -Ibranch/bimodal
+$(f77d9fda_branchDbimodal_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDbimodal_objs_0): CPPFLAGS += -include branchDbimodal.inc
+$(f77d9fda_branchDbimodal_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDbimodal_objs_0)
+module_dirs += $(f77d9fda_branchDbimodal_dirs_0)
+module_objs += $(f77d9fda_branchDbimodal_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDgshare
 # Source: branch/gshare
-# Destination: .csconfig/test/d6ee6fa2/branchDgshare
+# Destination: .csconfig/test/f77d9fda/branchDgshare
 ###
 
-d6ee6fa2_branchDgshare_dirs_0 = .csconfig/test/d6ee6fa2/branchDgshare
-d6ee6fa2_branchDgshare_objs_0 = .csconfig/test/d6ee6fa2/branchDgshare/gshare.o
-$(d6ee6fa2_branchDgshare_objs_0): .csconfig/test/d6ee6fa2/branchDgshare/%.o: branch/gshare/%.cc | $(d6ee6fa2_branchDgshare_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDgshare/*.d))
+f77d9fda_branchDgshare_dirs_0 = .csconfig/test/f77d9fda/branchDgshare
+f77d9fda_branchDgshare_objs_0 = .csconfig/test/f77d9fda/branchDgshare/gshare.o
+$(f77d9fda_branchDgshare_objs_0): .csconfig/test/f77d9fda/branchDgshare/%.o: branch/gshare/%.cc | $(f77d9fda_branchDgshare_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDgshare/*.d)
 
-$(d6ee6fa2_branchDgshare_objs_0): CPPFLAGS += -Ibranch/gshare
-$(d6ee6fa2_branchDgshare_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
-$(d6ee6fa2_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDgshare_objs_0)
-module_dirs += $(d6ee6fa2_branchDgshare_dirs_0)
-module_objs += $(d6ee6fa2_branchDgshare_objs_0)
+$(f77d9fda_branchDgshare_objs_0): CPPFLAGS += -Ibranch/gshare
+$(f77d9fda_branchDgshare_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDgshare_objs_0): CPPFLAGS += -include branchDgshare.inc
+$(f77d9fda_branchDgshare_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDgshare_objs_0)
+module_dirs += $(f77d9fda_branchDgshare_dirs_0)
+module_objs += $(f77d9fda_branchDgshare_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDhashed_perceptron
 # Source: branch/hashed_perceptron
-# Destination: .csconfig/test/d6ee6fa2/branchDhashed_perceptron
+# Destination: .csconfig/test/f77d9fda/branchDhashed_perceptron
 ###
 
-d6ee6fa2_branchDhashed_perceptron_dirs_0 = .csconfig/test/d6ee6fa2/branchDhashed_perceptron
-d6ee6fa2_branchDhashed_perceptron_objs_0 = .csconfig/test/d6ee6fa2/branchDhashed_perceptron/hashed_perceptron.o
-$(d6ee6fa2_branchDhashed_perceptron_objs_0): .csconfig/test/d6ee6fa2/branchDhashed_perceptron/%.o: branch/hashed_perceptron/%.cc | $(d6ee6fa2_branchDhashed_perceptron_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDhashed_perceptron/*.d))
+f77d9fda_branchDhashed_perceptron_dirs_0 = .csconfig/test/f77d9fda/branchDhashed_perceptron
+f77d9fda_branchDhashed_perceptron_objs_0 = .csconfig/test/f77d9fda/branchDhashed_perceptron/hashed_perceptron.o
+$(f77d9fda_branchDhashed_perceptron_objs_0): .csconfig/test/f77d9fda/branchDhashed_perceptron/%.o: branch/hashed_perceptron/%.cc | $(f77d9fda_branchDhashed_perceptron_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDhashed_perceptron/*.d)
 
-$(d6ee6fa2_branchDhashed_perceptron_objs_0): CPPFLAGS += -Ibranch/hashed_perceptron
-$(d6ee6fa2_branchDhashed_perceptron_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
-$(d6ee6fa2_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDhashed_perceptron_objs_0)
-module_dirs += $(d6ee6fa2_branchDhashed_perceptron_dirs_0)
-module_objs += $(d6ee6fa2_branchDhashed_perceptron_objs_0)
+$(f77d9fda_branchDhashed_perceptron_objs_0): CPPFLAGS += -Ibranch/hashed_perceptron
+$(f77d9fda_branchDhashed_perceptron_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDhashed_perceptron_objs_0): CPPFLAGS += -include branchDhashed_perceptron.inc
+$(f77d9fda_branchDhashed_perceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDhashed_perceptron_objs_0)
+module_dirs += $(f77d9fda_branchDhashed_perceptron_dirs_0)
+module_objs += $(f77d9fda_branchDhashed_perceptron_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDperceptron
 # Source: branch/perceptron
-# Destination: .csconfig/test/d6ee6fa2/branchDperceptron
+# Destination: .csconfig/test/f77d9fda/branchDperceptron
 ###
 
-d6ee6fa2_branchDperceptron_dirs_0 = .csconfig/test/d6ee6fa2/branchDperceptron
-d6ee6fa2_branchDperceptron_objs_0 = .csconfig/test/d6ee6fa2/branchDperceptron/perceptron.o
-$(d6ee6fa2_branchDperceptron_objs_0): .csconfig/test/d6ee6fa2/branchDperceptron/%.o: branch/perceptron/%.cc | $(d6ee6fa2_branchDperceptron_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDperceptron/*.d))
+f77d9fda_branchDperceptron_dirs_0 = .csconfig/test/f77d9fda/branchDperceptron
+f77d9fda_branchDperceptron_objs_0 = .csconfig/test/f77d9fda/branchDperceptron/perceptron.o
+$(f77d9fda_branchDperceptron_objs_0): .csconfig/test/f77d9fda/branchDperceptron/%.o: branch/perceptron/%.cc | $(f77d9fda_branchDperceptron_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDperceptron/*.d)
 
-$(d6ee6fa2_branchDperceptron_objs_0): CPPFLAGS += -Ibranch/perceptron
-$(d6ee6fa2_branchDperceptron_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
-$(d6ee6fa2_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDperceptron_objs_0)
-module_dirs += $(d6ee6fa2_branchDperceptron_dirs_0)
-module_objs += $(d6ee6fa2_branchDperceptron_objs_0)
+$(f77d9fda_branchDperceptron_objs_0): CPPFLAGS += -Ibranch/perceptron
+$(f77d9fda_branchDperceptron_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDperceptron_objs_0): CPPFLAGS += -include branchDperceptron.inc
+$(f77d9fda_branchDperceptron_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDperceptron_objs_0)
+module_dirs += $(f77d9fda_branchDperceptron_dirs_0)
+module_objs += $(f77d9fda_branchDperceptron_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: branchDtage_sc_l
 # Source: branch/tage_sc_l
-# Destination: .csconfig/test/d6ee6fa2/branchDtage_sc_l
+# Destination: .csconfig/test/f77d9fda/branchDtage_sc_l
 ###
 
-d6ee6fa2_branchDtage_sc_l_dirs_0 = .csconfig/test/d6ee6fa2/branchDtage_sc_l
-d6ee6fa2_branchDtage_sc_l_objs_0 = .csconfig/test/d6ee6fa2/branchDtage_sc_l/tage_sc_l.o
-$(d6ee6fa2_branchDtage_sc_l_objs_0): .csconfig/test/d6ee6fa2/branchDtage_sc_l/%.o: branch/tage_sc_l/%.cc | $(d6ee6fa2_branchDtage_sc_l_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/branchDtage_sc_l/*.d))
+f77d9fda_branchDtage_sc_l_dirs_0 = .csconfig/test/f77d9fda/branchDtage_sc_l
+f77d9fda_branchDtage_sc_l_objs_0 = .csconfig/test/f77d9fda/branchDtage_sc_l/tage_sc_l.o
+$(f77d9fda_branchDtage_sc_l_objs_0): .csconfig/test/f77d9fda/branchDtage_sc_l/%.o: branch/tage_sc_l/%.cc | $(f77d9fda_branchDtage_sc_l_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/branchDtage_sc_l/*.d)
 
-$(d6ee6fa2_branchDtage_sc_l_objs_0): CPPFLAGS += -Ibranch/tage_sc_l
-$(d6ee6fa2_branchDtage_sc_l_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_branchDtage_sc_l_objs_0): CPPFLAGS += -include branchDtage_sc_l.inc
-$(d6ee6fa2_branchDtage_sc_l_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_branchDtage_sc_l_objs_0)
-module_dirs += $(d6ee6fa2_branchDtage_sc_l_dirs_0)
-module_objs += $(d6ee6fa2_branchDtage_sc_l_objs_0)
+$(f77d9fda_branchDtage_sc_l_objs_0): CPPFLAGS += -Ibranch/tage_sc_l
+$(f77d9fda_branchDtage_sc_l_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_branchDtage_sc_l_objs_0): CPPFLAGS += -include branchDtage_sc_l.inc
+$(f77d9fda_branchDtage_sc_l_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_branchDtage_sc_l_objs_0)
+module_dirs += $(f77d9fda_branchDtage_sc_l_dirs_0)
+module_objs += $(f77d9fda_branchDtage_sc_l_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDDHJOLT_instr
 # Source: prefetcher/D-JOLT_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDDHJOLT_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDDHJOLT_instr
 ###
 
-d6ee6fa2_prefetcherDDHJOLT_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDDHJOLT_instr
-d6ee6fa2_prefetcherDDHJOLT_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDDHJOLT_instr/d_jolt.o
-$(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDDHJOLT_instr/%.o: prefetcher/D-JOLT_instr/%.cc | $(d6ee6fa2_prefetcherDDHJOLT_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDDHJOLT_instr/*.d))
+f77d9fda_prefetcherDDHJOLT_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDDHJOLT_instr
+f77d9fda_prefetcherDDHJOLT_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDDHJOLT_instr/d_jolt.o
+$(f77d9fda_prefetcherDDHJOLT_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDDHJOLT_instr/%.o: prefetcher/D-JOLT_instr/%.cc | $(f77d9fda_prefetcherDDHJOLT_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDDHJOLT_instr/*.d)
 
-$(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -Iprefetcher/D-JOLT_instr
-$(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -include prefetcherDDHJOLT_instr.inc
-$(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDDHJOLT_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDDHJOLT_instr_objs_0)
+$(f77d9fda_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -Iprefetcher/D-JOLT_instr
+$(f77d9fda_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDDHJOLT_instr_objs_0): CPPFLAGS += -include prefetcherDDHJOLT_instr.inc
+$(f77d9fda_prefetcherDDHJOLT_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDDHJOLT_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDDHJOLT_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDDHJOLT_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDFNLHMMA_instr
 # Source: prefetcher/FNL-MMA_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDFNLHMMA_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDFNLHMMA_instr
 ###
 
-d6ee6fa2_prefetcherDFNLHMMA_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDFNLHMMA_instr
-d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDFNLHMMA_instr/fnl_mma.o
-$(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDFNLHMMA_instr/%.o: prefetcher/FNL-MMA_instr/%.cc | $(d6ee6fa2_prefetcherDFNLHMMA_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDFNLHMMA_instr/*.d))
+f77d9fda_prefetcherDFNLHMMA_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDFNLHMMA_instr
+f77d9fda_prefetcherDFNLHMMA_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDFNLHMMA_instr/fnl_mma.o
+$(f77d9fda_prefetcherDFNLHMMA_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDFNLHMMA_instr/%.o: prefetcher/FNL-MMA_instr/%.cc | $(f77d9fda_prefetcherDFNLHMMA_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDFNLHMMA_instr/*.d)
 
-$(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -Iprefetcher/FNL-MMA_instr
-$(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -include prefetcherDFNLHMMA_instr.inc
-$(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDFNLHMMA_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDFNLHMMA_instr_objs_0)
+$(f77d9fda_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -Iprefetcher/FNL-MMA_instr
+$(f77d9fda_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDFNLHMMA_instr_objs_0): CPPFLAGS += -include prefetcherDFNLHMMA_instr.inc
+$(f77d9fda_prefetcherDFNLHMMA_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDFNLHMMA_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDFNLHMMA_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDFNLHMMA_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDISCA_Entangling_4Ke_instr
 # Source: prefetcher/ISCA_Entangling_4Ke_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDISCA_Entangling_4Ke_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDISCA_Entangling_4Ke_instr
 ###
 
-d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDISCA_Entangling_4Ke_instr
-d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDISCA_Entangling_4Ke_instr/ISCA_Entangling_4Ke.o
-$(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDISCA_Entangling_4Ke_instr/%.o: prefetcher/ISCA_Entangling_4Ke_instr/%.cc | $(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDISCA_Entangling_4Ke_instr/*.d))
+f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDISCA_Entangling_4Ke_instr
+f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDISCA_Entangling_4Ke_instr/ISCA_Entangling_4Ke.o
+$(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDISCA_Entangling_4Ke_instr/%.o: prefetcher/ISCA_Entangling_4Ke_instr/%.cc | $(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDISCA_Entangling_4Ke_instr/*.d)
 
-$(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -Iprefetcher/ISCA_Entangling_4Ke_instr
-$(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -include prefetcherDISCA_Entangling_4Ke_instr.inc
-$(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
+$(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -Iprefetcher/ISCA_Entangling_4Ke_instr
+$(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CPPFLAGS += -include prefetcherDISCA_Entangling_4Ke_instr.inc
+$(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDISCA_Entangling_4Ke_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
+# Module: prefetcherDfdip_instr
+# Source: prefetcher/fdip_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDfdip_instr
+###
+
+f77d9fda_prefetcherDfdip_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDfdip_instr
+f77d9fda_prefetcherDfdip_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDfdip_instr/fdip.o
+$(f77d9fda_prefetcherDfdip_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDfdip_instr/%.o: prefetcher/fdip_instr/%.cc | $(f77d9fda_prefetcherDfdip_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDfdip_instr/*.d)
+
+$(f77d9fda_prefetcherDfdip_instr_objs_0): CPPFLAGS += -Iprefetcher/fdip_instr
+$(f77d9fda_prefetcherDfdip_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDfdip_instr_objs_0): CPPFLAGS += -include prefetcherDfdip_instr.inc
+$(f77d9fda_prefetcherDfdip_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDfdip_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDfdip_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDfdip_instr_objs_0)
+
+###
+# Build ID: f77d9fda
 # Module: prefetcherDip_stride
 # Source: prefetcher/ip_stride
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDip_stride
+# Destination: .csconfig/test/f77d9fda/prefetcherDip_stride
 ###
 
-d6ee6fa2_prefetcherDip_stride_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDip_stride
-d6ee6fa2_prefetcherDip_stride_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDip_stride/ip_stride.o
-$(d6ee6fa2_prefetcherDip_stride_objs_0): .csconfig/test/d6ee6fa2/prefetcherDip_stride/%.o: prefetcher/ip_stride/%.cc | $(d6ee6fa2_prefetcherDip_stride_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDip_stride/*.d))
+f77d9fda_prefetcherDip_stride_dirs_0 = .csconfig/test/f77d9fda/prefetcherDip_stride
+f77d9fda_prefetcherDip_stride_objs_0 = .csconfig/test/f77d9fda/prefetcherDip_stride/ip_stride.o
+$(f77d9fda_prefetcherDip_stride_objs_0): .csconfig/test/f77d9fda/prefetcherDip_stride/%.o: prefetcher/ip_stride/%.cc | $(f77d9fda_prefetcherDip_stride_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDip_stride/*.d)
 
-$(d6ee6fa2_prefetcherDip_stride_objs_0): CPPFLAGS += -Iprefetcher/ip_stride
-$(d6ee6fa2_prefetcherDip_stride_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
-$(d6ee6fa2_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDip_stride_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDip_stride_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDip_stride_objs_0)
+$(f77d9fda_prefetcherDip_stride_objs_0): CPPFLAGS += -Iprefetcher/ip_stride
+$(f77d9fda_prefetcherDip_stride_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDip_stride_objs_0): CPPFLAGS += -include prefetcherDip_stride.inc
+$(f77d9fda_prefetcherDip_stride_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDip_stride_objs_0)
+module_dirs += $(f77d9fda_prefetcherDip_stride_dirs_0)
+module_objs += $(f77d9fda_prefetcherDip_stride_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDmini_djolt_instr
 # Source: prefetcher/mini_djolt_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDmini_djolt_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDmini_djolt_instr
 ###
 
-d6ee6fa2_prefetcherDmini_djolt_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDmini_djolt_instr
-d6ee6fa2_prefetcherDmini_djolt_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDmini_djolt_instr/mini_djolt.o
-$(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDmini_djolt_instr/%.o: prefetcher/mini_djolt_instr/%.cc | $(d6ee6fa2_prefetcherDmini_djolt_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDmini_djolt_instr/*.d))
+f77d9fda_prefetcherDmini_djolt_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDmini_djolt_instr
+f77d9fda_prefetcherDmini_djolt_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDmini_djolt_instr/mini_djolt.o
+$(f77d9fda_prefetcherDmini_djolt_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDmini_djolt_instr/%.o: prefetcher/mini_djolt_instr/%.cc | $(f77d9fda_prefetcherDmini_djolt_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDmini_djolt_instr/*.d)
 
-$(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -Iprefetcher/mini_djolt_instr
-$(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -include prefetcherDmini_djolt_instr.inc
-$(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDmini_djolt_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDmini_djolt_instr_objs_0)
+$(f77d9fda_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -Iprefetcher/mini_djolt_instr
+$(f77d9fda_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDmini_djolt_instr_objs_0): CPPFLAGS += -include prefetcherDmini_djolt_instr.inc
+$(f77d9fda_prefetcherDmini_djolt_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDmini_djolt_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDmini_djolt_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDmini_djolt_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDnext_line
 # Source: prefetcher/next_line
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDnext_line
+# Destination: .csconfig/test/f77d9fda/prefetcherDnext_line
 ###
 
-d6ee6fa2_prefetcherDnext_line_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDnext_line
-d6ee6fa2_prefetcherDnext_line_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDnext_line/next_line.o
-$(d6ee6fa2_prefetcherDnext_line_objs_0): .csconfig/test/d6ee6fa2/prefetcherDnext_line/%.o: prefetcher/next_line/%.cc | $(d6ee6fa2_prefetcherDnext_line_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDnext_line/*.d))
+f77d9fda_prefetcherDnext_line_dirs_0 = .csconfig/test/f77d9fda/prefetcherDnext_line
+f77d9fda_prefetcherDnext_line_objs_0 = .csconfig/test/f77d9fda/prefetcherDnext_line/next_line.o
+$(f77d9fda_prefetcherDnext_line_objs_0): .csconfig/test/f77d9fda/prefetcherDnext_line/%.o: prefetcher/next_line/%.cc | $(f77d9fda_prefetcherDnext_line_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDnext_line/*.d)
 
-$(d6ee6fa2_prefetcherDnext_line_objs_0): CPPFLAGS += -Iprefetcher/next_line
-$(d6ee6fa2_prefetcherDnext_line_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
-$(d6ee6fa2_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDnext_line_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDnext_line_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDnext_line_objs_0)
+$(f77d9fda_prefetcherDnext_line_objs_0): CPPFLAGS += -Iprefetcher/next_line
+$(f77d9fda_prefetcherDnext_line_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDnext_line_objs_0): CPPFLAGS += -include prefetcherDnext_line.inc
+$(f77d9fda_prefetcherDnext_line_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDnext_line_objs_0)
+module_dirs += $(f77d9fda_prefetcherDnext_line_dirs_0)
+module_objs += $(f77d9fda_prefetcherDnext_line_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDnext_line_instr
 # Source: prefetcher/next_line_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDnext_line_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDnext_line_instr
 ###
 
-d6ee6fa2_prefetcherDnext_line_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDnext_line_instr
-d6ee6fa2_prefetcherDnext_line_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDnext_line_instr/next_line.o
-$(d6ee6fa2_prefetcherDnext_line_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDnext_line_instr/%.o: prefetcher/next_line_instr/%.cc | $(d6ee6fa2_prefetcherDnext_line_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDnext_line_instr/*.d))
+f77d9fda_prefetcherDnext_line_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDnext_line_instr
+f77d9fda_prefetcherDnext_line_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDnext_line_instr/next_line.o
+$(f77d9fda_prefetcherDnext_line_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDnext_line_instr/%.o: prefetcher/next_line_instr/%.cc | $(f77d9fda_prefetcherDnext_line_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDnext_line_instr/*.d)
 
-$(d6ee6fa2_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -Iprefetcher/next_line_instr
-$(d6ee6fa2_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
-$(d6ee6fa2_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDnext_line_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDnext_line_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDnext_line_instr_objs_0)
+$(f77d9fda_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -Iprefetcher/next_line_instr
+$(f77d9fda_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDnext_line_instr_objs_0): CPPFLAGS += -include prefetcherDnext_line_instr.inc
+$(f77d9fda_prefetcherDnext_line_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDnext_line_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDnext_line_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDnext_line_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDno
 # Source: prefetcher/no
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDno
+# Destination: .csconfig/test/f77d9fda/prefetcherDno
 ###
 
-d6ee6fa2_prefetcherDno_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDno
-d6ee6fa2_prefetcherDno_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDno/no.o
-$(d6ee6fa2_prefetcherDno_objs_0): .csconfig/test/d6ee6fa2/prefetcherDno/%.o: prefetcher/no/%.cc | $(d6ee6fa2_prefetcherDno_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDno/*.d))
+f77d9fda_prefetcherDno_dirs_0 = .csconfig/test/f77d9fda/prefetcherDno
+f77d9fda_prefetcherDno_objs_0 = .csconfig/test/f77d9fda/prefetcherDno/no.o
+$(f77d9fda_prefetcherDno_objs_0): .csconfig/test/f77d9fda/prefetcherDno/%.o: prefetcher/no/%.cc | $(f77d9fda_prefetcherDno_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDno/*.d)
 
-$(d6ee6fa2_prefetcherDno_objs_0): CPPFLAGS += -Iprefetcher/no
-$(d6ee6fa2_prefetcherDno_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
-$(d6ee6fa2_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDno_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDno_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDno_objs_0)
+$(f77d9fda_prefetcherDno_objs_0): CPPFLAGS += -Iprefetcher/no
+$(f77d9fda_prefetcherDno_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDno_objs_0): CPPFLAGS += -include prefetcherDno.inc
+$(f77d9fda_prefetcherDno_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDno_objs_0)
+module_dirs += $(f77d9fda_prefetcherDno_dirs_0)
+module_objs += $(f77d9fda_prefetcherDno_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDno_instr
 # Source: prefetcher/no_instr
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDno_instr
+# Destination: .csconfig/test/f77d9fda/prefetcherDno_instr
 ###
 
-d6ee6fa2_prefetcherDno_instr_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDno_instr
-d6ee6fa2_prefetcherDno_instr_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDno_instr/no.o
-$(d6ee6fa2_prefetcherDno_instr_objs_0): .csconfig/test/d6ee6fa2/prefetcherDno_instr/%.o: prefetcher/no_instr/%.cc | $(d6ee6fa2_prefetcherDno_instr_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDno_instr/*.d))
+f77d9fda_prefetcherDno_instr_dirs_0 = .csconfig/test/f77d9fda/prefetcherDno_instr
+f77d9fda_prefetcherDno_instr_objs_0 = .csconfig/test/f77d9fda/prefetcherDno_instr/no.o
+$(f77d9fda_prefetcherDno_instr_objs_0): .csconfig/test/f77d9fda/prefetcherDno_instr/%.o: prefetcher/no_instr/%.cc | $(f77d9fda_prefetcherDno_instr_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDno_instr/*.d)
 
-$(d6ee6fa2_prefetcherDno_instr_objs_0): CPPFLAGS += -Iprefetcher/no_instr
-$(d6ee6fa2_prefetcherDno_instr_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
-$(d6ee6fa2_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDno_instr_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDno_instr_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDno_instr_objs_0)
+$(f77d9fda_prefetcherDno_instr_objs_0): CPPFLAGS += -Iprefetcher/no_instr
+$(f77d9fda_prefetcherDno_instr_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDno_instr_objs_0): CPPFLAGS += -include prefetcherDno_instr.inc
+$(f77d9fda_prefetcherDno_instr_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDno_instr_objs_0)
+module_dirs += $(f77d9fda_prefetcherDno_instr_dirs_0)
+module_objs += $(f77d9fda_prefetcherDno_instr_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDspp_dev
 # Source: prefetcher/spp_dev
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDspp_dev
+# Destination: .csconfig/test/f77d9fda/prefetcherDspp_dev
+###
+
+f77d9fda_prefetcherDspp_dev_dirs_0 = .csconfig/test/f77d9fda/prefetcherDspp_dev
+f77d9fda_prefetcherDspp_dev_objs_0 = .csconfig/test/f77d9fda/prefetcherDspp_dev/spp_dev.o
+$(f77d9fda_prefetcherDspp_dev_objs_0): .csconfig/test/f77d9fda/prefetcherDspp_dev/%.o: prefetcher/spp_dev/%.cc | $(f77d9fda_prefetcherDspp_dev_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDspp_dev/*.d)
+
+$(f77d9fda_prefetcherDspp_dev_objs_0): CPPFLAGS += -Iprefetcher/spp_dev
+$(f77d9fda_prefetcherDspp_dev_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
+$(f77d9fda_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDspp_dev_objs_0)
+module_dirs += $(f77d9fda_prefetcherDspp_dev_dirs_0)
+module_objs += $(f77d9fda_prefetcherDspp_dev_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: prefetcherDstlb_next_page
+# Source: prefetcher/stlb_next_page
+# Destination: .csconfig/test/f77d9fda/prefetcherDstlb_next_page
 ###
 
-d6ee6fa2_prefetcherDspp_dev_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDspp_dev
-d6ee6fa2_prefetcherDspp_dev_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDspp_dev/spp_dev.o
-$(d6ee6fa2_prefetcherDspp_dev_objs_0): .csconfig/test/d6ee6fa2/prefetcherDspp_dev/%.o: prefetcher/spp_dev/%.cc | $(d6ee6fa2_prefetcherDspp_dev_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDspp_dev/*.d))
+f77d9fda_prefetcherDstlb_next_page_dirs_0 = .csconfig/test/f77d9fda/prefetcherDstlb_next_page
+f77d9fda_prefetcherDstlb_next_page_objs_0 = .csconfig/test/f77d9fda/prefetcherDstlb_next_page/stlb_next_page.o
+$(f77d9fda_prefetcherDstlb_next_page_objs_0): .csconfig/test/f77d9fda/prefetcherDstlb_next_page/%.o: prefetcher/stlb_next_page/%.cc | $(f77d9fda_prefetcherDstlb_next_page_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDstlb_next_page/*.d)
 
-$(d6ee6fa2_prefetcherDspp_dev_objs_0): CPPFLAGS += -Iprefetcher/spp_dev
-$(d6ee6fa2_prefetcherDspp_dev_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDspp_dev_objs_0): CPPFLAGS += -include prefetcherDspp_dev.inc
-$(d6ee6fa2_prefetcherDspp_dev_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDspp_dev_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDspp_dev_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDspp_dev_objs_0)
+$(f77d9fda_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -Iprefetcher/stlb_next_page
+$(f77d9fda_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDstlb_next_page_objs_0): CPPFLAGS += -include prefetcherDstlb_next_page.inc
+$(f77d9fda_prefetcherDstlb_next_page_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDstlb_next_page_objs_0)
+module_dirs += $(f77d9fda_prefetcherDstlb_next_page_dirs_0)
+module_objs += $(f77d9fda_prefetcherDstlb_next_page_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: prefetcherDva_ampm_lite
 # Source: prefetcher/va_ampm_lite
-# Destination: .csconfig/test/d6ee6fa2/prefetcherDva_ampm_lite
+# Destination: .csconfig/test/f77d9fda/prefetcherDva_ampm_lite
 ###
 
-d6ee6fa2_prefetcherDva_ampm_lite_dirs_0 = .csconfig/test/d6ee6fa2/prefetcherDva_ampm_lite
-d6ee6fa2_prefetcherDva_ampm_lite_objs_0 = .csconfig/test/d6ee6fa2/prefetcherDva_ampm_lite/va_ampm_lite.o
-$(d6ee6fa2_prefetcherDva_ampm_lite_objs_0): .csconfig/test/d6ee6fa2/prefetcherDva_ampm_lite/%.o: prefetcher/va_ampm_lite/%.cc | $(d6ee6fa2_prefetcherDva_ampm_lite_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/prefetcherDva_ampm_lite/*.d))
+f77d9fda_prefetcherDva_ampm_lite_dirs_0 = .csconfig/test/f77d9fda/prefetcherDva_ampm_lite
+f77d9fda_prefetcherDva_ampm_lite_objs_0 = .csconfig/test/f77d9fda/prefetcherDva_ampm_lite/va_ampm_lite.o
+$(f77d9fda_prefetcherDva_ampm_lite_objs_0): .csconfig/test/f77d9fda/prefetcherDva_ampm_lite/%.o: prefetcher/va_ampm_lite/%.cc | $(f77d9fda_prefetcherDva_ampm_lite_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/prefetcherDva_ampm_lite/*.d)
 
-$(d6ee6fa2_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -Iprefetcher/va_ampm_lite
-$(d6ee6fa2_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
-$(d6ee6fa2_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_prefetcherDva_ampm_lite_objs_0)
-module_dirs += $(d6ee6fa2_prefetcherDva_ampm_lite_dirs_0)
-module_objs += $(d6ee6fa2_prefetcherDva_ampm_lite_objs_0)
+$(f77d9fda_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -Iprefetcher/va_ampm_lite
+$(f77d9fda_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_prefetcherDva_ampm_lite_objs_0): CPPFLAGS += -include prefetcherDva_ampm_lite.inc
+$(f77d9fda_prefetcherDva_ampm_lite_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_prefetcherDva_ampm_lite_objs_0)
+module_dirs += $(f77d9fda_prefetcherDva_ampm_lite_dirs_0)
+module_objs += $(f77d9fda_prefetcherDva_ampm_lite_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDdrrip
 # Source: replacement/drrip
-# Destination: .csconfig/test/d6ee6fa2/replacementDdrrip
+# Destination: .csconfig/test/f77d9fda/replacementDdrrip
+###
+
+f77d9fda_replacementDdrrip_dirs_0 = .csconfig/test/f77d9fda/replacementDdrrip
+f77d9fda_replacementDdrrip_objs_0 = .csconfig/test/f77d9fda/replacementDdrrip/drrip.o
+$(f77d9fda_replacementDdrrip_objs_0): .csconfig/test/f77d9fda/replacementDdrrip/%.o: replacement/drrip/%.cc | $(f77d9fda_replacementDdrrip_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDdrrip/*.d)
+
+$(f77d9fda_replacementDdrrip_objs_0): CPPFLAGS += -Ireplacement/drrip
+$(f77d9fda_replacementDdrrip_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
+$(f77d9fda_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDdrrip_objs_0)
+module_dirs += $(f77d9fda_replacementDdrrip_dirs_0)
+module_objs += $(f77d9fda_replacementDdrrip_objs_0)
+
+###
+# Build ID: f77d9fda
+# Module: replacementDhawkeye
+# Source: replacement/hawkeye
+# Destination: .csconfig/test/f77d9fda/replacementDhawkeye
 ###
 
-d6ee6fa2_replacementDdrrip_dirs_0 = .csconfig/test/d6ee6fa2/replacementDdrrip
-d6ee6fa2_replacementDdrrip_objs_0 = .csconfig/test/d6ee6fa2/replacementDdrrip/drrip.o
-$(d6ee6fa2_replacementDdrrip_objs_0): .csconfig/test/d6ee6fa2/replacementDdrrip/%.o: replacement/drrip/%.cc | $(d6ee6fa2_replacementDdrrip_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDdrrip/*.d))
+f77d9fda_replacementDhawkeye_dirs_0 = .csconfig/test/f77d9fda/replacementDhawkeye
+f77d9fda_replacementDhawkeye_objs_0 = .csconfig/test/f77d9fda/replacementDhawkeye/hawkeye.o
+$(f77d9fda_replacementDhawkeye_objs_0): .csconfig/test/f77d9fda/replacementDhawkeye/%.o: replacement/hawkeye/%.cc | $(f77d9fda_replacementDhawkeye_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDhawkeye/*.d)
 
-$(d6ee6fa2_replacementDdrrip_objs_0): CPPFLAGS += -Ireplacement/drrip
-$(d6ee6fa2_replacementDdrrip_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDdrrip_objs_0): CPPFLAGS += -include replacementDdrrip.inc
-$(d6ee6fa2_replacementDdrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDdrrip_objs_0)
-module_dirs += $(d6ee6fa2_replacementDdrrip_dirs_0)
-module_objs += $(d6ee6fa2_replacementDdrrip_objs_0)
+$(f77d9fda_replacementDhawkeye_objs_0): CPPFLAGS += -Ireplacement/hawkeye
+$(f77d9fda_replacementDhawkeye_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDhawkeye_objs_0): CPPFLAGS += -include replacementDhawkeye.inc
+$(f77d9fda_replacementDhawkeye_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDhawkeye_objs_0)
+module_dirs += $(f77d9fda_replacementDhawkeye_dirs_0)
+module_objs += $(f77d9fda_replacementDhawkeye_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDhotloop
 # Source: replacement/hotloop
-# Destination: .csconfig/test/d6ee6fa2/replacementDhotloop
+# Destination: .csconfig/test/f77d9fda/replacementDhotloop
 ###
 
-d6ee6fa2_replacementDhotloop_dirs_0 = .csconfig/test/d6ee6fa2/replacementDhotloop
-d6ee6fa2_replacementDhotloop_objs_0 = .csconfig/test/d6ee6fa2/replacementDhotloop/hotloop.o
-$(d6ee6fa2_replacementDhotloop_objs_0): .csconfig/test/d6ee6fa2/replacementDhotloop/%.o: replacement/hotloop/%.cc | $(d6ee6fa2_replacementDhotloop_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDhotloop/*.d))
+f77d9fda_replacementDhotloop_dirs_0 = .csconfig/test/f77d9fda/replacementDhotloop
+f77d9fda_replacementDhotloop_objs_0 = .csconfig/test/f77d9fda/replacementDhotloop/hotloop.o
+$(f77d9fda_replacementDhotloop_objs_0): .csconfig/test/f77d9fda/replacementDhotloop/%.o: replacement/hotloop/%.cc | $(f77d9fda_replacementDhotloop_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDhotloop/*.d)
 
-$(d6ee6fa2_replacementDhotloop_objs_0): CPPFLAGS += -Ireplacement/hotloop
-$(d6ee6fa2_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDhotloop_objs_0): CPPFLAGS += -include replacementDhotloop.inc
-$(d6ee6fa2_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDhotloop_objs_0)
-module_dirs += $(d6ee6fa2_replacementDhotloop_dirs_0)
-module_objs += $(d6ee6fa2_replacementDhotloop_objs_0)
+$(f77d9fda_replacementDhotloop_objs_0): CPPFLAGS += -Ireplacement/hotloop
+$(f77d9fda_replacementDhotloop_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDhotloop_objs_0): CPPFLAGS += -include replacementDhotloop.inc
+$(f77d9fda_replacementDhotloop_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDhotloop_objs_0)
+module_dirs += $(f77d9fda_replacementDhotloop_dirs_0)
+module_objs += $(f77d9fda_replacementDhotloop_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDhotloop_lru
 # Source: replacement/hotloop_lru
-# Destination: .csconfig/test/d6ee6fa2/replacementDhotloop_lru
+# Destination: .csconfig/test/f77d9fda/replacementDhotloop_lru
 ###
 
-d6ee6fa2_replacementDhotloop_lru_dirs_0 = .csconfig/test/d6ee6fa2/replacementDhotloop_lru
-d6ee6fa2_replacementDhotloop_lru_objs_0 = .csconfig/test/d6ee6fa2/replacementDhotloop_lru/hotloop_lru.o
-$(d6ee6fa2_replacementDhotloop_lru_objs_0): .csconfig/test/d6ee6fa2/replacementDhotloop_lru/%.o: replacement/hotloop_lru/%.cc | $(d6ee6fa2_replacementDhotloop_lru_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDhotloop_lru/*.d))
+f77d9fda_replacementDhotloop_lru_dirs_0 = .csconfig/test/f77d9fda/replacementDhotloop_lru
+f77d9fda_replacementDhotloop_lru_objs_0 = .csconfig/test/f77d9fda/replacementDhotloop_lru/hotloop_lru.o
+$(f77d9fda_replacementDhotloop_lru_objs_0): .csconfig/test/f77d9fda/replacementDhotloop_lru/%.o: replacement/hotloop_lru/%.cc | $(f77d9fda_replacementDhotloop_lru_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDhotloop_lru/*.d)
 
-$(d6ee6fa2_replacementDhotloop_lru_objs_0): CPPFLAGS += -Ireplacement/hotloop_lru
-$(d6ee6fa2_replacementDhotloop_lru_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDhotloop_lru_objs_0): CPPFLAGS += -include replacementDhotloop_lru.inc
-$(d6ee6fa2_replacementDhotloop_lru_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDhotloop_lru_objs_0)
-module_dirs += $(d6ee6fa2_replacementDhotloop_lru_dirs_0)
-module_objs += $(d6ee6fa2_replacementDhotloop_lru_objs_0)
+$(f77d9fda_replacementDhotloop_lru_objs_0): CPPFLAGS += -Ireplacement/hotloop_lru
+$(f77d9fda_replacementDhotloop_lru_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDhotloop_lru_objs_0): CPPFLAGS += -include replacementDhotloop_lru.inc
+$(f77d9fda_replacementDhotloop_lru_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDhotloop_lru_objs_0)
+module_dirs += $(f77d9fda_replacementDhotloop_lru_dirs_0)
+module_objs += $(f77d9fda_replacementDhotloop_lru_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDlru
 # Source: replacement/lru
-# Destination: .csconfig/test/d6ee6fa2/replacementDlru
+# Destination: .csconfig/test/f77d9fda/replacementDlru
 ###
 
-d6ee6fa2_replacementDlru_dirs_0 = .csconfig/test/d6ee6fa2/replacementDlru
-d6ee6fa2_replacementDlru_objs_0 = .csconfig/test/d6ee6fa2/replacementDlru/lru.o
-$(d6ee6fa2_replacementDlru_objs_0): .csconfig/test/d6ee6fa2/replacementDlru/%.o: replacement/lru/%.cc | $(d6ee6fa2_replacementDlru_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDlru/*.d))
+f77d9fda_replacementDlru_dirs_0 = .csconfig/test/f77d9fda/replacementDlru
+f77d9fda_replacementDlru_objs_0 = .csconfig/test/f77d9fda/replacementDlru/lru.o
+$(f77d9fda_replacementDlru_objs_0): .csconfig/test/f77d9fda/replacementDlru/%.o: replacement/lru/%.cc | $(f77d9fda_replacementDlru_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDlru/*.d)
 
-$(d6ee6fa2_replacementDlru_objs_0): CPPFLAGS += -Ireplacement/lru
-$(d6ee6fa2_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
-$(d6ee6fa2_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDlru_objs_0)
-module_dirs += $(d6ee6fa2_replacementDlru_dirs_0)
-module_objs += $(d6ee6fa2_replacementDlru_objs_0)
+$(f77d9fda_replacementDlru_objs_0): CPPFLAGS += -Ireplacement/lru
+$(f77d9fda_replacementDlru_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDlru_objs_0): CPPFLAGS += -include replacementDlru.inc
+$(f77d9fda_replacementDlru_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDlru_objs_0)
+module_dirs += $(f77d9fda_replacementDlru_dirs_0)
+module_objs += $(f77d9fda_replacementDlru_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDship
 # Source: replacement/ship
-# Destination: .csconfig/test/d6ee6fa2/replacementDship
+# Destination: .csconfig/test/f77d9fda/replacementDship
 ###
 
-d6ee6fa2_replacementDship_dirs_0 = .csconfig/test/d6ee6fa2/replacementDship
-d6ee6fa2_replacementDship_objs_0 = .csconfig/test/d6ee6fa2/replacementDship/ship.o
-$(d6ee6fa2_replacementDship_objs_0): .csconfig/test/d6ee6fa2/replacementDship/%.o: replacement/ship/%.cc | $(d6ee6fa2_replacementDship_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDship/*.d))
+f77d9fda_replacementDship_dirs_0 = .csconfig/test/f77d9fda/replacementDship
+f77d9fda_replacementDship_objs_0 = .csconfig/test/f77d9fda/replacementDship/ship.o
+$(f77d9fda_replacementDship_objs_0): .csconfig/test/f77d9fda/replacementDship/%.o: replacement/ship/%.cc | $(f77d9fda_replacementDship_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDship/*.d)
 
-$(d6ee6fa2_replacementDship_objs_0): CPPFLAGS += -Ireplacement/ship
-$(d6ee6fa2_replacementDship_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
-$(d6ee6fa2_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDship_objs_0)
-module_dirs += $(d6ee6fa2_replacementDship_dirs_0)
-module_objs += $(d6ee6fa2_replacementDship_objs_0)
+$(f77d9fda_replacementDship_objs_0): CPPFLAGS += -Ireplacement/ship
+$(f77d9fda_replacementDship_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDship_objs_0): CPPFLAGS += -include replacementDship.inc
+$(f77d9fda_replacementDship_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDship_objs_0)
+module_dirs += $(f77d9fda_replacementDship_dirs_0)
+module_objs += $(f77d9fda_replacementDship_objs_0)
 
 ###
-# Build ID: d6ee6fa2
+# Build ID: f77d9fda
 # Module: replacementDsrrip
 # Source: replacement/srrip
-# Destination: .csconfig/test/d6ee6fa2/replacementDsrrip
+# Destination: .csconfig/test/f77d9fda/replacementDsrrip
 ###
 
-d6ee6fa2_replacementDsrrip_dirs_0 = .csconfig/test/d6ee6fa2/replacementDsrrip
-d6ee6fa2_replacementDsrrip_objs_0 = .csconfig/test/d6ee6fa2/replacementDsrrip/srrip.o
-$(d6ee6fa2_replacementDsrrip_objs_0): .csconfig/test/d6ee6fa2/replacementDsrrip/%.o: replacement/srrip/%.cc | $(d6ee6fa2_replacementDsrrip_dirs_0)
--include $(wildcard .csconfig/test/d6ee6fa2/replacementDsrrip/*.d))
+f77d9fda_replacementDsrrip_dirs_0 = .csconfig/test/f77d9fda/replacementDsrrip
+f77d9fda_replacementDsrrip_objs_0 = .csconfig/test/f77d9fda/replacementDsrrip/srrip.o
+$(f77d9fda_replacementDsrrip_objs_0): .csconfig/test/f77d9fda/replacementDsrrip/%.o: replacement/srrip/%.cc | $(f77d9fda_replacementDsrrip_dirs_0)
+-include $(wildcard .csconfig/test/f77d9fda/replacementDsrrip/*.d)
 
-$(d6ee6fa2_replacementDsrrip_objs_0): CPPFLAGS += -Ireplacement/srrip
-$(d6ee6fa2_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/test/d6ee6fa2/inc
-$(d6ee6fa2_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
-$(d6ee6fa2_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
-test/bin/000-test-main: $(d6ee6fa2_replacementDsrrip_objs_0)
-module_dirs += $(d6ee6fa2_replacementDsrrip_dirs_0)
-module_objs += $(d6ee6fa2_replacementDsrrip_objs_0)
\ No newline at end of file
+$(f77d9fda_replacementDsrrip_objs_0): CPPFLAGS += -Ireplacement/srrip
+$(f77d9fda_replacementDsrrip_objs_0): CPPFLAGS += -I.csconfig/test/f77d9fda/inc
+$(f77d9fda_replacementDsrrip_objs_0): CPPFLAGS += -include replacementDsrrip.inc
+$(f77d9fda_replacementDsrrip_objs_0): CXXFLAGS += -Wno-unused-parameter
+test/bin/000-test-main: $(f77d9fda_replacementDsrrip_objs_0)
+module_dirs += $(f77d9fda_replacementDsrrip_dirs_0)
+module_objs += $(f77d9fda_replacementDsrrip_objs_0)
\ No newline at end of file
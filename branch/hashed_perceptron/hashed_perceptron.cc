@@ -50,37 +50,17 @@ sources for you to plagiarize.
 #include <stdlib.h>
 #include <string.h>
 
+#include "hashed_perceptron_kernel.h"
 #include "ooo_cpu.h"
 
-// this many tables
-
-#define NTABLES 16
-
-// maximum history length
-
-#define MAXHIST 232
-
-// minimum history length (for table 1; table 0 is biases)
-
-#define MINHIST 3
+// the table configuration (number of tables, geometric history lengths, table size) and the SIMD kernels
+// for indexing, summing and training live in hashed_perceptron_kernel.h
+using namespace hashed_perceptron;
 
 // speed for dynamic threshold setting
 
 #define SPEED 18
 
-// geometric global history lengths
-
-int history_lengths[NTABLES] = { 0, 3, 4, 6, 8, 10, 14, 19, 26, 36, 49, 67, 91, 125, 170, MAXHIST };
-
-// 12-bit indices for the tables
-
-#define LOG_TABLE_SIZE 12
-#define TABLE_SIZE (1 << LOG_TABLE_SIZE)
-
-// this many 12-bit words will be kept in the global history
-
-#define NGHIST_WORDS (MAXHIST / LOG_TABLE_SIZE + 1)
-
 // tables of 8-bit weights
 
 int tables[NUM_CPUS][NTABLES][TABLE_SIZE];
@@ -123,59 +103,14 @@ std::pair<uint8_t, extra_branch_info> O3_CPU::predict_branch(uint64_t pc, uint8_
 
   extra_branch_info br_info;
 
-  // initialize perceptron sum
-
-  yout[cpu] = 0;
-
-  // for each table...
-
-  for (int i = 0; i < NTABLES; i++) {
-
-    // n is the history length for this table
-
-    int n = history_lengths[i];
-
-    // hash global history bits 0..n-1 into x by XORing the words from the
-    // ghist_words array
-
-    uint64_t x = 0;
+  // for each table hash global history bits 0..n-1 with the PC (like gshare) and remember the index for update
 
-    // most of the words are 12 bits long
+  compute_indices(ghist_words[cpu], pc, indices[cpu]);
 
-    int most_words = n / LOG_TABLE_SIZE;
+  // add the selected weights to the perceptron sum
 
-    // the last word is fewer than 12 bits
+  yout[cpu] = hashed_perceptron::sum(tables[cpu], indices[cpu]);
 
-    int last_word = n % LOG_TABLE_SIZE;
-
-    // XOR up to the next-to-the-last word
-
-    int j;
-    for (j = 0; j < most_words; j++)
-      x ^= ghist_words[cpu][j];
-
-    // XOR in the last word
-
-    x ^= ghist_words[cpu][j] & ((1 << last_word) - 1);
-
-    // XOR in the PC to spread accesses around (like gshare)
-
-    x ^= pc;
-
-    // stay within the table size
-
-    x &= TABLE_SIZE - 1;
-
-    // remember this index for update
-    // if (pc == 0xffffa80824c0) {
-    //   cout << "X " << x << " i " << i << endl;
-    // }
-    indices[cpu][i] = x;
-
-    // add the selected weight to the perceptron sum
-
-    yout[cpu] += tables[cpu][i][x];
-  }
   // if (level == 1)
   //std::cout << "Predict Branch " << level << "  ip " << std::hex << pc << " taken " << std::dec << (yout[cpu] >= 1) << std::endl;
   return { yout[cpu] >= 1,br_info };
@@ -211,22 +146,9 @@ void O3_CPU::last_branch_result(uint64_t pc, uint64_t branch_target, uint8_t tak
   // perceptron learning rule: train if misprediction or weak correct prediction
 
   if (!correct || a < theta[cpu]) {
-    // update weights
-    for (int i = 0; i < NTABLES; i++) {
-      // which weight did we use to compute yout?
+    // update the weights used to compute yout, increment if taken, decrement if not, saturating at 127/-128
 
-      int* c = &tables[cpu][i][indices[cpu][i]];
-
-      // increment if taken, decrement if not, saturating at 127/-128
-
-      if (taken) {
-        if (*c < 127)
-          (*c)++;
-      } else {
-        if (*c > -128)
-          (*c)--;
-      }
-    }
+    hashed_perceptron::train(tables[cpu], indices[cpu], taken);
 
     // dynamic threshold setting from Seznec's O-GEHL paper
 
@@ -256,6 +178,7 @@ void O3_CPU::br_speculative_begin(uint64_t ip, uint64_t branch_target, uint8_t t
 }
 
 int O3_CPU::save_histogram(uint64_t pc, uint8_t level) {
+  return 0;
 }
 
 void O3_CPU::br_speculative_end() {
@@ -263,4 +186,4 @@ void O3_CPU::br_speculative_end() {
 
 int O3_CPU::get_yout(uint64_t pc, uint8_t level) {
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,177 @@
+#ifndef HASHED_PERCEPTRON_KERNEL_H
+#define HASHED_PERCEPTRON_KERNEL_H
+
+/*
+ * Compute kernels of the hashed perceptron: table indexing, perceptron sum and the saturating weight update.
+ * The table configuration is constexpr so the per-table loops are fully unrolled. With AVX2/AVX-512 the
+ * weights of all tables are gathered and summed in vector registers. Integer sums are exact, so every
+ * path gives the same result as the scalar one (define HP_SCALAR_KERNEL to force the scalar path).
+ */
+
+#include <array>
+#include <cstdint>
+
+#if !defined(HP_SCALAR_KERNEL) && (defined(__AVX2__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+namespace hashed_perceptron
+{
+// this many tables
+constexpr int NTABLES = 16;
+
+// maximum history length
+constexpr int MAXHIST = 232;
+
+// geometric global history lengths (table 0 is biases)
+constexpr std::array<int, NTABLES> history_lengths{0, 3, 4, 6, 8, 10, 14, 19, 26, 36, 49, 67, 91, 125, 170, MAXHIST};
+
+// 12-bit indices for the tables
+constexpr int LOG_TABLE_SIZE = 12;
+constexpr int TABLE_SIZE = 1 << LOG_TABLE_SIZE;
+
+// this many 12-bit words will be kept in the global history
+constexpr int NGHIST_WORDS = MAXHIST / LOG_TABLE_SIZE + 1;
+
+// weights saturate at 8 bits
+constexpr int WEIGHT_MAX = 127;
+constexpr int WEIGHT_MIN = -128;
+
+using weight_tables = int[NTABLES][TABLE_SIZE];
+
+// table i hashes words [0, full_words[i]) and the low history_lengths[i] % LOG_TABLE_SIZE bits of the next one
+constexpr auto full_words = [] {
+  std::array<int, NTABLES> words{};
+  for (int i = 0; i < NTABLES; i++)
+    words[i] = history_lengths[i] / LOG_TABLE_SIZE;
+  return words;
+}();
+
+constexpr auto last_word_mask = [] {
+  std::array<unsigned, NTABLES> masks{};
+  for (int i = 0; i < NTABLES; i++)
+    masks[i] = (1u << (history_lengths[i] % LOG_TABLE_SIZE)) - 1;
+  return masks;
+}();
+
+static_assert(full_words[NTABLES - 1] < NGHIST_WORDS, "history does not fit in the global history words");
+
+// indices[i] = (XOR of the hashed history of table i) ^ pc, within the table size
+inline void compute_indices(const unsigned int* ghist_words, uint64_t pc, uint64_t* indices)
+{
+  // prefix[j] is the XOR of words 0..j-1, every table then needs one lookup instead of a loop over its words
+  std::array<unsigned, NGHIST_WORDS + 1> prefix{};
+  for (int j = 0; j < NGHIST_WORDS; j++)
+    prefix[j + 1] = prefix[j] ^ ghist_words[j];
+
+  for (int i = 0; i < NTABLES; i++) {
+    uint64_t x = prefix[full_words[i]] ^ (ghist_words[full_words[i]] & last_word_mask[i]);
+    indices[i] = (x ^ pc) & (TABLE_SIZE - 1);
+  }
+}
+
+inline int sum_scalar(const weight_tables& tables, const uint64_t* indices)
+{
+  int yout = 0;
+  for (int i = 0; i < NTABLES; i++)
+    yout += tables[i][indices[i]];
+  return yout;
+}
+
+inline void train_scalar(weight_tables& tables, const uint64_t* indices, bool taken)
+{
+  for (int i = 0; i < NTABLES; i++) {
+    int* c = &tables[i][indices[i]];
+    // increment if taken, decrement if not, saturating at 127/-128
+    if (taken) {
+      if (*c < WEIGHT_MAX)
+        (*c)++;
+    } else {
+      if (*c > WEIGHT_MIN)
+        (*c)--;
+    }
+  }
+}
+
+#if !defined(HP_SCALAR_KERNEL) && defined(__AVX512F__)
+static_assert(NTABLES == 16, "AVX-512 kernel handles the 16 tables in one register");
+
+// flat offsets of the used weights, i * TABLE_SIZE + indices[i]
+inline __m512i flat_offsets(const uint64_t* indices)
+{
+  alignas(64) int32_t offsets[NTABLES];
+  for (int i = 0; i < NTABLES; i++)
+    offsets[i] = i * TABLE_SIZE + static_cast<int32_t>(indices[i]);
+  return _mm512_load_si512(offsets);
+}
+
+inline int sum(const weight_tables& tables, const uint64_t* indices)
+{
+  __m512i w = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xffff, flat_offsets(indices), &tables[0][0], sizeof(int));
+  __m256i half = _mm256_add_epi32(_mm512_maskz_extracti64x4_epi64(0xf, w, 0), _mm512_maskz_extracti64x4_epi64(0xf, w, 1));
+  __m128i s = _mm_add_epi32(_mm256_castsi256_si128(half), _mm256_extracti128_si256(half, 1));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(s);
+}
+
+inline void train(weight_tables& tables, const uint64_t* indices, bool taken)
+{
+  __m512i offsets = flat_offsets(indices);
+  __m512i w = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xffff, offsets, &tables[0][0], sizeof(int));
+  w = _mm512_add_epi32(w, _mm512_set1_epi32(taken ? 1 : -1));
+  w = _mm512_maskz_min_epi32(0xffff, _mm512_maskz_max_epi32(0xffff, w, _mm512_set1_epi32(WEIGHT_MIN)), _mm512_set1_epi32(WEIGHT_MAX));
+  // every table contributes one weight so the scatter has no conflicts
+  _mm512_i32scatter_epi32(&tables[0][0], offsets, w, sizeof(int));
+}
+
+#elif !defined(HP_SCALAR_KERNEL) && defined(__AVX2__)
+static_assert(NTABLES % 8 == 0, "AVX2 kernel handles the tables 8 at a time");
+
+inline __m256i flat_offsets(const uint64_t* indices, int first_table)
+{
+  const __m256i table_base = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(TABLE_SIZE));
+  // narrow the 64-bit indices to 32 bits, they are below TABLE_SIZE
+  const __m256i pick_low = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  __m256i lo = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + first_table)), pick_low);
+  __m256i hi = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + first_table + 4)), pick_low);
+  __m256i idx = _mm256_permute2x128_si256(lo, hi, 0x20);
+  return _mm256_add_epi32(_mm256_add_epi32(table_base, _mm256_set1_epi32(first_table * TABLE_SIZE)), idx);
+}
+
+inline int sum(const weight_tables& tables, const uint64_t* indices)
+{
+  __m256i acc = _mm256_setzero_si256();
+  for (int i = 0; i < NTABLES; i += 8)
+    acc = _mm256_add_epi32(acc, _mm256_i32gather_epi32(&tables[0][0], flat_offsets(indices, i), sizeof(int)));
+  __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(s);
+}
+
+inline void train(weight_tables& tables, const uint64_t* indices, bool taken)
+{
+  const __m256i delta = _mm256_set1_epi32(taken ? 1 : -1);
+  const __m256i lo_sat = _mm256_set1_epi32(WEIGHT_MIN);
+  const __m256i hi_sat = _mm256_set1_epi32(WEIGHT_MAX);
+  for (int i = 0; i < NTABLES; i += 8) {
+    __m256i w = _mm256_i32gather_epi32(&tables[0][0], flat_offsets(indices, i), sizeof(int));
+    w = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(w, delta), lo_sat), hi_sat);
+    // no scatter in AVX2
+    alignas(32) int updated[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(updated), w);
+    for (int j = 0; j < 8; j++)
+      tables[i + j][indices[i + j]] = updated[j];
+  }
+}
+
+#else
+
+inline int sum(const weight_tables& tables, const uint64_t* indices) { return sum_scalar(tables, indices); }
+inline void train(weight_tables& tables, const uint64_t* indices, bool taken) { train_scalar(tables, indices, taken); }
+
+#endif
+} // namespace hashed_perceptron
+
+#endif
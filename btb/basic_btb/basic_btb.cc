@@ -34,6 +34,7 @@ namespace
     uint64_t ip_tag = 0;
     uint64_t target = 0;
     branch_info type = branch_info::ALWAYS_TAKEN;
+    uint8_t branch_type = NOT_BRANCH;
 
     auto index() const {
       return ip_tag >> 2;
@@ -136,12 +137,13 @@ void O3_CPU::update_btb(uint64_t ip, uint64_t branch_target, uint8_t taken, uint
   auto opt_entry = ::BTB.at(this).check_hit({ ip, branch_target, type });
   if (opt_entry.has_value()) {
     opt_entry->type = type;
+    opt_entry->branch_type = branch_type;
     if (branch_target != 0)
       opt_entry->target = branch_target;
   }
 
   if (branch_target != 0) {
-    ::BTB.at(this).fill(opt_entry.value_or(::btb_entry_t{ ip, branch_target, type }));
+    ::BTB.at(this).fill(opt_entry.value_or(::btb_entry_t{ ip, branch_target, type, branch_type }));
   }
 }
 void O3_CPU::update_bb_size(uint64_t ip, uint8_t level, uint64_t bb_size, bool taken, uint8_t branch_type, uint64_t branch_history)
@@ -151,7 +153,7 @@ void O3_CPU::update_bb_size(uint64_t ip, uint8_t level, uint64_t bb_size, bool t
 
 std::pair<uint64_t, uint64_t> O3_CPU::btb_bb_size(uint64_t ip, uint8_t level)
 {
-
+  return std::pair{0, 0};
 }
 
 void O3_CPU::speculative_begin(uint64_t ip, uint64_t branch_target, uint8_t taken, uint8_t branch_type, bool alt_path)
@@ -164,8 +166,11 @@ void O3_CPU::speculative_end()
 }
 uint8_t O3_CPU::get_branch_type(uint64_t ip)
 {
-
+  // tag-only probe of the fetch block predictor, the LRU state is not updated
+  auto btb_entry = ::BTB.at(this).peek({ ip, 0, ::branch_info::ALWAYS_TAKEN });
+  return btb_entry.has_value() ? btb_entry->branch_type : static_cast<uint8_t>(NOT_BRANCH);
 }
 uint8_t O3_CPU::get_type(uint64_t ip)
 {
+  return NOT_BRANCH;
 }
\ No newline at end of file
@@ -53,7 +53,7 @@ void O3_CPU::update_bb_size(uint64_t ip, uint8_t level, uint64_t bb_size, bool t
 }
 std::pair<uint64_t, uint64_t> O3_CPU::btb_bb_size(uint64_t ip, uint8_t level)
 {
-
+  return std::pair{0, 0};
 }
 void O3_CPU::speculative_begin(uint64_t ip, uint64_t branch_target, uint8_t taken, uint8_t branch_type, bool alt_path)
 {
@@ -65,8 +65,9 @@ void O3_CPU::speculative_end()
 }
 uint8_t O3_CPU::get_branch_type(uint64_t ip)
 {
-
+  return btb[cpu].get_branch_type(ip);
 }
 uint8_t O3_CPU::get_type(uint64_t ip)
 {
+  return NOT_BRANCH;
 }
\ No newline at end of file
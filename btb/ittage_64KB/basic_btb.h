@@ -15,6 +15,7 @@ private:
     uint64_t ip_tag;
     uint64_t target;
     uint8_t branch_info;
+    uint8_t branch_type;
     uint64_t lru;
   };
 
@@ -59,6 +60,7 @@ public:
         basic_btb[i][j].ip_tag = 0;
         basic_btb[i][j].target = 0;
         basic_btb[i][j].branch_info = BRANCH_INFO_ALWAYS_TAKEN;
+        basic_btb[i][j].branch_type = NOT_BRANCH;
         basic_btb[i][j].lru = 0;
       }
     }
@@ -75,6 +77,14 @@ public:
     return std::make_pair(btb_entry->target, btb_entry->branch_info);
   }
 
+  uint8_t get_branch_type(uint64_t ip) {
+    auto btb_entry = find_entry(ip);
+    if (btb_entry == NULL) {
+      return NOT_BRANCH;
+    }
+    return btb_entry->branch_type;
+  }
+
   void update(uint64_t ip, uint64_t branch_target, uint8_t taken, uint8_t branch_type) {
     auto btb_entry = find_entry(ip);
     if (btb_entry == NULL) {
@@ -86,10 +96,12 @@ public:
       btb_entry = get_lru_entry(set);
       btb_entry->ip_tag = ip;
       btb_entry->branch_info = BRANCH_INFO_ALWAYS_TAKEN;
+      btb_entry->branch_type = NOT_BRANCH;
       update_lru(btb_entry);
     }
     // update btb entry
     if (branch_target != 0) btb_entry->target = branch_target;
+    if (branch_type != NOT_BRANCH) btb_entry->branch_type = branch_type;
     if ((branch_type == BRANCH_INDIRECT) || (branch_type == BRANCH_INDIRECT_CALL)) {
       btb_entry->branch_info = BRANCH_INFO_INDIRECT;
     } else if (branch_type == BRANCH_RETURN) {
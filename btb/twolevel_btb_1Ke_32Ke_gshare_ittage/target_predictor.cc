@@ -129,24 +129,11 @@ void O3_CPU::update_btb(uint64_t ip, uint64_t branch_target, uint8_t taken, uint
 
 void O3_CPU::update_bb_size(uint64_t ip, uint8_t level, uint64_t bb_size, bool taken, uint8_t branch_type, uint64_t branch_history)
 {
-  // //cout << __func__ << " ip " << ip << endl;
-  // l2_btb[cpu].m_update_bb_size(ip, bb_size, taken);
-  // l2_ind[cpu].m_update_bb_size(ip, bb_size, branch_type, taken, branch_history);
+  // the size of the block that follows the branch in each direction, used to predict whole fetch blocks
+  m_btb[cpu].m_update_bb_size(ip, bb_size, taken);
 }
 
-std::pair<uint64_t, uint64_t> O3_CPU::btb_bb_size(uint64_t ip, uint8_t level)
-{
-  // auto btb_pred = l2_btb[cpu].predict(ip);
-  // if (btb_pred.second == BRANCH_INFO_INDIRECT) {
-  //   if (speculate_state)
-  //     return spec_l2_ind[cpu].get_bb_size(ip);
-  //   else
-  //     return l2_ind[cpu].get_bb_size(ip);
-  // } else {
-  //   return l2_btb[cpu].get_bb_size(ip);
-  // }
-  return std::pair{0, 0};
-}
+std::pair<uint64_t, uint64_t> O3_CPU::btb_bb_size(uint64_t ip, uint8_t level) { return m_btb[cpu].get_bb_size(ip); }
 
 void O3_CPU::speculative_begin(uint64_t ip, uint64_t branch_target, uint8_t taken, uint8_t branch_type, bool alt_path)
 {
@@ -167,6 +154,6 @@ void O3_CPU::speculative_end()
   h2p_ras->speculative_end();
 }
 
-uint8_t O3_CPU::get_branch_type(uint64_t ip) { return m_btb->get_branch_type(ip); }
+uint8_t O3_CPU::get_branch_type(uint64_t ip) { return m_btb[cpu].get_branch_type(ip); }
 
-uint8_t O3_CPU::get_type(uint64_t ip) {}
+uint8_t O3_CPU::get_type(uint64_t ip) { return m_btb[cpu].get_branch_type(ip); }
@@ -4,7 +4,7 @@ for bin in "real_br_with_pref" #"base" #"base" #"ideal_uop" #"base" #"real_br_wi
 do
     for l1i_pref_training in "at_try_hit" #"at_ftq"
     do
-        for l1i_pref in "no_instr" #"ISCA_Entangling_4Ke_instr" "FNL-MMA_instr" "D-JOLT_instr" #"no_instr" #"ISCA_Entangling_4Ke_instr" #"FNL-MMA_instr" #"D-JOLT_instr" #"no_instr" #"ISCA_Entangling_4Ke_instr" #"no_instr" "FNL-MMA_instr" #"next_line_instr" "D-JOLT_instr" "mini_djolt_instr" "ISCA_Entangling_4Ke_instr" "FNL-MMA_instr" #"ISCA_Entangling_4Ke_instr" #"D-JOLT_instr" "next_line_instr"  #"no_instr"
+        for l1i_pref in "no_instr" #"fdip_instr" #"ISCA_Entangling_4Ke_instr" "FNL-MMA_instr" "D-JOLT_instr" #"no_instr" #"ISCA_Entangling_4Ke_instr" #"FNL-MMA_instr" #"D-JOLT_instr" #"no_instr" #"ISCA_Entangling_4Ke_instr" #"no_instr" "FNL-MMA_instr" #"next_line_instr" "D-JOLT_instr" "mini_djolt_instr" "ISCA_Entangling_4Ke_instr" "FNL-MMA_instr" #"ISCA_Entangling_4Ke_instr" #"D-JOLT_instr" "next_line_instr"  #"no_instr"
         do
             for h2p_indirect_size in "4KB_ITTAGE" #"8KB_ITTAGE" #"16KB_ITTAGE" "32KB_ITTAGE" "64KB_ITTAGE" #"8KB_ITTAGE" "4KB_ITTAGE" #"1KB" #"2KB" "3KB" #"4KB" "5KB" "6KB"  #"1KB" "2KB" "3KB" "4KB" "5KB" "6KB" "7KB"
             do
@@ -68,6 +68,34 @@ do
                                                             echo "#define BTB_BANKS 32" >> inc/defines.h
                                                             echo "#define BTB_CONF_PROB ${btb_probability}" >> inc/defines.h
                                                             
+                                                            #feedback throttling of the alternate path prefetches (depth, per branch enable and insertion priority)
+                                                            #echo "#define UOP_PREF_THROTTLE" >> inc/defines.h
+
+                                                            #FDIP (L1I prefetcher fdip_instr): FTQ entries scanned ahead of fetch, the first ones fill the L1I, the others only the L2
+                                                            echo "#define FDIP_LOOKAHEAD 192" >> inc/defines.h
+                                                            echo "#define FDIP_L1I_DISTANCE 64" >> inc/defines.h
+                                                            echo "#define FDIP_BANDWIDTH 2" >> inc/defines.h
+
+                                                            #L1I prefetch filter shared with the uop cache prefetcher: drops the L1I prefetches of lines requested recently (Bloom filters)
+                                                            #or whose windows are all in the uop cache
+                                                            #echo "#define PREF_FILTER" >> inc/defines.h
+                                                            echo "#define PREF_FILTER_BITS 8192" >> inc/defines.h
+                                                            echo "#define PREF_FILTER_WINDOW 1024" >> inc/defines.h
+
+                                                            #uop count capacity model of the uop cache: a window takes ways by its uops, over the ways or uops limit it is not cached
+                                                            #echo "#define UOP_CACHE_UOP_CAPACITY" >> inc/defines.h
+                                                            echo "#define UOP_CACHE_UOPS_PER_WAY 6" >> inc/defines.h
+                                                            echo "#define UOP_CACHE_MAX_WAYS_PER_WINDOW 3" >> inc/defines.h
+                                                            echo "#define UOP_CACHE_MAX_UOPS_PER_WINDOW 18" >> inc/defines.h
+
+                                                            #loop stream detector: small loops locked in the loop buffer bypass the uop cache and the decoders
+                                                            #echo "#define LOOP_BUFFER" >> inc/defines.h
+                                                            echo "#define LOOP_BUFFER_UOPS 64" >> inc/defines.h
+                                                            echo "#define LOOP_BUFFER_MIN_ITERATIONS 8" >> inc/defines.h
+
+                                                            #prefetch telemetry: cycles per sample of the per-epoch time series (0 or undefined for the totals only)
+                                                            #echo "#define PREF_TELEMETRY_EPOCH 100000" >> inc/defines.h
+                                                            
                                                             
                                                             ################################################################################
                                                             
@@ -126,25 +154,7 @@ do
                                                             fi
                                                             
                                                             
-                                                            if [ $uop_cache_replacement == "lru" ] ; then
-                                                                echo "#define UOP_CACHE_LRU_RP" >> inc/defines.h
-                                                            fi
-                                                            if [ $uop_cache_replacement == "smartlru" ] ; then
-                                                                echo "#define UOP_CACHE_SMARTLRU_RP" >> inc/defines.h
-                                                            fi
                                                             echo "#define UOP_CACHE_RECOVERY_SIZE ${recovery_size}" >> inc/defines.h
-                                                            if [ $uop_cache_replacement == "hotloop" ] ; then
-                                                                echo "#define UOP_CACHE_HOTLOOP_RP" >> inc/defines.h
-                                                            fi
-                                                            if [ $uop_cache_replacement == "lruhotloop" ] ; then
-                                                                echo "#define UOP_CACHE_LRUHOTLOOP_RP" >> inc/defines.h
-                                                            fi
-                                                            if [ $uop_cache_replacement == "lrucritical" ] ; then
-                                                                echo "#define UOP_CACHE_LRUCRITICAL_RP" >> inc/defines.h
-                                                            fi
-                                                            if [ $uop_cache_replacement == "hotloopcritical" ] ; then
-                                                                echo "#define UOP_CACHE_HOTLOOPCRITICAL_RP" >> inc/defines.h
-                                                            fi
                                                             
                                                             if [ $bin == "branch_uop_pref" ] ; then
                                                                 echo "#define BRANCH_UOP_PREF" >> inc/defines.h
@@ -302,7 +312,7 @@ do
                                                             echo "#define CONFIGURATION "'"'"$config"'"'"" >> inc/defines.h
                                                             cp -f alder_lake_oc.json generated_configs/champsim_config-$config.json
                                                             sed -i -e "s/BINARY/$config/g" generated_configs/champsim_config-$config.json
-                                                            sed -i -e "s/uop_cache_replacement/$uop_cache_replacement/g" generated_configs/champsim_config-$config.json
+                                                            sed -i -e "s/UOP_CACHE_REPLACEMENT/$uop_cache_replacement/g" generated_configs/champsim_config-$config.json
                                                             sed -i -e "s/DIB_SETS/$uop_cache_sets/g" generated_configs/champsim_config-$config.json
                                                             sed -i -e "s/IFETCH_BUFFER_SIZE_VALUE/$pref_nesting_level/g" generated_configs/champsim_config-$config.json
                                                             sed -i -e "s/WINDOW_SIZE_DIB/16/g" -e "s/NUM_WAYS_DIB/8/g" generated_configs/champsim_config-$config.json
@@ -45,6 +45,8 @@ if __name__ == '__main__':
             help='A directory to search for prefetchers')
     parser.add_argument('--replacement-dir', action='append', default=[],
             help='A directory to search for replacement policies')
+    parser.add_argument('--uop-replacement-dir', action='append', default=[],
+            help='A directory to search for uop cache replacement policies')
     parser.add_argument('files', nargs='*',
             help='A sequence of JSON files describing the configuration. The last file specified has the highest priority.')
 
@@ -68,7 +70,8 @@ if __name__ == '__main__':
                 branch_dir=[*(os.path.join(d,'branch') for d in args.module_dir), *args.branch_dir],
                 btb_dir=[*(os.path.join(d,'btb') for d in args.module_dir), *args.btb_dir],
                 pref_dir=[*(os.path.join(d,'prefetcher') for d in args.module_dir), *args.prefetcher_dir],
-                repl_dir=[*(os.path.join(d,'replacement') for d in args.module_dir), *args.replacement_dir]
+                repl_dir=[*(os.path.join(d,'replacement') for d in args.module_dir), *args.replacement_dir],
+                uop_repl_dir=[*(os.path.join(d,'uop_replacement') for d in args.module_dir), *args.uop_replacement_dir]
             )
         for c in config_files)
 
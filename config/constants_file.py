@@ -12,6 +12,9 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+# order of the dram_address_mapping enum
+dram_address_mappings = ('champsim', 'row_interleaved', 'line_interleaved')
+
 def get_constants_file(env, pmem):
     yield from (
         '#ifndef CHAMPSIM_CONSTANTS_H',
@@ -29,9 +32,13 @@ def get_constants_file(env, pmem):
         'constexpr std::size_t DRAM_CHANNELS = {channels};'.format(**pmem),
         'constexpr std::size_t DRAM_RANKS = {ranks};'.format(**pmem),
         'constexpr std::size_t DRAM_BANKS = {banks};'.format(**pmem),
+        'constexpr std::size_t DRAM_BANK_GROUPS = {bank_groups};'.format(**pmem),
         'constexpr std::size_t DRAM_ROWS = {rows};'.format(**pmem),
         'constexpr std::size_t DRAM_COLUMNS = {columns};'.format(**pmem),
         'constexpr std::size_t DRAM_CHANNEL_WIDTH = {channel_width};'.format(**pmem),
+        'constexpr unsigned DRAM_ADDRESS_MAPPING = {};'.format(dram_address_mappings.index(pmem['address_mapping'])),
+        'constexpr bool DRAM_BANK_XOR_HASH = {};'.format('true' if pmem['bank_hash'] == 'xor' else 'false'),
+        'constexpr bool DRAM_CHANNEL_XOR_HASH = {};'.format('true' if pmem['channel_hash'] == 'xor' else 'false'),
         'constexpr std::size_t DRAM_WQ_SIZE = {wq_size};'.format(**pmem),
         'constexpr std::size_t DRAM_RQ_SIZE = {rq_size};'.format(**pmem),
         '#endif')
@@ -16,6 +16,32 @@ import math
 
 from . import util
 
+# MSHR organisation of every cache, the defaults are a plain MSHR of "mshr_size" entries
+default_mshr = {
+        'mshr_fill_buffers': 0,
+        'mshr_demand_reserve': 0,
+        'mshr_sectors': 1,
+        'mshr_decode_bypass': False
+        }
+
+# Feedback directed throttling of the prefetcher of every cache, off by default
+default_pf_throttle = {
+        'pf_throttle': False,
+        'pf_throttle_epoch': 65536
+        }
+
+# Set dueling between the two replacement modules of every cache, off by default (the last module chooses the victims)
+default_repl_duel = {
+        'replacement_duel': False,
+        'replacement_duel_leaders': 32
+        }
+
+# Protection of the code lines of every cache against data, off by default
+default_code_priority = {
+        'code_priority_boost': False,
+        'code_reserved_ways': 0
+        }
+
 default_l1i  = {
         'sets': 64,
         'ways': 8,
@@ -160,7 +186,9 @@ default_ptw = {
         'ptw_rq_size': 16,
         'ptw_mshr_size': 5,
         'ptw_max_read': 2,
-        'ptw_max_write': 2
+        'ptw_max_write': 2,
+        'ptw_walkers': 0,
+        'ptw_coalesce': False
         }
 
 # Defaults for first-level caches
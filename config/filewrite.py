@@ -29,6 +29,7 @@ constants_file_name = 'champsim_constants.h'
 instantiation_file_name = 'core_inst.inc'
 core_modules_file_name = 'ooo_cpu_modules.inc'
 cache_modules_file_name = 'cache_modules.inc'
+uop_cache_modules_file_name = 'uop_cache_modules.inc'
 module_definition_file_name = 'module_defs.inc'
 makefile_file_name = '_configuration.mk'
 
@@ -76,6 +77,12 @@ def get_files(executable, elements, module_info, config_file, env, bindir_name,
     yield os.path.join(inc_dir, module_definition_file_name), repl_definitions
     yield os.path.join(inc_dir, module_definition_file_name), pref_definitions
 
+    # Uop cache modules file
+    uop_repl_declarations, uop_repl_definitions = modules.get_uop_repl_lines(module_info['uop_repl'])
+
+    yield os.path.join(inc_dir, uop_cache_modules_file_name), uop_repl_declarations
+    yield os.path.join(inc_dir, module_definition_file_name), uop_repl_definitions
+
     joined_module_info = util.chain(*module_info.values()) # remove module type tag
     yield from ((os.path.join(inc_dir, m['name'] + '.inc'), get_map_lines(m['func_map'])) for m in joined_module_info.values())
     yield makefile_file_name, makefile.get_makefile_lines(objdir_name, build_id, os.path.normpath(os.path.join(bindir_name, executable)), srcdir_names, joined_module_info, env)
@@ -17,14 +17,15 @@ import operator
 
 from . import util
 
-ptw_fmtstr = 'PageTableWalker {name}("{name}", {cpu}, {frequency}, {{{{{pscl5_set}, {pscl5_way}}}, {{{pscl4_set}, {pscl4_way}}}, {{{pscl3_set}, {pscl3_way}}}, {{{pscl2_set}, {pscl2_way}}}}}, {ptw_rq_size}, {ptw_mshr_size}, {ptw_max_read}, {ptw_max_write}, 1, &{lower_level}, vmem);'
+ptw_fmtstr = 'PageTableWalker {name}("{name}", {cpu}, {frequency}, {{{{{pscl5_set}, {pscl5_way}}}, {{{pscl4_set}, {pscl4_way}}}, {{{pscl3_set}, {pscl3_way}}}, {{{pscl2_set}, {pscl2_way}}}}}, {ptw_rq_size}, {ptw_mshr_size}, {ptw_max_read}, {ptw_max_write}, 1, &{lower_level}, vmem, {ptw_walkers}, {ptw_coalesce:b});'
 
-cpu_fmtstr = '{{{index}, {frequency}, {{{DIB[sets]}, {DIB[ways]}, {{champsim::lg2({DIB[window_size]})}}, {{champsim::lg2({DIB[window_size]})}}}},{DIB[sets]}, {DIB[ways]}, {DIB[window_size]}, {ifetch_buffer_size}, {dispatch_buffer_size}, {decode_buffer_size}, {rob_size}, {lq_size}, {sq_size}, {fetch_width}, {decode_width}, {dispatch_width}, {scheduler_size}, {execute_width}, {lq_width}, {sq_width}, {retire_width}, {mispredict_penalty}, {decode_latency}, {dispatch_latency}, {schedule_latency}, {execute_latency}, &{L1I}, {L1I}.MAX_TAG, &{L1D}, {L1D}.MAX_TAG, {branch_enum_string}, {btb_enum_string}}}'
+cpu_fmtstr = '{{{index}, {frequency}, {{{DIB[sets]}, {DIB[ways]}, {{champsim::lg2({DIB[window_size]})}}, {{champsim::lg2({DIB[window_size]})}}}},{DIB[sets]}, {DIB[ways]}, {DIB[window_size]}, {ifetch_buffer_size}, {dispatch_buffer_size}, {decode_buffer_size}, {rob_size}, {lq_size}, {sq_size}, {fetch_width}, {decode_width}, {dispatch_width}, {scheduler_size}, {execute_width}, {lq_width}, {sq_width}, {retire_width}, {mispredict_penalty}, {decode_latency}, {dispatch_latency}, {schedule_latency}, {execute_latency}, &{L1I}, {L1I}.MAX_TAG, &{L1D}, {L1D}.MAX_TAG, {branch_enum_string}, {btb_enum_string}, {uop_repl_enum_string}}}'
 
-pmem_fmtstr = 'MEMORY_CONTROLLER {name}({frequency}, {io_freq}, {tRP}, {tRCD}, {tCAS}, {turn_around_time});'
-vmem_fmtstr = 'VirtualMemory vmem({pte_page_size}, {num_levels}, {minor_fault_penalty}, {dram_name});'
+pmem_fmtstr = 'MEMORY_CONTROLLER {name}({frequency}, {io_freq}, {tRP}, {tRCD}, {tCAS}, {turn_around_time}, {{{_detailed_timing:b}, {tRAS}, {tWR}, {tWTR}, {tRTP}, {tCCD_S}, {tCCD_L}, {tRRD_S}, {tRRD_L}, {tFAW}, {tREFI}, {tRFC}, {tRFCpb}, dram_refresh::{refresh}, dram_page_policy::{page_policy}}}, {{dram_scheduler::{scheduler}, dram_priority::{request_priority}, dram_fairness::{fairness}, {bliss_threshold}, {bliss_clear_interval}}});'
+vmem_fmtstr = 'VirtualMemory vmem({pte_page_size}, {num_levels}, {minor_fault_penalty}, {dram_name}, {{huge_page_policy::{huge_page_policy}, champsim::lg2({huge_page_size}), {{{_huge_page_ranges}}}}});'
+huge_range_fmtstr = '{{{begin:#x}, {end:#x}, champsim::lg2({size})}}'
 
-cache_fmtstr = 'CACHE {name}{{"{name}", {frequency}, {sets}, {ways}, {mshr_size}, {fill_latency}, {max_tag_check}, {max_fill}, {_offset_bits}, {prefetch_as_load:b}, {wq_check_full_addr:b}, {virtual_prefetch:b}, {prefetch_activate_mask}, {name}_queues, &{lower_level}, {pref_enum_string}, {repl_enum_string}}};'
+cache_fmtstr = 'CACHE {name}{{"{name}", {frequency}, {sets}, {ways}, {mshr_size}, {fill_latency}, {max_tag_check}, {max_fill}, {_offset_bits}, {prefetch_as_load:b}, {wq_check_full_addr:b}, {virtual_prefetch:b}, {prefetch_activate_mask}, {name}_queues, &{lower_level}, {pref_enum_string}, {repl_enum_string}, {{{mshr_fill_buffers}, {mshr_demand_reserve}, {mshr_sectors}, {mshr_decode_bypass:b}}}, {{{pf_throttle:b}, {pf_throttle_epoch}}}, {{{replacement_duel:b}, {replacement_duel_leaders}}}, {{{code_priority_boost:b}, {code_reserved_ways}}}}};'
 queue_fmtstr = 'CACHE::{_type} {name}_queues{{{frequency}, {rq_size}, {pq_size}, {wq_size}, {ptwq_size}, {hit_latency}, {_offset_bits}, {wq_check_full_addr:b}}};'
 
 
@@ -43,8 +44,11 @@ def get_instantiation_lines(cores, caches, ptws, pmem, vmem):
     memory_system = sorted(memory_system.values(
     ), key=operator.itemgetter('_fill_level'), reverse=True)
 
-    yield pmem_fmtstr.format(**pmem)
-    yield vmem_fmtstr.format(dram_name=pmem['name'], **vmem)
+    yield pmem_fmtstr.format(_detailed_timing=(pmem['timing_model'] != 'simple'), **pmem)
+    # range bounds may be given as hex strings
+    huge_ranges = ({k: int(v, 0) if isinstance(v, str) else v for k, v in r.items()} for r in vmem['huge_page_ranges'])
+    huge_ranges = (util.chain(r, {'size': vmem['huge_page_size']}) for r in huge_ranges)
+    yield vmem_fmtstr.format(dram_name=pmem['name'], _huge_page_ranges=', '.join(huge_range_fmtstr.format(**r) for r in huge_ranges), **vmem)
 
     for elem in memory_system:
         if 'pscl5_set' in elem:
@@ -68,6 +72,8 @@ def get_instantiation_lines(cores, caches, ptws, pmem, vmem):
                     f'O3_CPU::b{k}' for k in cpu['_branch_predictor_modnames']),
                 btb_enum_string=' | '.join(
                     f'O3_CPU::t{k}' for k in cpu['_btb_modnames']),
+                uop_repl_enum_string=' | '.join(
+                    f'MicroOpCache::u{k}' for k in cpu['_uop_replacement_modnames']),
                 **cpu) + ';' for cpu in cores)
 
     yield 'std::vector<std::reference_wrapper<O3_CPU>> ooo_cpu {{'
@@ -31,7 +31,7 @@ per_source_fmtstr = (
 '''{local_dir_varname} = {dirs}
 {local_obj_varname} = {objs}
 $({local_obj_varname}): {dest_dir}/%.o: {src_dir}/%.cc | $({local_dir_varname})
--include $(wildcard {dest_dir}/*.d))
+-include $(wildcard {dest_dir}/*.d)
 '''
 )
 def per_source(src_dirs, dest_dir, build_id):
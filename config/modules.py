@@ -82,6 +82,10 @@ def get_repl_data(module_name):
     return data_getter('repl', module_name, ('initialize_replacement', 'find_victim', 'update_replacement_state', 'replacement_final_stats'))
 
 
+def get_uop_repl_data(module_name):
+    return data_getter('urepl', module_name, ('uop_initialize_replacement', 'uop_find_victim', 'uop_update_on_hit', 'uop_update_on_insert', 'uop_replacement_final_stats'))
+
+
 def mangled_declarations(rtype, names, args, attrs=[]):
     if rtype != 'void':
         local_attrs = ('nodiscard',)
@@ -292,16 +296,55 @@ def get_repl_lines(repl_data):
         ('replacement_final_stats',)
     ]
 
+    # find_victim of a subset of the modules, for the set dueling between them
+    among_varname = 'candidates'
+    _, victim_args, victim_rtype, victim_join_op = repl_variant_data[1]
+    among_variant = ('find_victim_among', (('std::bitset<' + varname_size_name + '>', among_varname), *victim_args), victim_rtype, victim_join_op)
+
     return (
         itertools.chain(
             constants_for_modules(prefix, varname_size_name,
                                   repl_data.values()), ('',),
 
             # Declare name-mangled functions
-            *(get_module_variant_declarations(fname, [v['func_map'][fname] for v in repl_data.values()], *finfo) for fname, *finfo in repl_variant_data)
+            *(get_module_variant_declarations(fname, [v['func_map'][fname] for v in repl_data.values()], *finfo) for fname, *finfo in repl_variant_data),
+            get_module_variant_declarations(among_variant[0], [], *among_variant[1:])
+        ),
+
+        itertools.chain(
+            *(get_discriminator(fname, varname, [(prefix + v['name'], v['func_map'][fname]) for v in repl_data.values()], *finfo, classname='CACHE') for fname, *finfo in repl_variant_data),
+            discriminator_function_declaration(among_variant[0], victim_rtype, among_variant[1], classname='CACHE'),
+            discriminator_function_definition(among_variant[0], victim_rtype, victim_join_op, victim_args, among_varname, [(prefix + v['name'], v['func_map']['find_victim']) for v in repl_data.values()]),
+            ('',)
+        )
+    )
+
+
+def get_uop_repl_lines(uop_repl_data):
+    prefix = 'u'
+    varname = 'uop_repl_type'
+    varname_size_name = 'NUM_UOP_REPLACEMENT_MODULES'
+
+    uop_repl_variant_data = [
+        ('uop_initialize_replacement',),
+        ('uop_find_victim', (('uint64_t', 'set'), ('const uop_cache_entry_t*', 'current_set'), ('uint64_t', 'ip'), ('bool', 'critical'),
+         ('bool', 'pref')), 'uint64_t', '::take_last'),
+        ('uop_update_on_hit', (('uint64_t', 'set'), ('uint64_t', 'way'), ('uint64_t', 'ip'), ('uint64_t', 'current_cycle'))),
+        ('uop_update_on_insert', (('uint64_t', 'set'), ('uint64_t', 'way'), ('uint64_t', 'ip'), ('uint64_t', 'current_cycle'), ('bool', 'pref'),
+         ('bool', 'low_priority'))),
+        ('uop_replacement_final_stats',)
+    ]
+
+    return (
+        itertools.chain(
+            constants_for_modules(prefix, varname_size_name,
+                                  uop_repl_data.values()), ('',),
+
+            # Declare name-mangled functions
+            *(get_module_variant_declarations(fname, [v['func_map'][fname] for v in uop_repl_data.values()], *finfo) for fname, *finfo in uop_repl_variant_data)
         ),
 
         itertools.chain(
-            *(get_discriminator(fname, varname, [(prefix + v['name'], v['func_map'][fname]) for v in repl_data.values()], *finfo, classname='CACHE') for fname, *finfo in repl_variant_data)
+            *(get_discriminator(fname, varname, [(prefix + v['name'], v['func_map'][fname]) for v in uop_repl_data.values()], *finfo, classname='MicroOpCache') for fname, *finfo in uop_repl_variant_data)
         )
     )
@@ -21,10 +21,16 @@ from . import modules
 from . import util
 
 default_root = { 'block_size': 64, 'page_size': 4096, 'heartbeat_frequency': 10000000, 'num_cores': 1 }
-default_core = { 'frequency' : 4000, 'ifetch_buffer_size': 64, 'decode_buffer_size': 32, 'dispatch_buffer_size': 32, 'rob_size': 352, 'lq_size': 128, 'sq_size': 72, 'fetch_width' : 6, 'decode_width' : 6, 'dispatch_width' : 6, 'execute_width' : 4, 'lq_width' : 2, 'sq_width' : 2, 'retire_width' : 5, 'mispredict_penalty' : 1, 'scheduler_size' : 128, 'decode_latency' : 1, 'dispatch_latency' : 1, 'schedule_latency' : 0, 'execute_latency' : 0, 'branch_predictor': 'bimodal', 'btb': 'basic_btb' }
+default_core = { 'frequency' : 4000, 'ifetch_buffer_size': 64, 'decode_buffer_size': 32, 'dispatch_buffer_size': 32, 'rob_size': 352, 'lq_size': 128, 'sq_size': 72, 'fetch_width' : 6, 'decode_width' : 6, 'dispatch_width' : 6, 'execute_width' : 4, 'lq_width' : 2, 'sq_width' : 2, 'retire_width' : 5, 'mispredict_penalty' : 1, 'scheduler_size' : 128, 'decode_latency' : 1, 'dispatch_latency' : 1, 'schedule_latency' : 0, 'execute_latency' : 0, 'branch_predictor': 'bimodal', 'btb': 'basic_btb', 'uop_cache_replacement': 'lru' }
 default_dib  = { 'window_size': 16,'sets': 32, 'ways': 8 }
-default_pmem = { 'name': 'DRAM', 'frequency': 3200, 'channels': 1, 'ranks': 1, 'banks': 8, 'rows': 65536, 'columns': 128, 'lines_per_column': 8, 'channel_width': 8, 'wq_size': 64, 'rq_size': 64, 'tRP': 12.5, 'tRCD': 12.5, 'tCAS': 12.5, 'turn_around_time': 7.5 }
-default_vmem = { 'pte_page_size': (1 << 12), 'num_levels': 5, 'minor_fault_penalty': 200 }
+default_pmem = { 'name': 'DRAM', 'frequency': 3200, 'channels': 1, 'ranks': 1, 'banks': 8, 'rows': 65536, 'columns': 128, 'lines_per_column': 8, 'channel_width': 8, 'wq_size': 64, 'rq_size': 64, 'tRP': 12.5, 'tRCD': 12.5, 'tCAS': 12.5, 'turn_around_time': 7.5, 'address_mapping': 'champsim', 'bank_hash': 'none', 'channel_hash': 'none', 'scheduler': 'fcfs', 'request_priority': 'none', 'fairness': 'none', 'bliss_threshold': 4, 'bliss_clear_interval': 10000 }
+# Detailed DRAM timing presets, selected with "timing_model" in "physical_memory" (times in ns). Keys given in the config override them.
+dram_timing_presets = {
+    'simple': { 'bank_groups': 1, 'tRAS': 32, 'tWR': 15, 'tWTR': 7.5, 'tRTP': 7.5, 'tCCD_S': 2.5, 'tCCD_L': 5, 'tRRD_S': 2.5, 'tRRD_L': 4.9, 'tFAW': 21, 'tREFI': 7800, 'tRFC': 350, 'tRFCpb': 130, 'refresh': 'none', 'page_policy': 'open' },
+    'ddr4': { 'bank_groups': 4, 'tRAS': 32, 'tWR': 15, 'tWTR': 7.5, 'tRTP': 7.5, 'tCCD_S': 2.5, 'tCCD_L': 5, 'tRRD_S': 2.5, 'tRRD_L': 4.9, 'tFAW': 21, 'tREFI': 7800, 'tRFC': 350, 'tRFCpb': 130, 'refresh': 'all_bank', 'page_policy': 'open' },
+    'ddr5': { 'bank_groups': 8, 'tRAS': 32, 'tWR': 30, 'tWTR': 10, 'tRTP': 7.5, 'tCCD_S': 2.5, 'tCCD_L': 5, 'tRRD_S': 2.5, 'tRRD_L': 5, 'tFAW': 13.333, 'tREFI': 3900, 'tRFC': 295, 'tRFCpb': 130, 'refresh': 'per_bank', 'page_policy': 'open' }
+}
+default_vmem = { 'pte_page_size': (1 << 12), 'num_levels': 5, 'minor_fault_penalty': 200, 'huge_page_policy': 'none', 'huge_page_size': (1 << 21), 'huge_page_ranges': [] }
 
 # Assign defaults that are unique per core
 def upper_levels_for(system, names):
@@ -46,10 +52,12 @@ def merge_names(x,y):
         return x
     return x + '_' + y
 
-def parse_config(*configs, branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[]):
+def parse_config(*configs, branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[], uop_repl_dir=[]):
     config_file = util.chain(*configs, default_root, merge_funcs={'name': merge_names})
 
     pmem = util.chain(config_file.get('physical_memory', {}), default_pmem)
+    pmem = util.chain(pmem, dram_timing_presets[pmem.get('timing_model', 'simple')], {'timing_model': 'simple'})
+    pmem['bank_groups'] = min(pmem['bank_groups'], pmem['banks'])
     vmem = util.chain(config_file.get('virtual_memory', {}), default_vmem)
 
     cores = config_file.get('ooo_cpu', [{}])
@@ -119,6 +127,10 @@ def parse_config(*configs, branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[]):
 
     # Establish latencies in caches
     caches = util.combine_named(caches.values(), ({'name': c['name'], 'hit_latency': (c.get('latency',100) - c['fill_latency'])} for c in caches.values()))
+    caches = util.combine_named(caches.values(), ({'name': c['name'], **defaults.default_mshr} for c in caches.values()))
+    caches = util.combine_named(caches.values(), ({'name': c['name'], **defaults.default_pf_throttle} for c in caches.values()))
+    caches = util.combine_named(caches.values(), ({'name': c['name'], **defaults.default_repl_duel} for c in caches.values()))
+    caches = util.combine_named(caches.values(), ({'name': c['name'], **defaults.default_code_priority} for c in caches.values()))
 
     pmem['io_freq'] = pmem['frequency'] # Save value
     scale_frequencies(itertools.chain(cores, caches.values(), ptws.values(), (pmem,)))
@@ -146,16 +158,24 @@ def parse_config(*configs, branch_dir=[], btb_dir=[], pref_dir=[], repl_dir=[]):
             '_branch_predictor_modpaths': [modules.default_dir(['branch', *branch_dir], f) for f in util.wrap_list(c.get('branch_predictor', []))],
             '_btb_modpaths':  [modules.default_dir(['btb', *btb_dir], f) for f in util.wrap_list(c.get('btb', []))],
             '_branch_predictor_modnames': [modules.get_module_name(modules.default_dir(['branch', *branch_dir], f)) for f in util.wrap_list(c.get('branch_predictor', []))],
-            '_btb_modnames':  [modules.get_module_name(modules.default_dir(['btb', *btb_dir], f)) for f in util.wrap_list(c.get('btb', []))]
+            '_btb_modnames':  [modules.get_module_name(modules.default_dir(['btb', *btb_dir], f)) for f in util.wrap_list(c.get('btb', []))],
+            '_uop_replacement_modpaths': [modules.default_dir(['uop_replacement', *uop_repl_dir], f) for f in util.wrap_list(c.get('uop_cache_replacement', []))],
+            '_uop_replacement_modnames': [modules.get_module_name(modules.default_dir(['uop_replacement', *uop_repl_dir], f)) for f in util.wrap_list(c.get('uop_cache_replacement', []))]
             } for c in cores)).values())
 
+    # The uop cache is shared by the cores, it has a single replacement policy
+    uop_repl_names = {tuple(c['_uop_replacement_modnames']) for c in cores}
+    if len(uop_repl_names) > 1:
+        raise ValueError('The cores share the uop cache, their "uop_cache_replacement" must match. Found: ' + ', '.join(sorted(str(c.get('uop_cache_replacement')) for c in cores)))
+
     repl_data   = modules.get_module_data('_replacement_modnames', '_replacement_modpaths', caches.values(), ['replacement', *repl_dir], modules.get_repl_data);
     pref_data   = modules.get_module_data('_prefetcher_modnames', '_prefetcher_modpaths', caches.values(), ['prefetcher', *pref_dir], modules.get_pref_data);
     branch_data = modules.get_module_data('_branch_predictor_modnames', '_branch_predictor_modpaths', cores, ['branch', *branch_dir], modules.get_branch_data);
     btb_data    = modules.get_module_data('_btb_modnames', '_btb_modpaths', cores, ['btb', *btb_dir], modules.get_btb_data);
+    uop_repl_data = modules.get_module_data('_uop_replacement_modnames', '_uop_replacement_modpaths', cores, ['uop_replacement', *uop_repl_dir], modules.get_uop_repl_data);
 
     elements = {'cores': cores, 'caches': tuple(caches.values()), 'ptws': tuple(ptws.values()), 'pmem': pmem, 'vmem': vmem}
-    module_info = {'repl': dict(repl_data.items()), 'pref': dict(pref_data.items()), 'branch': dict(branch_data.items()), 'btb': dict(btb_data.items())}
+    module_info = {'repl': dict(repl_data.items()), 'pref': dict(pref_data.items()), 'branch': dict(branch_data.items()), 'btb': dict(btb_data.items()), 'uop_repl': dict(uop_repl_data.items())}
 
     name = config_file.get('name')
     executable = config_file.get('executable_name', 'champsim' + ('' if name is None else '_'+name))
@@ -22,7 +22,10 @@
 #include <cassert>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <list>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -30,11 +33,22 @@
 #include "champsim_constants.h"
 #include "defines.h"
 #include "memory_class.h"
+#include "msl/bloom_filter.h"
 #include "operable.h"
+#include "prefetch_controller.h"
+#include "prefetch_telemetry.h"
 #include "profiler.h"
+#include "replacement_state.h"
 #include "vmem.h"
 extern VirtualMemory vmem;
 
+#ifndef PREF_FILTER_BITS
+#define PREF_FILTER_BITS 8192
+#endif
+#ifndef PREF_FILTER_WINDOW
+#define PREF_FILTER_WINDOW 1024
+#endif
+
 struct cache_stats {
   std::string name;
   // prefetch stats
@@ -43,11 +57,68 @@ struct cache_stats {
   uint64_t pf_useful = 0;
   uint64_t pf_useless = 0;
   uint64_t pf_fill = 0;
+  uint64_t pf_filtered_recent = 0;    // dropped: line requested by a prefetch or the uop cache prefetcher not long ago
+  uint64_t pf_filtered_uop_cache = 0; // dropped: every window of the line is in the uop cache
+  uint64_t pf_filtered_uop_mshr = 0;  // dropped: line already in the uop cache prefetch MSHR
+  champsim::prefetch_telemetry pf_telemetry;
 
   std::array<std::array<uint64_t, NUM_CPUS>, NUM_TYPES> hits = {};
   std::array<std::array<uint64_t, NUM_CPUS>, NUM_TYPES> misses = {};
 
   uint64_t total_miss_latency = 0;
+
+  // MSHR
+  uint64_t mshr_demand_full_cycles = 0;   // cycles a demand miss was retried because every entry was taken
+  uint64_t mshr_prefetch_full_cycles = 0; // cycles a prefetch miss was retried because every unreserved entry was taken
+  uint64_t mshr_late_prefetch = 0;        // demand misses merged into an in-flight prefetch
+  uint64_t mshr_occupancy = 0;            // summed over the cycles
+  uint64_t mshr_cycles = 0;
+  std::size_t mshr_peak = 0;
+  uint64_t fill_buffer_waits = 0; // cycles returned misses waited for a fill buffer
+  uint64_t mshr_fills = 0;
+  uint64_t mshr_demand_sectors = 0; // sub-blocks asked for by demand accesses, over the filled entries
+  uint64_t decode_bypass = 0;       // L1I: uop cache prefetches delivered to the prefetch decode buffer at data return
+
+  // feedback directed prefetching
+  uint64_t pf_throttle_up = 0;
+  uint64_t pf_throttle_down = 0;
+  std::array<uint64_t, prefetch_controller::NUM_LEVELS> pf_level_epochs = {};
+  uint64_t pf_polluting_misses = 0; // demand misses to lines a prefetch evicted not long ago
+
+  // set dueling between two replacement modules
+  std::array<uint64_t, champsim::set_dueling::NUM_POLICIES> repl_duel_victims = {}; // victims chosen by each module
+
+  // code lines (filled for an instruction fetch or prefetch)
+  uint64_t code_fills = 0;
+  uint64_t code_evicted_by_data = 0;
+  uint64_t code_evicted_by_code = 0;
+  uint64_t code_protected = 0; // data fills turned away from the code victim chosen by the replacement module, by the reserved ways
+};
+
+// Organisation of the MSHR of a cache, the defaults give a plain MSHR of MSHR_SIZE entries
+struct cache_mshr_spec {
+  std::size_t fill_buffers = 0;   // returned misses staged for the fill at a time (demand first), 0 for no limit
+  std::size_t demand_reserve = 0; // entries prefetch misses may not allocate
+  unsigned sectors = 1;           // sub-blocks tracked per entry
+  bool decode_bypass = false;     // L1I: uop cache prefetches reach the prefetch decode buffer when the data returns, not after the fill
+};
+
+// Feedback directed throttling of the prefetcher of a cache, see prefetch_controller
+struct cache_pf_throttle_spec {
+  bool enabled = false;
+  uint64_t epoch = 65536; // cycles
+};
+
+// Set dueling between the two replacement modules of a cache, see champsim::set_dueling
+struct cache_repl_duel_spec {
+  bool enabled = false;
+  std::size_t leader_sets = 32; // per module and per core
+};
+
+// Protection of the code lines of a unified cache against data, in the spirit of Emissary and CLIP
+struct cache_code_priority_spec {
+  bool boost = false;         // code fills are promoted like a hit after their fill, to the highest priority of the replacement module
+  uint32_t reserved_ways = 0; // a data fill does not evict a code line while the set holds at most this many of them
 };
 
 struct cache_queue_stats {
@@ -70,6 +141,33 @@ struct cache_queue_stats {
   uint64_t PTWQ_TO_CACHE = 0;
 };
 
+/*
+ * Line address -> position of its first packet in a cache queue, used by the collision check to find the packet a new
+ * request merges with without scanning the queue. Positions shift when packets leave the queue, so the index is rebuilt
+ * by each collision check over the packets ahead of the first unchecked one; reset() is O(1) (epoch per slot).
+ */
+class queue_line_index
+{
+public:
+  static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+  void reset(std::size_t queue_size);
+  std::size_t find(uint64_t line) const;
+  void insert(uint64_t line, std::size_t pos); // a line keeps the position of its first packet
+
+private:
+  struct slot_t {
+    uint64_t line = 0;
+    std::size_t pos = NONE;
+    uint64_t epoch = 0;
+  };
+
+  std::vector<slot_t> slots;
+  uint64_t epoch = 0;
+
+  std::size_t home_slot(uint64_t line) const;
+};
+
 class CACHE : public champsim::operable, public MemoryRequestConsumer, public MemoryRequestProducer
 {
   enum [[deprecated(
@@ -80,7 +178,7 @@ class CACHE : public champsim::operable, public MemoryRequestConsumer, public Me
   bool handle_fill(const PACKET& fill_mshr);
   bool handle_miss(const PACKET& handle_pkt);
   bool handle_write(const PACKET& handle_pkt);
-  void update_dib_from_prefetch(const PACKET& pref_entry);
+  bool update_dib_from_prefetch(const PACKET& pref_entry);
 
   struct BLOCK {
     bool valid = false;
@@ -92,6 +190,11 @@ class CACHE : public champsim::operable, public MemoryRequestConsumer, public Me
     uint64_t data = 0;
 
     uint32_t pf_metadata = 0;
+    uint8_t page_shift = 0; // TLBs: an entry for a whole huge page, tagged with its base
+
+    champsim::prefetch_source pf_source = champsim::prefetch_source::MODULE; // of a prefetched line, for the telemetry
+    uint64_t fill_cycle = 0;
+    bool instruction = false; // code line, filled or hit by an instruction fetch or prefetch
   };
   using set_type = std::vector<BLOCK>;
 
@@ -99,6 +202,17 @@ class CACHE : public champsim::operable, public MemoryRequestConsumer, public Me
   std::pair<set_type::const_iterator, set_type::const_iterator> get_set_span(uint64_t address) const;
   std::size_t get_set_index(uint64_t address) const;
 
+  uint64_t sector_mask(const PACKET& pkt) const;
+  void stage_fills();
+  bool drop_redundant_prefetch(uint64_t pf_addr);
+  void update_prefetch_throttle();
+  uint32_t find_victim_way(const PACKET& fill_mshr, uint32_t set, const BLOCK* current_set, uint64_t full_addr);
+
+  // TLBs: sizes of the huge page entries filled so far (bit per shift), each of them is probed on a miss
+  uint64_t huge_page_shifts = 0;
+  uint64_t huge_page_set_address(uint64_t base, unsigned shift) const;
+  bool find_huge_page(uint64_t address, set_type::iterator& set_begin, set_type::iterator& set_end, set_type::iterator& way);
+
 public:
   struct ip_in_line_entry {
     uint64_t ip = 0;
@@ -123,12 +237,49 @@ public:
 
     // ADDED THIS:
     bool is_alternate_path = false;  // Track if this MSHR is for alternate path
+    uint64_t by_ip = 0;              // H2P branch that started the alternate path
   };
 
   std::deque<uop_mshr_entry> UOP_CACHE_MSHR;
 
+  // L1I: the fetch target queue (IFETCH_BUFFER) of the core, for the prefetchers that run ahead of fetch
+  const std::deque<ooo_model_instr>* fetch_target_queue = nullptr;
+
+  // L1I: filter shared by prefetch_line() and the uop cache prefetcher (PREF_FILTER). The lines requested recently are
+  // kept in two Bloom filters, the older one is cleared and they swap roles every PREF_FILTER_WINDOW requests. The lines
+  // are in the address space of the prefetches (virtual_prefetch).
+  class prefetch_filter
+  {
+    std::array<champsim::msl::bloom_filter, 2> banks;
+    std::size_t window;
+    std::size_t current = 0;
+
+  public:
+    prefetch_filter(std::size_t bits, std::size_t window_size) : banks{champsim::msl::bloom_filter{bits}, champsim::msl::bloom_filter{bits}}, window(window_size) {}
+
+    bool recently_requested(uint64_t line) const { return banks[0].contains(line) || banks[1].contains(line); }
+
+    void record(uint64_t line)
+    {
+      if (banks[current].size() >= window) {
+        current ^= 1;
+        banks[current].clear();
+      }
+      banks[current].insert(line);
+    }
+  };
+
+  prefetch_filter recent_prefetches{PREF_FILTER_BITS, PREF_FILTER_WINDOW};
+
+  // L1I: true when every uop cache window of the line (virtual address) is resident, set by the core
+  std::function<bool(uint64_t)> uop_cache_holds_line;
+
+  // L1I: records the uop cache prefetcher's request for the line, so that the L1I prefetchers do not request it again.
+  // Only a cache that prefetches virtual addresses records it, the filter does not mix address spaces.
+  void record_uop_prefetch(uint64_t v_address);
+
   struct NonTranslatingQueues : public champsim::operable {
-    std::deque<PACKET> RQ, PQ, WQ, PTWQ;
+    packet_queue RQ, PQ, WQ, PTWQ;
     const std::size_t RQ_SIZE, PQ_SIZE, WQ_SIZE, PTWQ_SIZE;
     const uint64_t HIT_LATENCY;
     const unsigned OFFSET_BITS;
@@ -168,6 +319,8 @@ public:
     void end_phase(unsigned cpu) override;
 
   private:
+    queue_line_index wq_lines, line_index;
+
     void check_collision();
   };
 
@@ -199,6 +352,7 @@ public:
 
     // ADDED THIS:
     bool is_alternate_path = false;  // Track if from alternate path
+    uint64_t by_ip = 0;
   };
 
   std::deque<prefetch_decode_entry> cache_pref_decode_buffer;
@@ -222,8 +376,38 @@ public:
   std::vector<stats_type> sim_stats{}, roi_stats{};
 
   NonTranslatingQueues& queues;
-  std::deque<PACKET> MSHR;
-  std::deque<PACKET> inflight_writes;
+
+  struct mshr_entry {
+    PACKET pkt;
+    uint64_t demand_sectors = 0;   // sub-blocks of the line asked for by demand accesses
+    uint64_t prefetch_sectors = 0; // and by prefetches
+  };
+
+  // Returned entries are kept at the front in the order they returned, the first fill_buffers of them are in the fill buffers
+  const cache_mshr_spec mshr_spec;
+
+  const cache_pf_throttle_spec pf_throttle;
+  prefetch_controller pf_controller;
+  struct pf_throttle_epoch_state {
+    uint64_t end_cycle = 0;
+    champsim::prefetch_counters at_begin; // telemetry of the prefetcher module when the epoch began
+    uint64_t demand_misses = 0, polluting_misses = 0;
+    uint64_t dram_occupancy = 0, dram_size = 0; // summed over the cycles
+  } pf_epoch;
+  // lines evicted by prefetch fills during the epoch, the recent ones and the ones before them. The recent filter is
+  // retired once it holds PF_EVICTED_LINES lines, 8 bits per line keep its false positive rate near 3%.
+  static constexpr std::size_t PF_EVICTED_LINES = 512;
+  std::array<champsim::msl::bloom_filter, 2> pf_evicted{champsim::msl::bloom_filter{8 * PF_EVICTED_LINES}, champsim::msl::bloom_filter{8 * PF_EVICTED_LINES}};
+  MemoryRequestConsumer* memory_controller = nullptr; // below the last level cache, for its read queue occupancy
+
+  const cache_repl_duel_spec repl_duel_spec;
+  std::optional<champsim::set_dueling> repl_duel;
+  std::array<std::size_t, champsim::set_dueling::NUM_POLICIES> repl_duel_modules = {}; // bit of each dueling module in repl_type
+  std::vector<std::shared_ptr<void>> repl_states; // state of the replacement modules, see replacement_state()
+
+  const cache_code_priority_spec code_priority;
+  std::deque<mshr_entry, champsim::msl::slab_allocator<mshr_entry>> MSHR;
+  packet_queue inflight_writes;
 
   std::deque<uint64_t> uop_pref_addrs;
 
@@ -260,8 +444,30 @@ public:
 
   uint64_t invalidate_entry(uint64_t inval_addr);
   int prefetch_line(uint64_t pf_addr, bool fill_this_level, uint32_t prefetch_metadata);
+
+  // degree and distance for the prefetcher module, its nominal values scaled by the feedback directed throttle
+  unsigned prefetch_degree(unsigned nominal) const { return pf_throttle.enabled ? pf_controller.degree(nominal) : nominal; }
+  unsigned prefetch_distance(unsigned nominal) const { return pf_throttle.enabled ? pf_controller.distance(nominal) : nominal; }
   int prefetch_line_pkt(PACKET& pf_packet);
 
+  // State of a replacement module owned by the cache, one object per type: the module creates it in its
+  // initialize_replacement() and finds it again without any lookup on every call
+  template <typename T, typename... Args>
+  T& emplace_replacement_state(Args&&... args)
+  {
+    const auto slot = champsim::detail::replacement_state_slot<T>();
+    if (std::size(repl_states) <= slot)
+      repl_states.resize(slot + 1);
+    repl_states[slot] = std::make_shared<T>(std::forward<Args>(args)...);
+    return replacement_state<T>();
+  }
+
+  template <typename T>
+  T& replacement_state()
+  {
+    return *static_cast<T*>(repl_states[champsim::detail::replacement_state_slot<T>()].get());
+  }
+
   [[deprecated("Use CACHE::prefetch_line(pf_addr, fill_this_level, prefetch_metadata) instead.")]] int
   prefetch_line(uint64_t ip, uint64_t base_addr, uint64_t pf_addr, bool fill_this_level, uint32_t prefetch_metadata);
 
@@ -277,10 +483,11 @@ public:
   // constructor
   CACHE(std::string v1, double freq_scale, uint32_t v2, uint32_t v3, uint32_t v8, uint32_t fill_lat, long int max_tag, long int max_fill, unsigned offset_bits,
         bool pref_load, bool wq_full_addr, bool va_pref, unsigned pref_mask, NonTranslatingQueues& queue_set, MemoryRequestConsumer* ll,
-        std::bitset<NUM_PREFETCH_MODULES> pref, std::bitset<NUM_REPLACEMENT_MODULES> repl)
+        std::bitset<NUM_PREFETCH_MODULES> pref, std::bitset<NUM_REPLACEMENT_MODULES> repl, cache_mshr_spec mshr = {}, cache_pf_throttle_spec throttle = {},
+        cache_repl_duel_spec duel = {}, cache_code_priority_spec code = {})
       : champsim::operable(freq_scale), MemoryRequestProducer(ll), NAME(v1), NUM_SET(v2), NUM_WAY(v3), MSHR_SIZE(v8), FILL_LATENCY(fill_lat),
         OFFSET_BITS(offset_bits), MAX_TAG(max_tag), MAX_FILL(max_fill), prefetch_as_load(pref_load), match_offset_bits(wq_full_addr), virtual_prefetch(va_pref),
-        pref_activate_mask(pref_mask), queues(queue_set), repl_type(repl), pref_type(pref)
+        pref_activate_mask(pref_mask), queues(queue_set), mshr_spec(mshr), pf_throttle(throttle), repl_duel_spec(duel), code_priority(code), repl_type(repl), pref_type(pref)
   {
     get_profiler_ptr->m_OFFSET_BITS = offset_bits;
     get_profiler_ptr->l1ci_sets = v2;
@@ -18,11 +18,20 @@
 #define NUM_OF_INSTR_PER_ENTRY 64
 #define BTB_BANKS 32
 #define BTB_CONF_PROB 10
+#define FDIP_LOOKAHEAD 192
+#define FDIP_L1I_DISTANCE 64
+#define FDIP_BANDWIDTH 2
+#define PREF_FILTER_BITS 8192
+#define PREF_FILTER_WINDOW 1024
+#define UOP_CACHE_UOPS_PER_WAY 6
+#define UOP_CACHE_MAX_WAYS_PER_WINDOW 3
+#define UOP_CACHE_MAX_UOPS_PER_WINDOW 18
+#define LOOP_BUFFER_UOPS 64
+#define LOOP_BUFFER_MIN_ITERATIONS 8
 #define USE_ALT_INDIRECT_PREDICTOR
 #define H2P_TAGE_NON_BOUNDARY
 #define H2P_TAGE_STYLE_CTR_SC_BIMH
 #define L1I_PREF_AT_TRY_HIT
-#define UOP_CACHE_LRU_RP
 #define UOP_CACHE_RECOVERY_SIZE 8
 #define REAL_BRANCH_RECOVERY
 #define PREFETCH_PATHS
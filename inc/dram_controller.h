@@ -17,10 +17,14 @@
 #ifndef DRAM_H
 #define DRAM_H
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <deque>
 #include <limits>
+#include <optional>
+#include <vector>
 
 #include "champsim_constants.h"
 #include "memory_class.h"
@@ -32,11 +36,237 @@ struct dram_stats {
   uint64_t dbus_cycle_congested = 0, dbus_count_congested = 0;
 
   unsigned WQ_ROW_BUFFER_HIT = 0, WQ_ROW_BUFFER_MISS = 0, RQ_ROW_BUFFER_HIT = 0, RQ_ROW_BUFFER_MISS = 0, WQ_FULL = 0;
+  unsigned REFRESHES = 0;
+  unsigned RQ_CRITICAL = 0, BLACKLISTINGS = 0;
+};
+
+/*
+ * Physical address -> DRAM coordinates. The layout is chosen with "address_mapping" in the config (low bits first):
+ *  - champsim:         | offset | channel | bank | column | rank | row |
+ *  - row_interleaved:  | offset | column | channel | bank | rank | row |   (a whole row of lines on one bank)
+ *  - line_interleaved: | offset | channel | bank | rank | column | row |   (consecutive lines over every bank)
+ * "bank_hash"/"channel_hash": "xor" permute the bank/channel with the low row bits, so that power-of-two strides that
+ * differ only in the row do not fall into one bank. Everything folds into constexpr shifts and masks.
+ */
+enum class dram_address_mapping { champsim, row_interleaved, line_interleaved };
+
+struct dram_address_layout {
+  unsigned channel, bank, column, rank, row; // shifts
+};
+
+constexpr dram_address_layout make_dram_address_layout(dram_address_mapping mapping)
+{
+  constexpr unsigned channel_bits = champsim::lg2(DRAM_CHANNELS), bank_bits = champsim::lg2(DRAM_BANKS), column_bits = champsim::lg2(DRAM_COLUMNS),
+                     rank_bits = champsim::lg2(DRAM_RANKS);
+  constexpr unsigned offset = LOG2_BLOCK_SIZE;
+
+  switch (mapping) {
+  case dram_address_mapping::row_interleaved:
+    return {offset + column_bits, offset + column_bits + channel_bits, offset, offset + column_bits + channel_bits + bank_bits,
+            offset + column_bits + channel_bits + bank_bits + rank_bits};
+  case dram_address_mapping::line_interleaved:
+    return {offset, offset + channel_bits, offset + channel_bits + bank_bits + rank_bits, offset + channel_bits + bank_bits,
+            offset + channel_bits + bank_bits + rank_bits + column_bits};
+  case dram_address_mapping::champsim:
+  default:
+    return {offset, offset + channel_bits, offset + channel_bits + bank_bits, offset + channel_bits + bank_bits + column_bits,
+            offset + channel_bits + bank_bits + column_bits + rank_bits};
+  }
+}
+
+constexpr dram_address_layout DRAM_ADDRESS_LAYOUT = make_dram_address_layout(static_cast<dram_address_mapping>(DRAM_ADDRESS_MAPPING));
+
+// the DRAM coordinates of an address for a layout, with the bank/channel XOR hashing on or off
+struct dram_address_map {
+  dram_address_layout layout;
+  bool bank_xor_hash = false, channel_xor_hash = false;
+
+  constexpr uint32_t channel(uint64_t address) const
+  {
+    // hashed with the row bits above the ones used for the bank
+    uint64_t hash = channel_xor_hash ? (address >> (layout.row + champsim::lg2(DRAM_BANKS))) : 0;
+    return static_cast<uint32_t>(((address >> layout.channel) ^ hash) & champsim::bitmask(champsim::lg2(DRAM_CHANNELS)));
+  }
+  constexpr uint32_t bank(uint64_t address) const
+  {
+    uint64_t hash = bank_xor_hash ? (address >> layout.row) : 0;
+    return static_cast<uint32_t>(((address >> layout.bank) ^ hash) & champsim::bitmask(champsim::lg2(DRAM_BANKS)));
+  }
+  constexpr uint32_t column(uint64_t address) const { return static_cast<uint32_t>((address >> layout.column) & champsim::bitmask(champsim::lg2(DRAM_COLUMNS))); }
+  constexpr uint32_t rank(uint64_t address) const { return static_cast<uint32_t>((address >> layout.rank) & champsim::bitmask(champsim::lg2(DRAM_RANKS))); }
+  constexpr uint32_t row(uint64_t address) const { return static_cast<uint32_t>((address >> layout.row) & champsim::bitmask(champsim::lg2(DRAM_ROWS))); }
+};
+
+constexpr dram_address_map DRAM_ADDRESS_MAP{DRAM_ADDRESS_LAYOUT, DRAM_BANK_XOR_HASH, DRAM_CHANNEL_XOR_HASH};
+
+enum class dram_page_policy { open, closed, adaptive };
+enum class dram_refresh { none, all_bank, per_bank };
+
+// Parameters of the detailed timing mode, in ns like tRP/tRCD/tCAS
+struct dram_timing_spec {
+  bool detailed = false;
+  double tRAS = 32, tWR = 15, tWTR = 7.5, tRTP = 7.5;
+  double tCCD_S = 2.5, tCCD_L = 5, tRRD_S = 2.5, tRRD_L = 4.9, tFAW = 21;
+  double tREFI = 7800, tRFC = 350, tRFCpb = 130;
+  dram_refresh refresh = dram_refresh::all_bank;
+  dram_page_policy page_policy = dram_page_policy::open;
+};
+
+/*
+ * Request scheduling, chosen with "scheduler", "request_priority" and "fairness" in the config.
+ * A read is ranked by (lowest first):
+ *  - the lane: instruction fetch and page walk misses go first with "request_priority": "critical"
+ *  - whether its core is blacklisted, with "fairness": "bliss" (a core served bliss_threshold times in a row is
+ *    blacklisted until the blacklist is cleared, every bliss_clear_interval cycles)
+ *  - its class: demand before prefetch with "demand", and also UCP instruction prefetches before data prefetches with "critical"
+ *  - row buffer hit before miss with "scheduler": "frfcfs"
+ *  - age
+ * Only the packets of free banks compete under frfcfs. "fcfs" with no priority and no fairness is the former in order
+ * scheduler, where the oldest packet blocks the others until its bank is free. Writes are only ranked by row hit and age.
+ */
+enum class dram_scheduler { fcfs, frfcfs };
+enum class dram_priority { none, demand, critical };
+enum class dram_fairness { none, bliss };
+
+struct dram_scheduler_spec {
+  dram_scheduler policy = dram_scheduler::fcfs;
+  dram_priority priority = dram_priority::none;
+  dram_fairness fairness = dram_fairness::none;
+  unsigned bliss_threshold = 4;
+  uint64_t bliss_clear_interval = 10000;
+};
+
+// most urgent first
+enum class dram_request_class : uint8_t { critical, demand, instruction_prefetch, prefetch };
+
+/*
+ * Command level timing of one channel for the detailed mode (DDR4/DDR5 like).
+ * Every access is turned into the PRE/ACT/column commands it needs, each issued at the earliest cycle allowed by
+ *  - the bank: tRP, tRCD, tRAS, tRTP, tWR
+ *  - the bank group: tCCD_L, tRRD_L
+ *  - the rank: tCCD_S, tRRD_S, tFAW, tWTR
+ * and by refresh, which closes the rows and blocks the refreshed banks for tRFC (all bank) or tRFCpb (per bank).
+ * Banks are interleaved over the bank groups (bank % DRAM_BANK_GROUPS).
+ */
+class dram_timing_model
+{
+public:
+  static constexpr uint32_t NO_ROW = std::numeric_limits<uint32_t>::max();
+
+  struct cycles_type {
+    uint64_t tRP, tRCD, tCAS, tRAS, tWR, tWTR, tRTP, tCCD_S, tCCD_L, tRRD_S, tRRD_L, tFAW, tREFI, tRFC, tRFCpb, burst;
+  };
+
+  struct access_result {
+    uint64_t data_cycle; // first cycle of the data burst
+    bool row_buffer_hit;
+  };
+
+  dram_timing_model(cycles_type timing, dram_refresh refresh, dram_page_policy page_policy);
+
+  access_result access(std::size_t rank, std::size_t bank, uint32_t row, bool is_write, bool keep_open, uint64_t current_cycle);
+  unsigned refresh(uint64_t current_cycle); // returns the number of refresh commands issued
+
+  uint32_t open_row(std::size_t rank, std::size_t bank) const { return banks[rank * DRAM_BANKS + bank].open_row; }
+  dram_page_policy page_policy() const { return policy; }
+
+private:
+  struct bank_state {
+    uint32_t open_row = NO_ROW;
+    uint64_t act_ready = 0, col_ready = 0, pre_ready = 0;
+  };
+
+  struct rank_state {
+    uint64_t col_ready = 0, act_ready = 0, read_ready = 0;
+    std::array<uint64_t, DRAM_BANK_GROUPS> group_col_ready = {}, group_act_ready = {};
+    std::array<uint64_t, 4> faw_ready = {}; // for tFAW: the last four activates + tFAW, oldest first
+  };
+
+  cycles_type t;
+  dram_refresh refresh_mode;
+  dram_page_policy policy;
+
+  std::array<bank_state, DRAM_RANKS * DRAM_BANKS> banks = {};
+  std::array<rank_state, DRAM_RANKS> ranks = {};
+  uint64_t next_refresh = 0;
+  std::size_t next_refresh_bank = 0;
+
+  void refresh_bank(bank_state& bank, uint64_t start, uint64_t duration);
+};
+
+/*
+ * Bookkeeping that follows the contents of one DRAM queue so that the controller never scans the queue:
+ *  - the occupancy and a bitmap of the used slots (inserts take the lowest free slot)
+ *  - block address -> slot hash chains for write forwarding and read merging
+ *  - per-bank ready lists of the unscheduled packets, ordered by event_cycle then slot like the former full scan
+ *  - the slots inserted since the last collision check
+ * A packet leaves its ready list as soon as it is scheduled or erased, so a list never holds more than the queue.
+ */
+class dram_queue_index
+{
+public:
+  static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+  dram_queue_index(std::size_t slots, std::size_t banks);
+
+  std::size_t size() const { return occupancy; }
+  std::size_t free_slot() const;
+
+  void insert(std::size_t slot, uint64_t block, std::size_t bank, uint64_t event_cycle);
+  void erase(std::size_t slot);
+  void clear();
+
+  // lowest used slot in [first, last) holding this block address
+  std::size_t find(uint64_t block, std::size_t first = 0, std::size_t last = NONE) const;
+
+  // unscheduled packets
+  void make_ready(std::size_t slot, uint64_t event_cycle);
+  void remove_ready(std::size_t slot);
+  std::size_t oldest_ready() const;
+  std::size_t num_ready(std::size_t bank) const { return std::size(ready[bank]); }
+
+  // f(slot) for the unscheduled packets of the bank that are ready by this cycle, oldest first
+  template <typename F>
+  void for_each_ready(std::size_t bank, uint64_t cycle, F&& f) const
+  {
+    for (const auto& entry : ready[bank]) {
+      if (entry.event_cycle > cycle)
+        break;
+      f(entry.slot);
+    }
+  }
+
+  // whether pred(slot) holds for an unscheduled packet of the bank
+  template <typename F>
+  bool any_ready(std::size_t bank, F&& pred) const
+  {
+    return std::any_of(std::begin(ready[bank]), std::end(ready[bank]),
+                       [&](const ready_entry& entry) { return pred(entry.slot); });
+  }
+
+  const std::vector<std::size_t>& take_unchecked();
+
+private:
+  struct ready_entry {
+    uint64_t event_cycle;
+    std::size_t slot;
+  };
+
+  std::size_t num_slots, occupancy = 0;
+  std::vector<uint64_t> used;
+  std::vector<std::size_t> bucket_head, chain_next, bank_of;
+  std::vector<uint64_t> block_of;
+  std::vector<std::deque<ready_entry>> ready;
+  std::vector<std::size_t> unchecked, checking;
+
+  std::size_t bucket(uint64_t block) const;
 };
 
 struct DRAM_CHANNEL {
   using queue_type = std::vector<PACKET>;
   queue_type WQ{DRAM_WQ_SIZE}, RQ{DRAM_RQ_SIZE};
+  dram_queue_index WQ_index{DRAM_WQ_SIZE, DRAM_RANKS * DRAM_BANKS}, RQ_index{DRAM_RQ_SIZE, DRAM_RANKS * DRAM_BANKS};
+  std::vector<dram_request_class> RQ_class = std::vector<dram_request_class>(DRAM_RQ_SIZE); // merged reads keep the most urgent class
 
   struct BANK_REQUEST {
     bool valid = false, row_buffer_hit = false;
@@ -46,6 +276,7 @@ struct DRAM_CHANNEL {
     uint64_t event_cycle = 0;
 
     queue_type::iterator pkt;
+    bool is_write = false;
   };
 
   using request_array_type = std::array<BANK_REQUEST, DRAM_RANKS * DRAM_BANKS>;
@@ -55,16 +286,27 @@ struct DRAM_CHANNEL {
   bool write_mode = false;
   uint64_t dbus_cycle_available = 0;
 
+  std::optional<dram_timing_model> timing;
+
+  // BLISS
+  uint32_t last_served_cpu = std::numeric_limits<uint32_t>::max();
+  unsigned served_streak = 0;
+  std::array<bool, NUM_CPUS> blacklisted = {};
+  uint64_t next_blacklist_clear = 0;
+
   using stats_type = dram_stats;
   std::vector<stats_type> roi_stats{}, sim_stats{};
 
   void check_collision();
+  void erase(bool is_write, std::size_t slot);
 };
 
 class MEMORY_CONTROLLER : public champsim::operable, public MemoryRequestConsumer
 {
   // Latencies
   const uint64_t tRP, tRCD, tCAS, DRAM_DBUS_TURN_AROUND_TIME, DRAM_DBUS_RETURN_TIME;
+  const dram_timing_spec timing_spec;
+  const dram_scheduler_spec scheduler_spec;
 
   // these values control when to send out a burst of writes
   constexpr static std::size_t DRAM_WRITE_HIGH_WM = ((DRAM_WQ_SIZE * 7) >> 3);         // 7/8th
@@ -74,7 +316,8 @@ class MEMORY_CONTROLLER : public champsim::operable, public MemoryRequestConsume
 public:
   std::array<DRAM_CHANNEL, DRAM_CHANNELS> channels;
 
-  MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround);
+  MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround, dram_timing_spec spec = {},
+                    dram_scheduler_spec scheduling = {});
 
   void initialize() override final;
   void operate() override final;
@@ -91,6 +334,10 @@ public:
 
   std::size_t size() const;
 
+  // slot of the next packet to schedule in the current mode, NONE if there is none
+  std::size_t next_schedule(DRAM_CHANNEL& channel);
+  void note_served(DRAM_CHANNEL& channel, const PACKET& packet);
+
   uint32_t dram_get_channel(uint64_t address);
   uint32_t dram_get_rank(uint64_t address);
   uint32_t dram_get_bank(uint64_t address);
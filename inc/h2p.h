@@ -8,6 +8,7 @@
 #include "profiler.h"
 #include "defines.h"
 #include "way_associative.h"
+#include "packed_tags.h"
 #include "ooo_cpu_modules.inc"
 
 #define H2P_SAT_COUNTER_BITS 16
@@ -16,16 +17,17 @@
 #define H2P_SETS 4096
 #define H2P_WAYS 8
 
+static_assert(H2P_SAT_COUNTER_BITS <= 16, "miss history is kept in 16 bits");
+static_assert(H2P_WAYS <= 8, "valid bits are kept in 8 bits");
+
 class H2P {
 private:
-  struct ENTRY {
-    uint64_t ip_tag;
-    uint64_t lru;
-    uint64_t miss_history = 0;
-  };
-
-  ENTRY ptable[H2P_SETS][H2P_WAYS];
-  uint64_t lru_counter;
+  // packed partial-tag table, one array per field so the tags of a set are contiguous for the way compare
+  // ~168KB instead of 768KB with full ip tags and 64-bit lru timestamps
+  alignas(16) uint16_t ip_tag[H2P_SETS][H2P_WAYS];
+  uint16_t miss_history[H2P_SETS][H2P_WAYS];
+  uint8_t lru_age[H2P_SETS][H2P_WAYS];
+  uint8_t valid[H2P_SETS];
 
 
 public:
@@ -33,42 +35,27 @@ public:
   H2P() {
     for (uint32_t i = 0; i < H2P_SETS; i++) {
       for (uint32_t j = 0; j < H2P_WAYS; j++) {
-        ptable[i][j].ip_tag = 0;
-        ptable[i][j].lru = 0;
-        ptable[i][j].miss_history = 0;
+        ip_tag[i][j] = 0;
+        miss_history[i][j] = 0;
+        lru_age[i][j] = j; // ages must stay a permutation of the ways
       }
+      valid[i] = 0;
     }
-    lru_counter = 0;
   }
 
-  ENTRY* find_entry(uint64_t ip)
+  int find_way(uint64_t set, uint64_t ip)
   {
-    uint64_t set = set_index(ip);
-    for (uint32_t i = 0; i < H2P_WAYS; i++) {
-      if (ptable[set][i].ip_tag == ip) {
-        return &(ptable[set][i]);
-      }
-    }
-    return NULL;
+    return packed_first_way(packed_tag_match<H2P_WAYS>(ip_tag[set], get_tag(ip)) & valid[set]);
   }
 
-  ENTRY* get_lru_entry(uint64_t set)
+  uint32_t get_lru_way(uint64_t set)
   {
-    uint32_t lru_way = 0;
-    uint64_t lru_value = ptable[set][lru_way].lru;
-    for (uint32_t i = 0; i < H2P_WAYS; i++) {
-      if (ptable[set][i].lru < lru_value) {
-        lru_way = i;
-        lru_value = ptable[set][lru_way].lru;
-      }
-    }
-    return &(ptable[set][lru_way]);
+    return packed_age_victim<H2P_WAYS>(lru_age[set], valid[set]);
   }
 
-  void update_lru(ENTRY* ptable)
+  void update_lru(uint64_t set, uint32_t way)
   {
-    ptable->lru = lru_counter;
-    lru_counter++;
+    packed_age_touch<H2P_WAYS>(lru_age[set], way);
   }
 
   bool is_h2p_branch_tage(ooo_model_instr& instr) {
@@ -134,16 +121,18 @@ public:
   }
 
   bool is_h2p_branch_table(uint64_t ip, int level) {
-    auto entry = find_entry(ip);
-    if (entry == NULL) {
+    uint64_t set = set_index(ip);
+    int way = find_way(set, ip);
+    if (way < 0) {
       return false;
     } else {
-      update_lru(entry);
-      return bitSelect(entry->miss_history, H2P_SAT_COUNTER_BITS);
+      update_lru(set, way);
+      return bitSelect(miss_history[set][way], H2P_SAT_COUNTER_BITS);
     }
   }
 
-  void UpdateBranchHistory(const ooo_model_instr instr) {
+  // only branches are tracked, the caller filters the retired instructions
+  void UpdateBranchHistory(const ooo_model_instr& instr) {
     if (instr.bp_prediction_src.source == BIMODAL) {
       bimodal_miss_hist = bimodal_miss_hist << 1;
       if (instr.branch_miss) {
@@ -157,17 +146,19 @@ public:
       }
     }
 
-    auto entry = find_entry(instr.ip);
-    if (entry == NULL) {
-      uint64_t set = set_index(instr.ip);
-      entry = get_lru_entry(set);
-      entry->ip_tag = instr.ip;
-      update_lru(entry);
+    uint64_t set = set_index(instr.ip);
+    int way = find_way(set, instr.ip);
+    if (way < 0) {
+      way = get_lru_way(set);
+      ip_tag[set][way] = get_tag(instr.ip);
+      miss_history[set][way] = 0;
+      valid[set] |= (1u << way);
+      update_lru(set, way);
     }
 
-    entry->miss_history = entry->miss_history << 1;
+    miss_history[set][way] = miss_history[set][way] << 1;
     if (instr.branch_miss) {
-      entry->miss_history += 1;
+      miss_history[set][way] += 1;
     }
   }
 
@@ -175,6 +166,10 @@ public:
     return (((ip >> 2)) & (H2P_SETS - 1));
   }
 
+  uint16_t get_tag(uint64_t ip) {
+    return packed_tag16((ip >> 2) / H2P_SETS);
+  }
+
   uint64_t bitSelect(uint64_t ip, int last_n)
   {
     uint64_t mask = (1 << last_n) - 1;
@@ -228,6 +228,7 @@ struct ooo_model_instr {
   bool hard_to_predict_branch = false;
   bool uop_cache_miss_panelty = false;
   bool uop_cache_hit = false;
+  bool from_loop_buffer = false; // streamed by the loop buffer, it bypassed the uop cache
   bool instr_after_branch_mispred = false;
 
   int yout = 0;
@@ -300,6 +301,7 @@ public:
 
     uop_cache_miss_panelty = false;
     uop_cache_hit = false;
+    from_loop_buffer = false;
 
     wrong_path = false;
     cycle_added_in_ftq = 0;
@@ -0,0 +1,88 @@
+#ifndef LOOP_BUFFER_H
+#define LOOP_BUFFER_H
+
+#include <cstdint>
+
+#include "defines.h"
+#include "instruction.h"
+#include "micro_op_cache.h"
+#include "profiler.h"
+
+// Loop stream detector in front of the micro-op cache.
+// A taken backward branch that closes the same loop body LOOP_BUFFER_MIN_ITERATIONS times in a row, with every
+// instruction of the iterations inside [target, branch] and at most LOOP_BUFFER_UOPS uops per iteration, locks the
+// loop in the loop buffer. The instructions of the body then stream from the buffer, LOOP_BUFFER_WIDTH per cycle,
+// without reading the uop cache (its ports are left to the other windows) or using the decoders. The first
+// instruction outside the body, the loop exit or a path through a call, unlocks the loop.
+
+#ifndef LOOP_BUFFER_UOPS
+#define LOOP_BUFFER_UOPS 64
+#endif
+#ifndef LOOP_BUFFER_MIN_ITERATIONS
+#define LOOP_BUFFER_MIN_ITERATIONS 8
+#endif
+#ifndef LOOP_BUFFER_WIDTH
+#define LOOP_BUFFER_WIDTH 6 // instructions per cycle
+#endif
+
+class LoopStreamDetector
+{
+private:
+  uint64_t branch_ip = 0; // backward branch of the candidate or locked loop
+  uint64_t target = 0;    // first instruction of its body
+  unsigned iterations = 0;
+  unsigned iteration_uops = 0;
+  bool in_body = false; // the current iteration stayed inside the body
+  bool locked = false;
+
+  bool InBody(uint64_t ip) const { return ip >= target && ip <= branch_ip; }
+
+public:
+  // the instruction at ip streams from the loop buffer
+  bool Streams(uint64_t ip) const { return locked && InBody(ip); }
+
+  // every instruction that reaches the uop cache or the loop buffer, in program order
+  void Observe(const ooo_model_instr& instr)
+  {
+    if (locked)
+    {
+      if (InBody(instr.ip))
+      {
+        return;
+      }
+      locked = false;
+      iterations = 0;
+      in_body = false;
+      get_profiler_ptr->loop_buffer.exits++;
+    }
+
+    iteration_uops += MicroOpCache::EstimateUops(instr);
+    in_body = in_body && InBody(instr.ip);
+
+    if (!instr.is_branch || !instr.branch_taken || instr.branch_target >= instr.ip)
+    {
+      return;
+    }
+
+    if (instr.ip == branch_ip && instr.branch_target == target && in_body && iteration_uops <= LOOP_BUFFER_UOPS)
+    {
+      iterations++;
+    }
+    else
+    {
+      branch_ip = instr.ip;
+      target = instr.branch_target;
+      iterations = 0;
+    }
+    iteration_uops = 0;
+    in_body = true;
+
+    if (iterations >= LOOP_BUFFER_MIN_ITERATIONS)
+    {
+      locked = true;
+      get_profiler_ptr->loop_buffer.locks++;
+    }
+  }
+};
+
+#endif // LOOP_BUFFER_H
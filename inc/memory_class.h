@@ -19,10 +19,13 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <vector>
 
+#include "msl/slab_allocator.h"
+#include "msl/small_vector.h"
 #include "util.h"
 
 enum access_type {
@@ -53,6 +56,7 @@ public:
   bool uop_pref = false;
   uint64_t by_ip = 0;
   bool nested_prefetch = false;
+  bool instruction = false; // instruction fetch or prefetch (L1I or uop cache), for the DRAM scheduler and the code lines of the caches
 
   uint8_t asid[2] = {std::numeric_limits<uint8_t>::max(), std::numeric_limits<uint8_t>::max()}, type = 0;
 
@@ -61,13 +65,23 @@ public:
 
   uint64_t address = 0, v_address = 0, data = 0, instr_id = 0, ip = 0, event_cycle = std::numeric_limits<uint64_t>::max(), cycle_enqueued = 0;
 
-  std::vector<std::reference_wrapper<ooo_model_instr>> instr_depend_on_me{};
-  std::vector<MemoryRequestProducer*> to_return{};
+  // inline up to a full fetch line of instructions and a few requesters, copies and merges of packets do not allocate
+  champsim::msl::small_vector<std::reference_wrapper<ooo_model_instr>, 16> instr_depend_on_me{};
+  champsim::msl::small_vector<MemoryRequestProducer*, 4> to_return{};
 
   std::size_t translation_level = 0;
   std::size_t init_translation_level = 0;
+  bool coalesced_walk = false; // page table walk that joined an in-flight walk, it holds no walker
+  uint8_t page_shift = 0; // log2 of the page size of a translation to a huge page, 0 for a base size page
+  bool page_not_present = false; // speculative walk of an unmapped page, dropped by the page table walker without a translation
 };
 
+// queues of in-flight packets, their nodes are recycled through the slab pool instead of the heap
+using packet_queue = std::deque<PACKET, champsim::msl::slab_allocator<PACKET>>;
+
+// union of the dependent instructions (kept in program order) and of the requesters to return to
+void merge_dependents(PACKET& destination, const PACKET& source);
+
 template <>
 struct is_valid<PACKET> {
   bool operator()(const PACKET& test) { return test.address != 0; }
@@ -3,9 +3,12 @@
 #define MICROOPCACHE
 
 #include <algorithm>
+#include <bitset>
 #include <deque>
 #include <iostream>
 #include <math.h>
+#include <memory>
+#include <optional>
 #include <tgmath.h>
 #include <vector>
 
@@ -13,8 +16,12 @@
 #include "defines.h"
 #include "instruction.h"
 #include "memory_class.h"
+#include "msl/bounded_hash_map.h"
 #include "operable.h"
+#include "prefetch_telemetry.h"
 #include "profiler.h"
+#include "replacement_state.h"
+#include "uop_pref_throttle.h"
 
 // 8 micro-ops per cycle instead of 6 and can hold 4K micro-ops, up from 2.25K before
 #define NUM_WAYS 8
@@ -22,6 +29,27 @@
 
 const int MAX_IPS_PER_WINDOW = SIZE_WINDOWS / 4; // remember to change it when the window changes
 
+// Uop count capacity model (UOP_CACHE_UOP_CAPACITY): a way holds up to UOP_CACHE_UOPS_PER_WAY uops of its window and
+// the uops of an instruction do not span ways, so a window takes as many ways as its uops need. A window over
+// UOP_CACHE_MAX_WAYS_PER_WINDOW ways or UOP_CACHE_MAX_UOPS_PER_WINDOW uops is not kept, its instructions always come
+// from the decoders. Without the model a way holds a whole window whatever its uops. The defines set the limits of the
+// global uop cache, see MicroOpCache::capacity_limits.
+#ifndef UOP_CACHE_UOPS_PER_WAY
+#define UOP_CACHE_UOPS_PER_WAY 6
+#endif
+#ifndef UOP_CACHE_MAX_WAYS_PER_WINDOW
+#define UOP_CACHE_MAX_WAYS_PER_WINDOW 3
+#endif
+#ifndef UOP_CACHE_MAX_UOPS_PER_WINDOW
+#define UOP_CACHE_MAX_UOPS_PER_WINDOW 18
+#endif
+#ifndef UOP_CACHE_MAX_UOPS_PER_INSTR
+#define UOP_CACHE_MAX_UOPS_PER_INSTR 4 // longer instructions are sequenced by the microcode ROM
+#endif
+#ifndef UOP_CACHE_UOP_COUNT_ENTRIES
+#define UOP_CACHE_UOP_COUNT_ENTRIES 16384 // per ip uop counts of the decoded instructions, for the prefetched ones
+#endif
+
 struct uop_cache_entry_t
 {
   uint64_t ip = 0;
@@ -42,9 +70,13 @@ struct uop_cache_entry_t
   bool permanent_pref_flag = false;
   uint8_t num_br = 0;
   bool active = true;
+  uint8_t num_uops = 0; // uops of the instructions of ips_in_window, with the uop count capacity model
+  uint8_t num_ips = 0;
 
   // ADDED THIS NEW FIELD:
   bool alternate_path_prefetch = false; // Set for branches predicted NOT TAKEN //TO UPDATE
+  uint64_t pref_by_ip = 0;              // H2P branch whose alternate path brought this window in
+  uint64_t pref_cycle = 0;              // when the window was prefetched
 };
 
 using uop_cache_t = std::vector<uop_cache_entry_t>;
@@ -52,7 +84,23 @@ using uop_cache_t = std::vector<uop_cache_entry_t>;
 class MicroOpCache
 {
 public:
-  MicroOpCache()
+  // limits of the uop count capacity model, the model is off when uops_per_way is 0
+  struct capacity_limits {
+    unsigned uops_per_way = 0;
+    unsigned max_ways_per_window = 0;
+    unsigned max_uops_per_window = 0;
+  };
+
+  static constexpr capacity_limits default_capacity()
+  {
+#ifdef UOP_CACHE_UOP_CAPACITY
+    return {UOP_CACHE_UOPS_PER_WAY, UOP_CACHE_MAX_WAYS_PER_WINDOW, UOP_CACHE_MAX_UOPS_PER_WINDOW};
+#else
+    return {};
+#endif
+  }
+
+  explicit MicroOpCache(capacity_limits limits = default_capacity()) : capacity(limits)
   {
     cout << "Uop cache of sets " << UOP_CACHE_NUM_SETS << " ways " << NUM_WAYS << " window " << SIZE_WINDOWS << " Total entries "
          << (UOP_CACHE_NUM_SETS * NUM_WAYS * (SIZE_WINDOWS / 4)) << endl;
@@ -60,10 +108,66 @@ public:
     window = SIZE_WINDOWS;
     ways = NUM_WAYS;
     UOP.resize(UOP_CACHE_NUM_SETS * NUM_WAYS);
+    if (capacity.uops_per_way > 0)
+    {
+      uops_of_ip.emplace();
+      uncacheable_windows.emplace();
+    }
   }
 
   ~MicroOpCache() {}
 
+#include "uop_cache_modules.inc"
+
+  // replacement modules under uop_replacement/, chosen by "uop_cache_replacement" of the core
+  std::bitset<NUM_UOP_REPLACEMENT_MODULES> uop_repl_type;
+
+  // state of a replacement module, constructed in its uop_initialize_replacement(), see CACHE::replacement_state()
+  template <typename T, typename... Args>
+  T& emplace_replacement_state(Args&&... args)
+  {
+    const auto slot = champsim::detail::replacement_state_slot<T>();
+    if (std::size(repl_states) <= slot)
+      repl_states.resize(slot + 1);
+    repl_states[slot] = std::make_shared<T>(std::forward<Args>(args)...);
+    return replacement_state<T>();
+  }
+
+  template <typename T>
+  T& replacement_state()
+  {
+    return *static_cast<T*>(repl_states[champsim::detail::replacement_state_slot<T>()].get());
+  }
+
+  // windows prefetched by the uop cache prefetcher: issued is a window inserted or marked by a prefetch, redundant a
+  // prefetch of a window that was already resident, late a demand miss on a window still in UOP_CACHE_MSHR
+  champsim::prefetch_telemetry pref_telemetry;
+
+  // Fused domain uops of an instruction, estimated from its operands as the trace has no uop count: one for the
+  // operation with a folded load, one more for a store after a load (read-modify-write), one per extra memory operand,
+  // one per register result beyond the first (MUL, DIV, XCHG) and one when more than three registers are read. The stack
+  // pointer, the flags and the instruction pointer are not counted, the stack engine and the branch units update them.
+  static unsigned EstimateUops(const ooo_model_instr& instr)
+  {
+    auto general = [](uint8_t reg) { return reg != champsim::REG_STACK_POINTER && reg != champsim::REG_FLAGS && reg != champsim::REG_INSTRUCTION_POINTER; };
+    const auto loads = std::size(instr.source_memory);
+    const auto stores = std::size(instr.destination_memory);
+    const auto reg_sources = static_cast<std::size_t>(std::count_if(std::begin(instr.source_registers), std::end(instr.source_registers), general));
+    const auto reg_results = static_cast<std::size_t>(std::count_if(std::begin(instr.destination_registers), std::end(instr.destination_registers), general));
+    std::size_t uops = 1;
+    if (loads > 0 && stores > 0)
+      uops++;
+    if (loads > 1)
+      uops += loads - 1;
+    if (stores > 1)
+      uops += stores - 1;
+    if (reg_results > 1)
+      uops += reg_results - 1;
+    if (reg_sources > 3)
+      uops++;
+    return static_cast<unsigned>(std::min<std::size_t>(uops, UOP_CACHE_MAX_UOPS_PER_INSTR));
+  }
+
   void UpdateHotness()
   {
     for_each(UOP.begin(), UOP.end(), [](uop_cache_entry_t &x)
@@ -118,6 +222,7 @@ public:
       if (in_mshr && !pref_completed)
       {
         get_profiler_ptr->stats_table[((ip >> lg2(window)) & STATS_TABLE_MASK)].late++;
+        pref_telemetry[champsim::prefetch_source::UOP_CACHE].late++;
       }
       if (!in_mshr && recently_pref)
       {
@@ -147,9 +252,24 @@ public:
     return hit;
   }
 
+  // every window of the cache line holding addr is resident
+  bool HoldsLine(uint64_t addr)
+  {
+    uint64_t line_begin = (addr >> LOG2_BLOCK_SIZE) << LOG2_BLOCK_SIZE;
+    for (uint64_t ip = line_begin; ip < line_begin + BLOCK_SIZE; ip += window)
+    {
+      if (!Ishit(ip))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   bool Lookup(uint64_t ip, uint64_t current_cycle)
   {
-    auto uop_set_begin = std::next(UOP.begin(), ((ip >> lg2(window)) % sets) * ways);
+    const uint64_t set = (ip >> lg2(window)) % sets;
+    auto uop_set_begin = std::next(UOP.begin(), set * ways);
     auto uop_set_end = std::next(uop_set_begin, ways);
     bool hit = false;
     for (auto way = uop_set_begin; way != uop_set_end; ++way)
@@ -172,16 +292,22 @@ public:
         if (way->pref && !way->used_once)
         {
           way->used_once = true;
+          pref_telemetry[champsim::prefetch_source::UOP_CACHE].useful++;
+          pref_telemetry[champsim::prefetch_source::UOP_CACHE].add_lead_time(current_cycle - way->pref_cycle);
           if (way->was_from_miss_br)
           {
             get_profiler_ptr->hpca.br_miss_used++;
           }
+#ifdef UOP_PREF_THROTTLE
+          m_uop_pref_throttle_ptr->OnPrefetchUsed(way->pref_by_ip);
+#endif
         }
         if (way->last_used != current_cycle)
         {
           way->hotness++;
           way->last_used = current_cycle;
         }
+        impl_uop_update_on_hit(set, std::distance(uop_set_begin, way), ip, current_cycle);
         break;
       }
     }
@@ -190,14 +316,54 @@ public:
   }
 
   // NEW signature - ADDED is_alternate_path parameter:
-  void Insert(uint64_t ip, uint64_t current_cycle, bool critical, bool taken_end, bool pref, bool was_br_miss, bool is_branch, bool is_alternate_path)
+  // by_ip is the H2P branch that issued the prefetch, used to report usefulness back to the throttle
+  // num_uops are the uops of the instruction for the capacity model, 0 when not decoded (see UopCount())
+  void Insert(uint64_t ip, uint64_t current_cycle, bool critical, bool taken_end, bool pref, bool was_br_miss, bool is_branch, bool is_alternate_path,
+              uint64_t by_ip = 0, unsigned num_uops = 0)
   {
-    auto uop_set_begin = std::next(UOP.begin(), ((ip >> lg2(window)) % sets) * ways);
+    bool low_priority = false;
+#ifdef UOP_PREF_THROTTLE
+    low_priority = pref && is_alternate_path && m_uop_pref_throttle_ptr->LowPriorityInsert(by_ip);
+#endif
+
+    const uint64_t set = (ip >> lg2(window)) % sets;
+    auto uop_set_begin = std::next(UOP.begin(), set * ways);
     auto uop_set_end = std::next(uop_set_begin, ways);
 
     bool tag_found = false;
     bool ip_found = false;
 
+    // uops the instruction adds to its window, none if the window already holds it
+    unsigned new_uops = 0;
+    unsigned window_ways = 0;
+    if (capacity.uops_per_way > 0)
+    {
+      if (uncacheable_windows->contains(getTag(ip)))
+      {
+        get_profiler_ptr->uop_capacity.uncacheable_inserts++;
+        return;
+      }
+
+      num_uops = UopCount(ip, num_uops);
+      unsigned window_uops = 0;
+      for (auto way = uop_set_begin; way != uop_set_end; ++way)
+      {
+        if (getTag(ip) == getTag(way->ip))
+        {
+          window_ways++;
+          window_uops += way->num_uops;
+          ip_found = ip_found || HoldsIp(*way, ip);
+        }
+      }
+      new_uops = ip_found ? 0 : num_uops;
+
+      if (window_uops + new_uops > capacity.max_uops_per_window)
+      {
+        DropWindow(uop_set_begin, uop_set_end, ip, pref, by_ip);
+        return;
+      }
+    }
+
     for (auto way = uop_set_begin; way != uop_set_end; ++way)
     {
       // check for the termination condition here
@@ -223,11 +389,17 @@ public:
         }
       }
 
+      // no room left in the way for the uops of the instruction, the window continues in another way
+      if (getTag(ip) == getTag(way->ip) && way->active && NoRoomFor(*way, new_uops))
+      {
+        way->active = false;
+      }
+
       // if next occurance the branch is predicted not taken then we do not need to terminate it anymore
       // if it is terminated we need to rest it
       // if the entry is terminated by 2 branches it will be rest at evictions
       // mostly taken branches will map to another entry anyways
-      if (getTag(ip) == getTag(way->ip) && !way->active && way->num_br < 2 && !taken_end)
+      if (getTag(ip) == getTag(way->ip) && !way->active && way->num_br < 2 && !taken_end && !NoRoomFor(*way, new_uops))
       {
         // the branch is not taken this time so activate the entry
         way->active = true;
@@ -251,20 +423,32 @@ public:
 
         tag_found = true;
 
+        if (new_uops > 0)
+          AddIp(*way, ip, new_uops);
+
         if (critical)
           way->is_critical = critical;
 
-        if (way->last_used != current_cycle)
+        // low priority prefetches do not promote the window, only a demand access does
+        if (!(low_priority && way->pref))
         {
-          way->hotness++;
-          way->last_used = current_cycle;
-          way->critical_hotness.increment();
+          if (way->last_used != current_cycle)
+          {
+            way->hotness++;
+            way->last_used = current_cycle;
+            way->critical_hotness.increment();
+          }
+          impl_uop_update_on_hit(set, std::distance(uop_set_begin, way), ip, current_cycle);
         }
-        // if not already pref mark pref
+        // if not already pref mark pref, the prefetch of a resident window is also counted as redundant
         if (!way->pref && pref)
         {
           way->pref = pref;
+          way->pref_by_ip = by_ip;
+          way->pref_cycle = current_cycle;
           get_profiler_ptr->uop_pref_stats.window_prefetched++;
+          pref_telemetry[champsim::prefetch_source::UOP_CACHE].issued++;
+          pref_telemetry[champsim::prefetch_source::UOP_CACHE].redundant++;
         }
         way->was_from_miss_br = was_br_miss;
         way->permanent_pref_flag = pref;
@@ -281,59 +465,23 @@ public:
 
     if (!tag_found)
     {
-      auto victim = uop_set_begin;
-#ifdef UOP_CACHE_LRU_RP
-      // victim = EvictLRU(uop_set_begin, uop_set_end);
-      // ADDED: EvictLRU_AlternatePath
-      victim = EvictLRU_AlternatePath(uop_set_begin, uop_set_end);
-#elif defined(UOP_CACHE_SMARTLRU_RP)
-      victim = SmartLRU(uop_set_begin, uop_set_end);
-#elif defined(UOP_CACHE_HOTLOOP_RP)
-      victim = Hotloop(uop_set_begin, uop_set_end);
-#elif defined(UOP_CACHE_LRUHOTLOOP_RP)
-      victim = EvictLRUHotness(uop_set_begin, uop_set_end);
-#elif defined(UOP_CACHE_LRUCRITICAL_RP)
-      victim = EvictLRUCritical(uop_set_begin, uop_set_end, critical);
-#elif defined(UOP_CACHE_HOTLOOPCRITICAL_RP)
-      victim = EvictHotloopCritical(uop_set_begin, uop_set_end, critical);
-#endif
-
-      if (victim->pref)
+      // the window needs one more way
+      if (capacity.uops_per_way > 0)
       {
-        if (victim->used_once)
-        {
-          get_profiler_ptr->m_eviction_stats.by_pref_used++;
-        }
-        else
+        if (window_ways >= capacity.max_ways_per_window)
         {
-          get_profiler_ptr->m_eviction_stats.by_pref_not_used++;
+          DropWindow(uop_set_begin, uop_set_end, ip, pref, by_ip);
+          return;
         }
+        if (window_ways > 0)
+          get_profiler_ptr->uop_capacity.continuation_ways++;
       }
-      else
-      {
-        get_profiler_ptr->m_eviction_stats.by_demand++;
-      }
-
-      // prefetch that were on the not the alternate path but is used
-      if (!victim->stats_already_counted)
-      {
-        victim->stats_already_counted = true;
 
-        // reuse even on wrong path
-        if (victim->on_wrong_h2p_path)
-        {
-          get_profiler_ptr->hpca.total_wrong_pref++;
-          if (victim->used_once)
-            get_profiler_ptr->hpca.wrong_uop_pref_used++;
-        }
-      }
+      auto victim = std::next(uop_set_begin, impl_uop_find_victim(set, &*uop_set_begin, ip, critical, pref));
+      assert(uop_set_begin <= victim);
+      assert(victim < uop_set_end);
 
-      if (victim->is_critical)
-      {
-        get_profiler_ptr->victim_critical_ways++;
-        if (victim->used_once)
-          get_profiler_ptr->victim_critical_ways_used++;
-      }
+      EvictWay(*victim, pref, by_ip);
 
       victim->ip = ip;
       victim->last_used = current_cycle;
@@ -342,6 +490,7 @@ public:
       victim->critical_hotness.max();
       victim->terminated_by_taken = false;
       victim->pref = pref;
+      victim->used_once = false;
       victim->was_from_miss_br = was_br_miss;
       victim->pref_stats_counter = false;
       victim->permanent_pref_flag = pref;
@@ -349,14 +498,34 @@ public:
       victim->on_wrong_h2p_path = false;
       victim->num_br = 0;
       victim->active = true;
+      victim->num_uops = 0;
+      victim->num_ips = 0;
+      if (new_uops > 0)
+        AddIp(*victim, ip, new_uops);
 
       // ADDED THIS: Set alternate path bit for new entry
       victim->alternate_path_prefetch = (pref && is_alternate_path);
+      victim->pref_by_ip = pref ? by_ip : 0;
 
       if (pref)
       {
+        victim->pref_cycle = current_cycle;
         get_profiler_ptr->uop_pref_stats.window_prefetched++;
+        pref_telemetry[champsim::prefetch_source::UOP_CACHE].issued++;
+#ifdef UOP_PREF_THROTTLE
+        m_uop_pref_throttle_ptr->OnPrefetchFill();
+#endif
       }
+
+      // low priority windows are inserted at the LRU position with no hotness
+      if (low_priority)
+      {
+        victim->last_used = 0;
+        victim->hotness = 0;
+        get_profiler_ptr->uop_throttle_stats.low_priority_inserts++;
+      }
+
+      impl_uop_update_on_insert(set, std::distance(uop_set_begin, victim), ip, current_cycle, pref, low_priority);
     }
   }
 
@@ -414,205 +583,119 @@ private:
 
   std::vector<unsigned long long> top_4;
 
-  uop_cache_t UOP{sets * ways};
+  uop_cache_t UOP; // sized by the constructor
 
   uint64_t last_ip_to_check_dib = 0;
 
-  uop_cache_t::iterator SmartLRU(uop_cache_t::iterator begin, uop_cache_t::iterator end)
-  {
-    for (auto it = begin; it != end; ++it)
-    {
-      if (!it->is_valid)
-      {
-        return it;
-      }
-    }
+  std::vector<std::shared_ptr<void>> repl_states; // state of the replacement modules, see replacement_state()
 
-    return std::min_element(begin, end, [](uop_cache_entry_t &a, uop_cache_entry_t &b)
-                            { return a.last_used < b.last_used; });
-  }
+  capacity_limits capacity;
 
-  uop_cache_t::iterator EvictLRU(uop_cache_t::iterator begin, uop_cache_t::iterator end)
-  {
-    return std::min_element(begin, end, [](uop_cache_entry_t &a, uop_cache_entry_t &b)
-                            { return a.last_used < b.last_used; });
-  }
+  // with the capacity model only
+  std::optional<champsim::msl::bounded_hash_map<uint64_t, uint8_t, UOP_CACHE_UOP_COUNT_ENTRIES>> uops_of_ip;
+  std::optional<champsim::msl::bounded_hash_map<uint64_t, bool, UOP_CACHE_UOP_COUNT_ENTRIES / 4>> uncacheable_windows; // by tag
 
-  // ADDED: LRU with alternate path priority
-  // uop_cache_t::iterator EvictLRU_AlternatePath(uop_cache_t::iterator begin, uop_cache_t::iterator end)
-  // {
-    // Check if any alternate path prefetch entries exist in this set
-  //   bool has_alternate_path = std::any_of(begin, end,
-  //     [](const uop_cache_entry_t& entry) {
-  //       return entry.alternate_path_prefetch;
-  //     });
-
-  //   // Find victim: prioritize alternate path entries, then use LRU within category
-  //   return std::min_element(begin, end,
-  //     [has_alternate_path](const uop_cache_entry_t& a, const uop_cache_entry_t& b) {
-  //       // If alternate path entries exist in this set
-  //       if (has_alternate_path) {
-  //         // Prioritize evicting alternate path entries
-  //         if (a.alternate_path_prefetch != b.alternate_path_prefetch) {
-  //           return a.alternate_path_prefetch;  // Evict 'a' if it has alternate bit
-  //         }
-  //       }
-        // Among same category (both alternate or both regular), use LRU
-  //       return a.last_used < b.last_used;
-  //     });
-  // }
-  uop_cache_t::iterator EvictLRU_AlternatePath(uop_cache_t::iterator begin, uop_cache_t::iterator end)
+  // uops of the instruction at ip, the decoded counts are kept for the prefetched instructions that come without
+  unsigned UopCount(uint64_t ip, unsigned decoded_uops)
   {
-    std::vector<std::pair<uop_cache_t::iterator, uint64_t>> entries;
-
-    // Collect all entries with their last_used values
-    for (auto it = begin; it != end; ++it)
+    if (decoded_uops > 0)
     {
-      entries.push_back({it, it->last_used});
+      (*uops_of_ip)[ip] = static_cast<uint8_t>(decoded_uops);
+      return decoded_uops;
     }
-
-    // Sort by last_used to find LRU-4
-    std::sort(entries.begin(), entries.end(),
-              [](const auto &a, const auto &b)
-              {
-                return a.second < b.second;
-              });
-
-    // Only consider the 4 least recently used entries
-    auto lru4_end = entries.begin() + std::min(4UL, entries.size());
-
-    // Among LRU-4, prioritize alternate path entries, then use LRU
-    auto victim = std::min_element(entries.begin(), lru4_end,
-                                   [](const auto &a, const auto &b)
-                                   {
-                                     // First priority: alternate path entries
-                                     if (a.first->alternate_path_prefetch != b.first->alternate_path_prefetch)
-                                     {
-                                       return a.first->alternate_path_prefetch;
-                                     }
-                                     // Second priority: LRU within same category
-                                     return a.second < b.second;
-                                   });
-
-    return victim->first;
-  }
-
-  uop_cache_t::iterator Hotloop(uop_cache_t::iterator begin, uop_cache_t::iterator end)
-  {
-    return std::min_element(begin, end, [](uop_cache_entry_t &a, uop_cache_entry_t &b)
-                            { return a.hotness < b.hotness; });
-  }
-
-  uop_cache_t::iterator EvictLRUHotness(uop_cache_t::iterator begin, uop_cache_t::iterator end)
-  {
-    std::vector<uint64_t> last_used_vector;
-
-    for (auto it = begin; it != end; ++it)
+    if (auto known = uops_of_ip->find(ip); known != nullptr)
     {
-      last_used_vector.push_back((*it).last_used);
+      return *known;
     }
+    get_profiler_ptr->uop_capacity.uop_count_unknown++;
+    return 1;
+  }
 
-    assert(last_used_vector.size() == ways);
-
-    std::sort(last_used_vector.begin(), last_used_vector.end());
-    std::vector<uint64_t> least_4(last_used_vector.begin(), last_used_vector.begin() + 4);
-
-    auto victim = begin;
-
-    for (auto it = begin; it != end; ++it)
+  // the window of ip is over the limits, its ways are evicted and it is no longer inserted
+  void DropWindow(uop_cache_t::iterator begin, uop_cache_t::iterator end, uint64_t ip, bool pref, uint64_t by_ip)
+  {
+    for (auto way = begin; way != end; ++way)
     {
-      for (auto &x : least_4)
+      if (getTag(ip) == getTag(way->ip))
       {
-        if ((*it).last_used == x && (*it).hotness < (*victim).hotness)
-        {
-          victim = it;
-        }
+        EvictWay(*way, pref, by_ip);
+        *way = uop_cache_entry_t{};
       }
     }
-
-    assert(begin <= victim);
-    assert(victim < end);
-    return victim;
+    (*uncacheable_windows)[getTag(ip)] = true;
+    get_profiler_ptr->uop_capacity.uncacheable_windows++;
   }
 
-  uop_cache_t::iterator EvictLRUCritical(uop_cache_t::iterator begin, uop_cache_t::iterator end, bool critical)
+  // eviction bookkeeping of a way about to be overwritten or dropped, pref and by_ip describe the insert that evicts it
+  void EvictWay(uop_cache_entry_t& way, bool pref, uint64_t by_ip)
   {
-    std::vector<uop_cache_entry_t> set_vec;
-    for (auto it = begin; it != end; ++it)
-    {
-      set_vec.push_back(*it);
-    }
-    assert(set_vec.size() == ways);
-    std::sort(set_vec.begin(), set_vec.end(), compare_lru);
-    std::vector<uop_cache_entry_t> least_4(set_vec.begin(), set_vec.begin() + 4);
-
-    // try to remove least 4 lru which is not critical
-    for (auto x = least_4.begin(); x != least_4.end(); ++x)
+    if (way.pref)
     {
-      for (auto it = begin; it != end; ++it)
+      if (way.used_once)
       {
-        if ((x->ip == it->ip && x->last_used == it->last_used && !it->is_critical))
-        {
-          return it;
-        }
+        get_profiler_ptr->m_eviction_stats.by_pref_used++;
+      }
+      else
+      {
+        get_profiler_ptr->m_eviction_stats.by_pref_not_used++;
+        pref_telemetry[champsim::prefetch_source::UOP_CACHE].early++;
+#ifdef UOP_PREF_THROTTLE
+        m_uop_pref_throttle_ptr->OnPrefetchUnused(way.pref_by_ip);
+#endif
       }
     }
-
-    // if above does not find any way try to remove any lru with no confident
-    for (auto x = set_vec.begin(); x != set_vec.end(); ++x)
+    else
     {
-      for (auto it = begin; it != end; ++it)
+      get_profiler_ptr->m_eviction_stats.by_demand++;
+#ifdef UOP_PREF_THROTTLE
+      // prefetch induced eviction of a demand window
+      if (pref && way.ip != 0)
       {
-        if ((x->ip == it->ip && x->last_used == it->last_used && it->is_critical && !it->critical_hotness.confident()))
-        {
-          return it;
-        }
+        m_uop_pref_throttle_ptr->OnDemandEvicted(by_ip);
       }
+#endif
     }
 
-    // if all fails remove the lru
-    return std::min_element(begin, end, [](uop_cache_entry_t &a, uop_cache_entry_t &b)
-                            { return a.last_used < b.last_used; });
-  }
-
-  uop_cache_t::iterator EvictHotloopCritical(uop_cache_t::iterator begin, uop_cache_t::iterator end, bool critical)
-  {
-    std::vector<uop_cache_entry_t> set_vec;
-    for (auto it = begin; it != end; ++it)
+    // prefetch that were on the not the alternate path but is used
+    if (!way.stats_already_counted)
     {
-      set_vec.push_back(*it);
-    }
-    assert(set_vec.size() == ways);
-    std::sort(set_vec.begin(), set_vec.end(), compare_hotness);
-    std::vector<uop_cache_entry_t> least_4(set_vec.begin(), set_vec.begin() + 4);
+      way.stats_already_counted = true;
 
-    for (auto x = least_4.begin(); x != least_4.end(); ++x)
-    {
-      for (auto it = begin; it != end; ++it)
+      // reuse even on wrong path
+      if (way.on_wrong_h2p_path)
       {
-        if (x->ip == it->ip && x->hotness == it->hotness && !it->is_critical)
-          return it;
+        get_profiler_ptr->hpca.total_wrong_pref++;
+        if (way.used_once)
+          get_profiler_ptr->hpca.wrong_uop_pref_used++;
       }
     }
 
-    for (auto x = set_vec.begin(); x != set_vec.end(); ++x)
+    if (way.is_critical)
     {
-      for (auto it = begin; it != end; ++it)
-      {
-        if ((x->ip == it->ip && x->hotness == it->hotness && it->is_critical && !it->critical_hotness.confident()))
-        {
-          return it;
-        }
-      }
+      get_profiler_ptr->victim_critical_ways++;
+      if (way.used_once)
+        get_profiler_ptr->victim_critical_ways_used++;
     }
+  }
 
-    return std::min_element(begin, end, [](uop_cache_entry_t &a, uop_cache_entry_t &b)
-                            { return a.hotness < b.hotness; });
+  bool HoldsIp(const uop_cache_entry_t& way, uint64_t ip) const
+  {
+    return std::find(way.ips_in_window, way.ips_in_window + way.num_ips, ip) != way.ips_in_window + way.num_ips;
   }
 
-  static bool compare_lru(uop_cache_entry_t &a, uop_cache_entry_t &b) { return a.last_used < b.last_used; }
+  void AddIp(uop_cache_entry_t& way, uint64_t ip, unsigned uops)
+  {
+    if (way.num_ips < MAX_IPS_PER_WINDOW)
+    {
+      way.ips_in_window[way.num_ips++] = ip;
+    }
+    way.num_uops = static_cast<uint8_t>(way.num_uops + uops);
+    get_profiler_ptr->uop_capacity.instrs_inserted++;
+    get_profiler_ptr->uop_capacity.uops_inserted += uops;
+  }
 
-  static bool compare_hotness(uop_cache_entry_t &a, uop_cache_entry_t &b) { return a.hotness < b.hotness; }
+  // always false without the capacity model, the instructions then add no uops
+  bool NoRoomFor(const uop_cache_entry_t& way, unsigned uops) const { return uops > 0 && way.num_uops + uops > capacity.uops_per_way; }
 
   uint64_t getTag(uint64_t ip) { return (ip >> lg2(window)); }
 };
@@ -0,0 +1,67 @@
+#ifndef MSL_BLOOM_FILTER_H
+#define MSL_BLOOM_FILTER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace champsim::msl
+{
+  // Bloom filter over 64 bit keys: contains() has no false negatives, and false positives at a rate set by the number
+  // of bits per inserted key. Keys cannot be removed, the filter is cleared as a whole.
+  class bloom_filter
+  {
+    std::vector<uint64_t> words;
+    std::size_t mask;
+    unsigned hashes;
+    std::size_t inserted = 0;
+
+    // double hashing, the i-th probe is h1 + i*h2 with an odd h2
+    template <typename F>
+    void for_each_bit(uint64_t key, F&& f) const
+    {
+      uint64_t h = key * 0x9E3779B97F4A7C15ull;
+      uint64_t h1 = h ^ (h >> 29);
+      uint64_t h2 = ((key ^ (key >> 31)) * 0xBF58476D1CE4E5B9ull) | 1;
+      for (unsigned i = 0; i < hashes; ++i, h1 += h2)
+        f(static_cast<std::size_t>(h1) & mask);
+    }
+
+  public:
+    // the number of bits is rounded up to a power of two
+    explicit bloom_filter(std::size_t bits = 4096, unsigned num_hashes = 3) : hashes(num_hashes)
+    {
+      std::size_t capacity = 64;
+      while (capacity < bits)
+        capacity <<= 1;
+      words.resize(capacity / 64);
+      mask = capacity - 1;
+    }
+
+    void insert(uint64_t key)
+    {
+      for_each_bit(key, [this](std::size_t bit) { words[bit / 64] |= uint64_t{1} << (bit % 64); });
+      inserted++;
+    }
+
+    bool contains(uint64_t key) const
+    {
+      bool found = true;
+      for_each_bit(key, [this, &found](std::size_t bit) { found = found && ((words[bit / 64] >> (bit % 64)) & 1); });
+      return found;
+    }
+
+    void clear()
+    {
+      std::fill(std::begin(words), std::end(words), 0);
+      inserted = 0;
+    }
+
+    // keys inserted since the last clear
+    std::size_t size() const { return inserted; }
+    std::size_t bits() const { return mask + 1; }
+  };
+} // namespace champsim::msl
+
+#endif
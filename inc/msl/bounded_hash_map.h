@@ -0,0 +1,140 @@
+#ifndef MSL_BOUNDED_HASH_MAP_H
+#define MSL_BOUNDED_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace champsim::msl
+{
+  // Fixed capacity open-addressing hash map for the simulator side tables (keyed by ip, instr id, ...).
+  // A key lives in one of the PROBE slots following its home slot, so a lookup touches at most PROBE contiguous slots
+  // and the table never grows. When all PROBE slots are taken an insert evicts:
+  //   - the least recently used slot of the probe window if LRU_EVICT
+  //   - the home slot otherwise (direct mapped replacement)
+  // Slots are allocated once at construction, there are no per-insert allocations.
+  template <typename Key, typename T, std::size_t SLOTS, std::size_t PROBE = 8, bool LRU_EVICT = true, typename Hash = std::hash<Key>>
+  class bounded_hash_map
+  {
+    static_assert(SLOTS > 0 && (SLOTS & (SLOTS - 1)) == 0, "number of slots must be a power of two");
+    static_assert(PROBE > 0 && PROBE <= SLOTS, "probe window must fit in the table");
+
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+
+  private:
+    struct slot_t {
+      key_type key{};
+      mapped_type value{};
+      uint64_t last_used = 0;
+      bool valid = false;
+    };
+
+    std::vector<slot_t> slots{SLOTS};
+    Hash hasher;
+    uint64_t access_count = 0;
+    std::size_t occupancy = 0;
+    uint64_t num_evictions = 0;
+
+    std::size_t home_slot(const key_type& key) const
+    {
+      // std::hash of integers is the identity, mix it so that aligned ips spread over the table
+      uint64_t h = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+      return static_cast<std::size_t>(h ^ (h >> 32)) & (SLOTS - 1);
+    }
+
+    slot_t& slot_at(std::size_t home, std::size_t i) { return slots[(home + i) & (SLOTS - 1)]; }
+
+    slot_t* find_slot(const key_type& key)
+    {
+      std::size_t home = home_slot(key);
+      for (std::size_t i = 0; i < PROBE; i++) {
+        slot_t& s = slot_at(home, i);
+        if (s.valid && s.key == key) {
+          return &s;
+        }
+      }
+      return nullptr;
+    }
+
+  public:
+    // pointer to the value or nullptr, does not insert
+    mapped_type* find(const key_type& key)
+    {
+      slot_t* s = find_slot(key);
+      if (s == nullptr) {
+        return nullptr;
+      }
+      s->last_used = ++access_count;
+      return &s->value;
+    }
+
+    bool contains(const key_type& key) { return find_slot(key) != nullptr; }
+
+    // same semantics as std::map::operator[] except that an insert may evict another key
+    mapped_type& operator[](const key_type& key)
+    {
+      if (slot_t* s = find_slot(key); s != nullptr) {
+        s->last_used = ++access_count;
+        return s->value;
+      }
+
+      std::size_t home = home_slot(key);
+      slot_t* victim = nullptr;
+      for (std::size_t i = 0; i < PROBE && victim == nullptr; i++) {
+        if (!slot_at(home, i).valid) {
+          victim = &slot_at(home, i);
+        }
+      }
+
+      if (victim == nullptr) {
+        victim = &slot_at(home, 0);
+        if constexpr (LRU_EVICT) {
+          for (std::size_t i = 1; i < PROBE; i++) {
+            if (slot_at(home, i).last_used < victim->last_used) {
+              victim = &slot_at(home, i);
+            }
+          }
+        }
+        num_evictions++;
+      } else {
+        occupancy++;
+      }
+
+      victim->key = key;
+      victim->value = mapped_type{};
+      victim->valid = true;
+      victim->last_used = ++access_count;
+      return victim->value;
+    }
+
+    bool erase(const key_type& key)
+    {
+      slot_t* s = find_slot(key);
+      if (s == nullptr) {
+        return false;
+      }
+      s->valid = false;
+      s->value = mapped_type{};
+      occupancy--;
+      return true;
+    }
+
+    void clear()
+    {
+      for (auto& s : slots) {
+        s = slot_t{};
+      }
+      occupancy = 0;
+    }
+
+    std::size_t size() const { return occupancy; }
+    bool empty() const { return occupancy == 0; }
+    static constexpr std::size_t capacity() { return SLOTS; }
+    uint64_t evictions() const { return num_evictions; }
+  };
+} // namespace champsim::msl
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef MSL_FLAT_HASH_MAP_H
+#define MSL_FLAT_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace champsim::msl
+{
+  // Open-addressing (linear probing) hash map for tables that only grow, like the page tables of the virtual memory.
+  // Unlike bounded_hash_map nothing is ever evicted: the table doubles when it is 3/4 full.
+  // Keys and values live in one flat array, so a lookup is a hash and a short scan of contiguous slots.
+  template <typename Key, typename T, typename Hash = std::hash<Key>>
+  class flat_hash_map
+  {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+
+  private:
+    struct slot_t {
+      key_type key{};
+      mapped_type value{};
+      bool valid = false;
+    };
+
+    std::vector<slot_t> slots;
+    Hash hasher;
+    std::size_t occupancy = 0;
+
+    std::size_t home_slot(const key_type& key) const
+    {
+      uint64_t h = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+      return static_cast<std::size_t>(h ^ (h >> 32)) & (std::size(slots) - 1);
+    }
+
+    // slot holding the key, or the empty slot where it would be inserted
+    slot_t& probe(const key_type& key)
+    {
+      auto mask = std::size(slots) - 1;
+      for (auto i = home_slot(key);; i = (i + 1) & mask) {
+        if (!slots[i].valid || slots[i].key == key)
+          return slots[i];
+      }
+    }
+
+    void grow()
+    {
+      std::vector<slot_t> old(std::size(slots) * 2);
+      std::swap(old, slots);
+      for (auto& s : old) {
+        if (s.valid)
+          probe(s.key) = std::move(s);
+      }
+    }
+
+  public:
+    // the capacity is rounded up to a power of two
+    explicit flat_hash_map(std::size_t initial_slots = 1024)
+    {
+      std::size_t capacity = 2;
+      while (capacity < initial_slots)
+        capacity <<= 1;
+      slots.resize(capacity);
+    }
+
+    mapped_type* find(const key_type& key)
+    {
+      slot_t& s = probe(key);
+      return s.valid ? &s.value : nullptr;
+    }
+
+    // same semantics as std::map::try_emplace: the value is only stored if the key is not present
+    std::pair<mapped_type*, bool> try_emplace(const key_type& key, const mapped_type& value)
+    {
+      if (slot_t& s = probe(key); s.valid)
+        return {&s.value, false};
+
+      if ((occupancy + 1) * 4 > std::size(slots) * 3)
+        grow();
+
+      slot_t& s = probe(key);
+      s.key = key;
+      s.value = value;
+      s.valid = true;
+      occupancy++;
+      return {&s.value, true};
+    }
+
+    std::size_t size() const { return occupancy; }
+    bool empty() const { return occupancy == 0; }
+  };
+} // namespace champsim::msl
+
+#endif
@@ -142,6 +142,18 @@ namespace champsim::msl
       return hit->data;
     }
 
+    // lookup that leaves the replacement state untouched
+    std::optional<value_type> peek(const value_type& elem)
+    {
+      auto [set_begin, set_end] = get_set_span(elem);
+      auto hit = std::find_if(set_begin, set_end, match_func(elem));
+
+      if (hit == set_end)
+        return std::nullopt;
+
+      return hit->data;
+    }
+
     uint64_t check_hit_tmp(const value_type& elem)
     {
       auto [set_begin, set_end] = get_set_span_tmp(elem);
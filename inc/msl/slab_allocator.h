@@ -0,0 +1,105 @@
+#ifndef MSL_SLAB_ALLOCATOR_H
+#define MSL_SLAB_ALLOCATOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace champsim::msl
+{
+  // Free lists of fixed size blocks carved out of large slabs. A freed block goes back to the free list of its size
+  // class and is reused by the next allocation of that size, slabs are only released at the end of the simulation.
+  // The simulator is single threaded, there is one pool per process.
+  class slab_pool
+  {
+  public:
+    static constexpr std::size_t GRANULE = 16;     // block sizes are multiples of this, and so is their alignment
+    static constexpr std::size_t MAX_BLOCK = 4096; // larger requests go to operator new
+    static constexpr std::size_t SLAB_BYTES = 64 * 1024;
+
+    static slab_pool& instance()
+    {
+      // never destroyed, the queues of the global simulator objects free their packets during static destruction
+      static slab_pool* pool = new slab_pool;
+      return *pool;
+    }
+
+    void* allocate(std::size_t bytes)
+    {
+      if (bytes > MAX_BLOCK)
+        return ::operator new(bytes);
+
+      auto size_class = class_of(bytes);
+      if (free_lists[size_class] == nullptr)
+        refill(size_class);
+
+      free_block* block = free_lists[size_class];
+      free_lists[size_class] = block->next;
+      return block;
+    }
+
+    void deallocate(void* p, std::size_t bytes)
+    {
+      if (bytes > MAX_BLOCK) {
+        ::operator delete(p);
+        return;
+      }
+
+      auto size_class = class_of(bytes);
+      free_lists[size_class] = ::new (p) free_block{free_lists[size_class]};
+    }
+
+  private:
+    struct free_block {
+      free_block* next;
+    };
+
+    std::array<free_block*, MAX_BLOCK / GRANULE> free_lists = {};
+    std::vector<std::unique_ptr<std::byte[]>> slabs;
+
+    static std::size_t class_of(std::size_t bytes) { return (std::max<std::size_t>(bytes, 1) - 1) / GRANULE; }
+
+    void refill(std::size_t size_class)
+    {
+      const std::size_t block_bytes = (size_class + 1) * GRANULE;
+      slabs.push_back(std::make_unique<std::byte[]>(SLAB_BYTES));
+      std::byte* slab = slabs.back().get();
+      for (std::size_t offset = 0; offset + block_bytes <= SLAB_BYTES; offset += block_bytes)
+        free_lists[size_class] = ::new (slab + offset) free_block{free_lists[size_class]};
+    }
+  };
+
+  // Standard allocator over the slab pool, for the node based containers that churn through packets (std::deque
+  // allocates one node per packet once a packet is larger than its 512 byte node size).
+  template <typename T>
+  struct slab_allocator {
+    static_assert(alignof(T) <= slab_pool::GRANULE, "slab blocks are only aligned to the granule");
+
+    using value_type = T;
+
+    slab_allocator() = default;
+    template <typename U>
+    slab_allocator(const slab_allocator<U>&)
+    {
+    }
+
+    T* allocate(std::size_t n) { return static_cast<T*>(slab_pool::instance().allocate(n * sizeof(T))); }
+    void deallocate(T* p, std::size_t n) { slab_pool::instance().deallocate(p, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const slab_allocator<U>&) const
+    {
+      return true;
+    }
+    template <typename U>
+    bool operator!=(const slab_allocator<U>&) const
+    {
+      return false;
+    }
+  };
+} // namespace champsim::msl
+
+#endif
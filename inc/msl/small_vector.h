@@ -0,0 +1,168 @@
+#ifndef MSL_SMALL_VECTOR_H
+#define MSL_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace champsim::msl
+{
+  // Vector with the first N elements stored inline, for the short lists carried by the packets (dependent instructions,
+  // return targets). Copying or merging a list that fits in N elements never touches the heap, a longer list spills
+  // to a heap buffer like std::vector. Only for trivially copyable elements (pointers, reference wrappers).
+  template <typename T, std::size_t N>
+  class small_vector
+  {
+    static_assert(N > 0, "inline capacity must not be zero");
+    static_assert(std::is_trivially_copyable_v<T>, "small_vector elements are copied bitwise");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+  private:
+    alignas(T) unsigned char inline_storage[N * sizeof(T)];
+    T* heap = nullptr;
+    size_type count = 0;
+    size_type cap = N;
+
+    void grow(size_type min_capacity)
+    {
+      size_type new_cap = std::max(min_capacity, 2 * cap);
+      T* new_heap = std::allocator<T>{}.allocate(new_cap);
+      std::uninitialized_copy(begin(), end(), new_heap);
+      release();
+      heap = new_heap;
+      cap = new_cap;
+    }
+
+    void release()
+    {
+      if (heap != nullptr)
+        std::allocator<T>{}.deallocate(heap, cap);
+      heap = nullptr;
+      cap = N;
+    }
+
+  public:
+    small_vector() = default;
+    small_vector(std::initializer_list<T> init) { assign(std::begin(init), std::end(init)); }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    small_vector(InputIt first, InputIt last)
+    {
+      assign(first, last);
+    }
+
+    small_vector(const small_vector& other) { assign(std::begin(other), std::end(other)); }
+
+    small_vector(small_vector&& other) noexcept { *this = std::move(other); }
+
+    ~small_vector() { release(); }
+
+    small_vector& operator=(const small_vector& other)
+    {
+      if (this != &other)
+        assign(std::begin(other), std::end(other));
+      return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept
+    {
+      if (this == &other)
+        return *this;
+
+      release();
+      if (other.heap != nullptr) {
+        // steal the heap buffer
+        heap = std::exchange(other.heap, nullptr);
+        cap = std::exchange(other.cap, N);
+      } else {
+        std::uninitialized_copy(std::begin(other), std::end(other), data());
+      }
+      count = std::exchange(other.count, 0);
+      return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<T> init)
+    {
+      assign(std::begin(init), std::end(init));
+      return *this;
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+      clear();
+      for (; first != last; ++first)
+        push_back(*first);
+    }
+
+    T* data() { return heap != nullptr ? heap : std::launder(reinterpret_cast<T*>(inline_storage)); }
+    const T* data() const { return heap != nullptr ? heap : std::launder(reinterpret_cast<const T*>(inline_storage)); }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + count; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + count; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_type size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_type capacity() const { return cap; }
+    static constexpr size_type inline_capacity() { return N; }
+
+    T& operator[](size_type i) { return data()[i]; }
+    const T& operator[](size_type i) const { return data()[i]; }
+    T& front() { return data()[0]; }
+    const T& front() const { return data()[0]; }
+    T& back() { return data()[count - 1]; }
+    const T& back() const { return data()[count - 1]; }
+
+    void reserve(size_type new_cap)
+    {
+      if (new_cap > cap)
+        grow(new_cap);
+    }
+
+    void push_back(const T& value)
+    {
+      if (count == cap) {
+        T copy = value; // value may live in the buffer being replaced
+        grow(count + 1);
+        ::new (static_cast<void*>(data() + count)) T(copy);
+      } else {
+        ::new (static_cast<void*>(data() + count)) T(value);
+      }
+      count++;
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      auto pos = begin() + (first - cbegin());
+      std::copy(begin() + (last - cbegin()), end(), pos);
+      count -= static_cast<size_type>(last - first);
+      return pos;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+    // the heap buffer, if any, is kept for reuse
+    void clear() { count = 0; }
+  };
+} // namespace champsim::msl
+
+#endif
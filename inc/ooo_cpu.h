@@ -34,7 +34,10 @@
 #include "champsim_constants.h"
 #include "h2p.h"
 #include "instruction.h"
+#include "loop_buffer.h"
 #include "memory_class.h"
+#include "micro_op_cache.h"
+#include "msl/bounded_hash_map.h"
 #include "operable.h"
 #include "profiler.h"
 #include "target_table.h"
@@ -50,6 +53,12 @@
 
 enum STATUS { INFLIGHT = 1, COMPLETED = 2 };
 
+// capacity of the ip keyed side tables of the core, they are bounded and evict LRU when full
+#define SIDE_TABLE_ENTRIES 16384
+
+template <typename T, std::size_t SLOTS = SIDE_TABLE_ENTRIES>
+using side_table = champsim::msl::bounded_hash_map<uint64_t, T, SLOTS>;
+
 enum FETCH_MODE { STREAM = 1, BUILD = 2 };
 
 enum PATH_MODE { WRONG = 1, RIGHT = 2 };
@@ -59,7 +68,7 @@ class CacheBus : public MemoryRequestProducer
   uint32_t cpu;
 
 public:
-  std::deque<PACKET> PROCESSED;
+  packet_queue PROCESSED;
   CacheBus(uint32_t cpu_idx, MemoryRequestConsumer* ll) : MemoryRequestProducer(ll), cpu(cpu_idx) {}
   bool issue_read(PACKET packet);
   bool is_rq_free();
@@ -157,6 +166,7 @@ public:
     uint8_t br_type = 0;
     bool taken = false;
     bool is_alternate_path = false;  // ADDED THIS FIELD
+    uint64_t by_ip = 0;
   };
 
   struct path_entry_m {
@@ -182,15 +192,20 @@ public:
     bool dib_contention_checked = false;
     bool btb_contention_checked = false;
   };
-  std::deque<alternate_path_info> ALT_PATH_TABLE;
 
-  struct tmp_return_entry {
-    uint64_t counter = 0;
+  // one prediction of the decoupled front end: the sequential instructions from start_ip up to the first branch that
+  // ends the block (or max_instrs), the branch included
+  struct fetch_block_info {
+    uint64_t start_ip = 0;
+    uint64_t num_instrs = 0;
+    uint64_t branch_ip = 0; // 0 if no branch ends the block
     uint64_t target = 0;
-    uint64_t bb_size = 0;
+    uint8_t branch_type = NOT_BRANCH;
+    bool taken = false;
+    int h2p_ctr = 0;            // alternate predictor H2P counter of the branch (level 1 only)
+    uint64_t next_bb_size = 0; // bb size stored in the BTB for the predicted direction of the branch, 0 if unknown
   };
-
-  std::map<uint64_t, tmp_return_entry> tmp_return_map;
+  std::deque<alternate_path_info> ALT_PATH_TABLE;
 
   std::deque<path_entry_m> ongoing_path_info;
   std::deque<uint64_t> recent_nested_prefetches;
@@ -203,9 +218,6 @@ public:
   const std::size_t dib_set, dib_way, dib_window;
   TargetTable<1024, 4> h2p_tt;
 
-  std::map<uint64_t, uint8_t> pref_stop_map;
-  std::map<uint64_t, uint64_t> h2p_tt_map;
-
   // instruction buffer
   using dib_t = std::vector<dib_entry_t>;
   dib_t DIB_profile{32 * 8};
@@ -232,13 +244,15 @@ public:
 
   uint64_t last_instr_to_update_uop_cache = 0;
 
-  std::deque<PACKET> UOP_CACHE_PQ;
+  packet_queue UOP_CACHE_PQ;
 
   std::deque<uint64_t> instr_issued_pref;
   std::deque<demand_ip_info> demand_ips;
   std::deque<uint64_t> alternate_ips;
   uint64_t last_alternate_ip = 0;
   uint64_t last_demand_ip = 0;
+  uint64_t demand_block_next_ip = 0; // where the last wrong path fetch block ended
+  uint64_t demand_block_bb_size = 0;
 
   ooo_model_instr last_branch_instr;
 
@@ -409,14 +423,14 @@ public:
 
   std::deque<ip_pref_entry> ips_to_prefetch;
   std::vector<std::pair<uint64_t, uint64_t>> spec_ips_to_prefetch;
-  std::map<uint64_t, bool> ideal_ips_to_prefetch;
+#ifdef NO_PREFETCH_ALL_HIT
+  side_table<bool, 4 * SIDE_TABLE_ENTRIES> ideal_ips_to_prefetch;
+#endif
   // std::deque<uint64_t> ideal_ips_to_prefetch;
 
-  std::map<uint64_t, std::deque<uint64_t>> return_map;
-  std::map<uint64_t, uint64_t> indirect_map;
-
   FETCH_MODE fetch_mode = STREAM;
   PATH_MODE path_mode = RIGHT;
+  LoopStreamDetector loop_stream_detector; // LOOP_BUFFER
   std::deque<prefetch_decode_entry> PRF_DECODE_BUFFER;
 
   bool keep_adding_to_uop = false;
@@ -437,38 +451,14 @@ public:
   uint64_t window_test = 0;
   uint64_t last_pc_test = 0;
 
-  struct alt_br_info {
-    uint64_t br_ip = 0;
-    bool prediction = false;
-    bool checked = false;
-    int br_type = 0;
-    uint64_t instr_id = 0;
-    uint64_t by_id = 0;
-    uint64_t predicted_branch_target = 0;
-    bool valid = false;
-    bool started_correctly = false;
-  };
-
-  std::map<uint64_t, alt_br_info> alt_branch;
-  // std::deque<alt_br_info> alt_branch;
-
   uint64_t last_critical_branch = 0;
 
   const long IN_QUEUE_SIZE = 2 * FETCH_WIDTH;
   std::deque<ooo_model_instr> input_queue;
 
-  std::map<uint64_t, std::pair<uint64_t, uint8_t>> h2p_not_taken_bb_size;
-  std::map<uint64_t, std::pair<uint64_t, uint8_t>> h2p_taken_bb_size;
-
-  std::map<uint64_t, bool> h2p_map;
-
-  struct pref_br_info {
-    bool is_branch = false;
-    uint8_t branch_type = 0;
-    bool br_taken = false;
-  };
+  side_table<std::pair<uint64_t, uint8_t>> h2p_not_taken_bb_size;
 
-  std::map<uint64_t, pref_br_info> br_info_prefetch_path;
+  side_table<bool> h2p_map;
 
   CacheBus L1I_bus, L1D_bus;
 
@@ -505,6 +495,7 @@ public:
   void check_contention();
   void check_banking_collision();
 
+  fetch_block_info predict_fetch_block(uint64_t start_ip, uint8_t level, uint64_t max_instrs, uint64_t bb_size_hint = 0);
   std::pair<uint64_t, uint8_t> prefetch_alternate_path(uint64_t starting_ip, uint64_t target, uint64_t bb_size, uint8_t branch_type, uint64_t by_instr,
                                                        bool branch_miss, ooo_model_instr& issuing_instr);
   std::pair<uint64_t, uint8_t> prefetch_nested_alternate_path(uint64_t starting_ip, uint64_t target, uint64_t bb_size, uint8_t branch_type, uint64_t by_instr,
@@ -557,19 +548,21 @@ public:
 
   const std::bitset<NUM_BRANCH_MODULES> bpred_type;
   const std::bitset<NUM_BTB_MODULES> btb_type;
+  const std::bitset<MicroOpCache::NUM_UOP_REPLACEMENT_MODULES> uop_repl_type;
 
   O3_CPU(uint32_t index, double freq_scale, dib_type&& dib, std::size_t dib_set, std::size_t dib_way, std::size_t dib_window_size,
          std::size_t ifetch_buffer_size, std::size_t decode_buffer_size, std::size_t dispatch_buffer_size, std::size_t rob_size, std::size_t lq_size,
          std::size_t sq_size, unsigned fetch_width, unsigned decode_width, unsigned dispatch_width, unsigned schedule_width, unsigned execute_width,
          long int lq_width, long int sq_width, unsigned retire_width, unsigned mispredict_penalty, unsigned decode_latency, unsigned dispatch_latency,
          unsigned schedule_latency, unsigned execute_latency, MemoryRequestConsumer* l1i, long int l1i_bw, MemoryRequestConsumer* l1d, long int l1d_bw,
-         std::bitset<NUM_BRANCH_MODULES> bpred, std::bitset<NUM_BTB_MODULES> btb)
+         std::bitset<NUM_BRANCH_MODULES> bpred, std::bitset<NUM_BTB_MODULES> btb, std::bitset<MicroOpCache::NUM_UOP_REPLACEMENT_MODULES> uop_repl)
       : champsim::operable(freq_scale), cpu(index), DIB{std::move(dib)}, dib_set(dib_set), dib_way(dib_way), dib_window(dib_window_size), LQ(lq_size),
         IFETCH_BUFFER_SIZE(ifetch_buffer_size), DISPATCH_BUFFER_SIZE(dispatch_buffer_size), DECODE_BUFFER_SIZE(decode_buffer_size), ROB_SIZE(rob_size),
         LQ_SIZE(lq_size), SQ_SIZE(sq_size), FETCH_WIDTH(fetch_width), DECODE_WIDTH(decode_width), DISPATCH_WIDTH(dispatch_width),
         SCHEDULER_SIZE(schedule_width), EXEC_WIDTH(execute_width), LQ_WIDTH(lq_width), SQ_WIDTH(sq_width), RETIRE_WIDTH(retire_width),
         BRANCH_MISPREDICT_PENALTY(mispredict_penalty), DISPATCH_LATENCY(dispatch_latency), DECODE_LATENCY(decode_latency), SCHEDULING_LATENCY(schedule_latency),
-        EXEC_LATENCY(execute_latency), L1I_BANDWIDTH(l1i_bw), L1D_BANDWIDTH(l1d_bw), L1I_bus(cpu, l1i), L1D_bus(cpu, l1d), bpred_type(bpred), btb_type(btb)
+        EXEC_LATENCY(execute_latency), L1I_BANDWIDTH(l1i_bw), L1D_BANDWIDTH(l1d_bw), L1I_bus(cpu, l1i), L1D_bus(cpu, l1d), bpred_type(bpred), btb_type(btb),
+        uop_repl_type(uop_repl)
   {
     m_h2p_ptr = new H2P();
 
@@ -0,0 +1,78 @@
+#ifndef OPTGEN_H
+#define OPTGEN_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace champsim
+{
+/*
+ * OPTgen (Jain and Lin, ISCA 2016) replays the accesses to one cache set and tells, for every reuse, whether Belady's
+ * OPT would have kept the line since its previous access. It looks back over a window of accesses to the set, and
+ * counts per access of the window the lines that OPT keeps cached across it.
+ */
+class optgen
+{
+  struct history_entry {
+    bool valid = false;
+    uint64_t line = 0;
+    std::size_t signature = 0;
+    uint64_t last_time = 0;
+  };
+
+  std::size_t ways;
+  uint64_t time = 0;
+  std::vector<unsigned> occupancy;
+  std::vector<history_entry> history;
+
+public:
+  // the decision OPT took for a previous access, identified by the signature it was made with
+  struct outcome {
+    std::size_t signature;
+    bool opt_hit;
+  };
+
+  uint64_t accesses = 0, hits = 0;
+
+  optgen(std::size_t num_ways, std::size_t window) : ways(num_ways), occupancy(window), history(window) {}
+
+  // replays an access to line. Returns the outcome of the previous access to the line if it is reused, or the outcome of
+  // the least recent line if it left the window without a reuse (OPT would not have kept it).
+  std::optional<outcome> access(uint64_t line, std::size_t signature)
+  {
+    const auto window = std::size(occupancy);
+    const uint64_t now = time++;
+    occupancy[now % window] = 0;
+    accesses++;
+
+    std::optional<outcome> retval;
+    auto entry = std::find_if(std::begin(history), std::end(history), [line](const auto& x) { return x.valid && x.line == line; });
+    if (entry != std::end(history)) {
+      bool opt_hit = now - entry->last_time < window;
+      for (uint64_t t = entry->last_time; opt_hit && t < now; ++t)
+        opt_hit = occupancy[t % window] < ways;
+
+      if (opt_hit) {
+        for (uint64_t t = entry->last_time; t < now; ++t)
+          occupancy[t % window]++;
+        hits++;
+      }
+      retval = outcome{entry->signature, opt_hit};
+    } else {
+      entry = std::min_element(std::begin(history), std::end(history),
+                               [](const auto& x, const auto& y) { return !x.valid || (y.valid && x.last_time < y.last_time); });
+      if (entry->valid)
+        retval = outcome{entry->signature, false};
+    }
+
+    *entry = {true, line, signature, now};
+    return retval;
+  }
+};
+} // namespace champsim
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef PACKED_TAGS_H
+#define PACKED_TAGS_H
+
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Helpers for small set-associative side tables (H2P, TargetTable) that keep a 16-bit partial tag and an
+// 8-bit LRU age per way instead of a full ip and a 64-bit timestamp.
+// Tags of one set are stored contiguously so all ways are compared at once (8 ways per SSE2 compare).
+
+// fold an address into a 16-bit partial tag
+inline uint16_t packed_tag16(uint64_t addr) { return static_cast<uint16_t>(addr ^ (addr >> 16) ^ (addr >> 32) ^ (addr >> 48)); }
+
+// bitmask of the ways whose tag matches
+template <uint32_t WAYS>
+inline uint32_t packed_tag_match(const uint16_t* tags, uint16_t tag)
+{
+  static_assert(WAYS <= 32, "way mask is 32 bits");
+  uint32_t mask = 0;
+  uint32_t way = 0;
+#if defined(__SSE2__)
+  const __m128i key = _mm_set1_epi16(static_cast<short>(tag));
+  for (; way + 8 <= WAYS; way += 8) {
+    __m128i cmp = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tags + way)), key);
+    mask |= (static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(cmp, _mm_setzero_si128()))) & 0xff) << way;
+  }
+  if constexpr (WAYS % 8 >= 4) {
+    __m128i cmp = _mm_cmpeq_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(tags + way)), key);
+    mask |= (static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(cmp, _mm_setzero_si128()))) & 0xf) << way;
+    way += 4;
+  }
+#endif
+  for (; way < WAYS; way++) {
+    if (tags[way] == tag) {
+      mask |= 1u << way;
+    }
+  }
+  return mask;
+}
+
+// index of the lowest set way in mask, -1 if none
+inline int packed_first_way(uint32_t mask) { return mask == 0 ? -1 : __builtin_ctz(mask); }
+
+// move way to MRU (age 0), everything younger ages by one
+template <uint32_t WAYS>
+inline void packed_age_touch(uint8_t* ages, uint32_t way)
+{
+  const uint8_t old_age = ages[way];
+  for (uint32_t i = 0; i < WAYS; i++) {
+    ages[i] += (ages[i] < old_age);
+  }
+  ages[way] = 0;
+}
+
+// first invalid way, else the oldest one
+template <uint32_t WAYS>
+inline uint32_t packed_age_victim(const uint8_t* ages, uint32_t valid_mask)
+{
+  uint32_t invalid = ~valid_mask & ((WAYS == 32) ? 0xffffffffu : ((1u << WAYS) - 1));
+  if (invalid != 0) {
+    return __builtin_ctz(invalid);
+  }
+  uint32_t victim = 0;
+  for (uint32_t i = 1; i < WAYS; i++) {
+    if (ages[i] > ages[victim]) {
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+#endif // PACKED_TAGS_H
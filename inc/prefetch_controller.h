@@ -0,0 +1,94 @@
+#ifndef PREFETCH_CONTROLLER_H
+#define PREFETCH_CONTROLLER_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+/*
+ * Feedback directed prefetching (Srinath et al., HPCA 2007). At the end of every epoch the accuracy, lateness and
+ * pollution of the prefetches of a cache, each averaged with its value over the previous epochs, move the
+ * aggressiveness of the prefetcher one level up or down. A busy DRAM read queue also moves it down unless the
+ * prefetches are accurate. The prefetcher modules scale their nominal degree and distance by the level, see
+ * CACHE::prefetch_degree() and CACHE::prefetch_distance().
+ */
+class prefetch_controller
+{
+public:
+  static constexpr unsigned NUM_LEVELS = 5;
+  static constexpr unsigned NOMINAL_LEVEL = 2; // the degree and distance of the module
+
+  static constexpr double ACCURACY_HIGH = 0.75;
+  static constexpr double ACCURACY_LOW = 0.40;
+  static constexpr double LATENESS_HIGH = 0.01;  // late / useful
+  static constexpr double POLLUTION_HIGH = 0.05; // demand misses to lines evicted by a prefetch / demand misses
+  static constexpr double BANDWIDTH_HIGH = 0.75; // average DRAM read queue occupancy / size
+
+  // what happened during one epoch
+  struct epoch_sample {
+    uint64_t issued = 0;
+    uint64_t useful = 0;
+    uint64_t late = 0;
+    uint64_t demand_misses = 0;
+    uint64_t polluting_misses = 0;
+    double dram_occupancy = 0; // fraction of the read queue
+  };
+
+private:
+  // scaling of the nominal degree and distance in quarters, from very conservative to very aggressive, after the
+  // (distance, degree) levels of the paper: (4,1) (8,1) (16,2) (32,4) (64,4)
+  static constexpr std::array<unsigned, NUM_LEVELS> degree_quarters{2, 2, 4, 8, 8};
+  static constexpr std::array<unsigned, NUM_LEVELS> distance_quarters{1, 2, 4, 8, 16};
+
+  unsigned current_level = NOMINAL_LEVEL;
+  double accuracy = 0, lateness = 0, pollution = 0;
+  bool first_epoch = true;
+
+  static unsigned scale(unsigned nominal, unsigned quarters) { return std::max(1u, nominal * quarters / 4); }
+
+  static double ratio(uint64_t num, uint64_t den) { return den == 0 ? 0.0 : static_cast<double>(num) / static_cast<double>(den); }
+
+public:
+  unsigned level() const { return current_level; }
+  unsigned degree(unsigned nominal) const { return scale(nominal, degree_quarters[current_level]); }
+  unsigned distance(unsigned nominal) const { return scale(nominal, distance_quarters[current_level]); }
+
+  // returns the change of level, -1, 0 or 1
+  int end_epoch(const epoch_sample& sample)
+  {
+    auto smooth = [this](double old_value, double new_value) { return first_epoch ? new_value : (old_value + new_value) / 2; };
+    accuracy = smooth(accuracy, ratio(sample.useful, sample.issued));
+    lateness = smooth(lateness, ratio(sample.late, sample.useful));
+    pollution = smooth(pollution, ratio(sample.polluting_misses, sample.demand_misses));
+    first_epoch = false;
+
+    // an idle prefetcher keeps its level
+    if (sample.issued == 0)
+      return 0;
+
+    const bool late = lateness > LATENESS_HIGH;
+    const bool polluting = pollution > POLLUTION_HIGH;
+
+    int change = 0;
+    if (accuracy >= ACCURACY_HIGH)
+      change = late ? 1 : (polluting ? -1 : 0);
+    else if (accuracy >= ACCURACY_LOW)
+      change = (late && !polluting) ? 1 : (polluting ? -1 : 0);
+    else
+      change = (late || polluting) ? -1 : 0;
+
+    if (sample.dram_occupancy > BANDWIDTH_HIGH && accuracy < ACCURACY_HIGH)
+      change = -1;
+
+    if (change > 0 && current_level + 1 < NUM_LEVELS)
+      current_level++;
+    else if (change < 0 && current_level > 0)
+      current_level--;
+    else
+      change = 0;
+
+    return change;
+  }
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef PREFETCH_TELEMETRY_H
+#define PREFETCH_TELEMETRY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Cycles per sample of the prefetch time series, 0 keeps the totals only
+#ifndef PREF_TELEMETRY_EPOCH
+#define PREF_TELEMETRY_EPOCH 0
+#endif
+
+namespace champsim
+{
+// Who asked for a prefetch: the prefetcher module of the cache (CACHE::prefetch_line) or the uop cache prefetcher
+// (the alternate path packets of UOP_CACHE_MSHR, CACHE::prefetch_line_pkt, and the windows it inserts in the uop cache)
+enum class prefetch_source : uint8_t { MODULE, UOP_CACHE };
+constexpr std::size_t NUM_PREFETCH_SOURCES = 2;
+constexpr std::array<const char*, NUM_PREFETCH_SOURCES> prefetch_source_names{"MODULE", "UOP_CACHE"};
+
+struct prefetch_counters {
+  // bucket i counts the first uses [2^i, 2^(i+1)) cycles after the fill, the last one everything above
+  static constexpr std::size_t LEAD_TIME_BUCKETS = 16;
+
+  uint64_t issued = 0;
+  uint64_t useful = 0;    // first demand use of a prefetched line
+  uint64_t late = 0;      // demand access while the prefetch was still in flight (also counted as useful)
+  uint64_t early = 0;     // evicted before any use
+  uint64_t redundant = 0; // prefetch of a line already present, in flight or filtered out
+  std::array<uint64_t, LEAD_TIME_BUCKETS> lead_time = {};
+
+  void add_lead_time(uint64_t cycles)
+  {
+    std::size_t bucket = 0;
+    while (cycles > 1 && bucket + 1 < LEAD_TIME_BUCKETS) {
+      cycles >>= 1;
+      bucket++;
+    }
+    lead_time[bucket]++;
+  }
+
+  prefetch_counters& operator-=(const prefetch_counters& other)
+  {
+    issued -= other.issued;
+    useful -= other.useful;
+    late -= other.late;
+    early -= other.early;
+    redundant -= other.redundant;
+    for (std::size_t i = 0; i < LEAD_TIME_BUCKETS; ++i)
+      lead_time[i] -= other.lead_time[i];
+    return *this;
+  }
+};
+
+// Prefetch counters of one structure, per source, with an optional time series of the counts of every epoch
+class prefetch_telemetry
+{
+public:
+  using sample_type = std::array<prefetch_counters, NUM_PREFETCH_SOURCES>;
+
+private:
+  uint64_t epoch_length = PREF_TELEMETRY_EPOCH;
+  uint64_t next_epoch = 0;
+  sample_type totals = {}, at_epoch_begin = {};
+  std::vector<sample_type> epochs;
+
+public:
+  prefetch_counters& operator[](prefetch_source source) { return totals[static_cast<std::size_t>(source)]; }
+  const prefetch_counters& operator[](prefetch_source source) const { return totals[static_cast<std::size_t>(source)]; }
+
+  // closes the epoch once it is over, called every cycle
+  void tick(uint64_t cycle)
+  {
+    if (epoch_length == 0)
+      return;
+    if (next_epoch == 0)
+      next_epoch = cycle + epoch_length;
+    if (cycle < next_epoch)
+      return;
+
+    auto& sample = epochs.emplace_back(totals);
+    for (std::size_t i = 0; i < NUM_PREFETCH_SOURCES; ++i)
+      sample[i] -= at_epoch_begin[i];
+    at_epoch_begin = totals;
+    next_epoch += epoch_length;
+  }
+
+  void reset() { *this = prefetch_telemetry{}; }
+
+  const std::vector<sample_type>& series() const { return epochs; }
+  uint64_t epoch_cycles() const { return epoch_length; }
+
+  bool empty() const
+  {
+    for (const auto& c : totals) {
+      if (c.issued != 0 || c.useful != 0 || c.redundant != 0)
+        return false;
+    }
+    return true;
+  }
+};
+} // namespace champsim
+
+#endif
@@ -40,6 +40,45 @@ typedef struct __eviction_stats {
   uint64_t by_pref_used;
 } eviction_stats;
 
+// throttle levels of the uop cache prefetcher (uop_pref_throttle.h), defined here to size its stats
+#define UOP_PREF_THROTTLE_LEVELS 4
+
+typedef struct __uop_pref_throttle_stats {
+  uint64_t epochs = 0;
+  std::array<uint64_t, UOP_PREF_THROTTLE_LEVELS> epochs_at_level = {};
+  uint64_t throttle_up = 0;
+  uint64_t throttle_down = 0;
+  uint64_t branch_disabled = 0;
+  uint64_t branch_reenabled = 0;
+  uint64_t blocked_lookups = 0; // alternate paths not walked for a disabled branch
+  uint64_t low_priority_inserts = 0;
+  uint64_t pref_used = 0;
+  uint64_t pref_unused = 0;
+  uint64_t demand_evicted_by_pref = 0;
+} uop_pref_throttle_stats;
+
+typedef struct __uop_capacity_stats {
+  uint64_t instrs_inserted = 0;
+  uint64_t uops_inserted = 0;
+  uint64_t uop_count_unknown = 0;   // prefetched instructions never decoded on the demand path, counted as 1 uop
+  uint64_t continuation_ways = 0;   // ways taken by a window whose previous way had no room left
+  uint64_t uncacheable_windows = 0; // windows over the ways or uops limit, dropped from the uop cache
+  uint64_t uncacheable_inserts = 0; // inserts skipped because their window is uncacheable
+} uop_capacity_stats;
+
+typedef struct __loop_buffer_stats {
+  uint64_t locks = 0; // loops locked in the loop buffer
+  uint64_t exits = 0;
+} loop_buffer_stats;
+
+typedef struct __fetch_block_stats {
+  uint64_t blocks = 0;
+  uint64_t instrs = 0;
+  uint64_t bb_size_hint_used = 0; // the first branch was found through the bb size of the previous branch
+  uint64_t tag_probes = 0;        // BTB tag-only lookups while looking for the first branch
+  uint64_t branch_predictions = 0; // full BTB + direction predictions
+} fetch_block_stats;
+
 typedef struct __lines_prefetched {
   uint64_t line_pref_by_correct_alt = 0;
   uint64_t number_of_wrong_alt_paths = 0;
@@ -246,6 +285,7 @@ typedef struct __energy_stats_detailed {
 typedef struct __energy_stats {
   uint64_t fetched_from_l1i;
   uint64_t fetched_from_uop_cache;
+  uint64_t fetched_from_loop_buffer;
   uint64_t decoded;
   uint64_t pref_decoded;
 } energy_stats;
@@ -937,6 +977,7 @@ public:
     js["front_end_energy_stats"]["pref_decodes"] = front_end_energy.pref_decoded;
     js["front_end_energy_stats"]["fetched_from_l1i"] = front_end_energy.fetched_from_l1i;
     js["front_end_energy_stats"]["fetched_from_uop_cache"] = front_end_energy.fetched_from_uop_cache;
+    js["front_end_energy_stats"]["fetched_from_loop_buffer"] = front_end_energy.fetched_from_loop_buffer;
     js["front_end_energy_stats"]["total_decodes"] = total_decodes;
     js["front_end_energy_stats"]["pref_decodes_per"] = (double(front_end_energy.pref_decoded) / double(total_decodes)) * 100;
     js["front_end_energy_stats"]["normal_decodes_per"] = (double(front_end_energy.decoded) / double(total_decodes)) * 100;
@@ -1342,6 +1383,67 @@ public:
     js["eviction_stats"]["num_Eviction_of_pref_used"] = double(m_eviction_stats.by_pref_used);
     js["eviction_stats"]["num_Eviction_of_pref_not_used"] = double(m_eviction_stats.by_pref_not_used);
 
+#ifdef UOP_PREF_THROTTLE
+    cout << "uop_throttle_epochs: " << uop_throttle_stats.epochs << endl;
+    for (std::size_t i = 0; i < uop_throttle_stats.epochs_at_level.size(); i++) {
+      cout << "uop_throttle_epochs_at_level_" << i << ": " << double(uop_throttle_stats.epochs_at_level[i]) / double(uop_throttle_stats.epochs) * 100 << endl;
+      js["uop_throttle_stats"]["epochs_at_level_" + std::to_string(i)] = double(uop_throttle_stats.epochs_at_level[i]) / double(uop_throttle_stats.epochs) * 100;
+    }
+    cout << "uop_throttle_up: " << uop_throttle_stats.throttle_up << endl;
+    cout << "uop_throttle_down: " << uop_throttle_stats.throttle_down << endl;
+    cout << "uop_throttle_branch_disabled: " << uop_throttle_stats.branch_disabled << endl;
+    cout << "uop_throttle_branch_reenabled: " << uop_throttle_stats.branch_reenabled << endl;
+    cout << "uop_throttle_blocked_lookups: " << uop_throttle_stats.blocked_lookups << endl;
+    cout << "uop_throttle_low_priority_inserts: " << uop_throttle_stats.low_priority_inserts << endl;
+    cout << "uop_throttle_accuracy: "
+         << double(uop_throttle_stats.pref_used) / double(uop_throttle_stats.pref_used + uop_throttle_stats.pref_unused) * 100 << endl;
+    cout << "uop_throttle_demand_evicted_by_pref: " << uop_throttle_stats.demand_evicted_by_pref << endl;
+    js["uop_throttle_stats"]["epochs"] = uop_throttle_stats.epochs;
+    js["uop_throttle_stats"]["throttle_up"] = uop_throttle_stats.throttle_up;
+    js["uop_throttle_stats"]["throttle_down"] = uop_throttle_stats.throttle_down;
+    js["uop_throttle_stats"]["branch_disabled"] = uop_throttle_stats.branch_disabled;
+    js["uop_throttle_stats"]["branch_reenabled"] = uop_throttle_stats.branch_reenabled;
+    js["uop_throttle_stats"]["blocked_lookups"] = uop_throttle_stats.blocked_lookups;
+    js["uop_throttle_stats"]["low_priority_inserts"] = uop_throttle_stats.low_priority_inserts;
+    js["uop_throttle_stats"]["accuracy"] =
+        double(uop_throttle_stats.pref_used) / double(uop_throttle_stats.pref_used + uop_throttle_stats.pref_unused) * 100;
+    js["uop_throttle_stats"]["demand_evicted_by_pref"] = uop_throttle_stats.demand_evicted_by_pref;
+#endif
+
+#ifdef LOOP_BUFFER
+    cout << "loop_buffer_locks: " << loop_buffer.locks << endl;
+    cout << "loop_buffer_exits: " << loop_buffer.exits << endl;
+    cout << "loop_buffer_streamed: " << front_end_energy.fetched_from_loop_buffer << endl;
+    js["loop_buffer_stats"]["locks"] = loop_buffer.locks;
+    js["loop_buffer_stats"]["exits"] = loop_buffer.exits;
+    js["loop_buffer_stats"]["streamed"] = front_end_energy.fetched_from_loop_buffer;
+#endif
+
+#ifdef UOP_CACHE_UOP_CAPACITY
+    const double uops_per_instr = uop_capacity.instrs_inserted > 0 ? double(uop_capacity.uops_inserted) / double(uop_capacity.instrs_inserted) : 0.0;
+    cout << "uop_capacity_uops_per_instr: " << uops_per_instr << endl;
+    cout << "uop_capacity_uop_count_unknown: " << uop_capacity.uop_count_unknown << endl;
+    cout << "uop_capacity_continuation_ways: " << uop_capacity.continuation_ways << endl;
+    cout << "uop_capacity_uncacheable_windows: " << uop_capacity.uncacheable_windows << endl;
+    cout << "uop_capacity_uncacheable_inserts: " << uop_capacity.uncacheable_inserts << endl;
+    js["uop_capacity_stats"]["uops_per_instr"] = uops_per_instr;
+    js["uop_capacity_stats"]["uop_count_unknown"] = uop_capacity.uop_count_unknown;
+    js["uop_capacity_stats"]["continuation_ways"] = uop_capacity.continuation_ways;
+    js["uop_capacity_stats"]["uncacheable_windows"] = uop_capacity.uncacheable_windows;
+    js["uop_capacity_stats"]["uncacheable_inserts"] = uop_capacity.uncacheable_inserts;
+#endif
+
+    cout << "fetch_blocks: " << fetch_block.blocks << endl;
+    cout << "fetch_block_avg_instrs: " << double(fetch_block.instrs) / double(fetch_block.blocks) << endl;
+    cout << "fetch_block_bb_size_hint_used: " << fetch_block.bb_size_hint_used << endl;
+    cout << "fetch_block_tag_probes: " << fetch_block.tag_probes << endl;
+    cout << "fetch_block_branch_predictions: " << fetch_block.branch_predictions << endl;
+    js["fetch_block_stats"]["blocks"] = fetch_block.blocks;
+    js["fetch_block_stats"]["avg_instrs"] = double(fetch_block.instrs) / double(fetch_block.blocks);
+    js["fetch_block_stats"]["bb_size_hint_used"] = fetch_block.bb_size_hint_used;
+    js["fetch_block_stats"]["tag_probes"] = fetch_block.tag_probes;
+    js["fetch_block_stats"]["branch_predictions"] = fetch_block.branch_predictions;
+
     cout << "MRC_reads: " << mrc_checks << endl;
     cout << "MRC_hits: " << mrc_hits << endl;
     cout << "MRC_hit_rate: " << double(mrc_hits) / double(mrc_checks) * 100 << endl;
@@ -1460,6 +1562,8 @@ public:
     front_end_energy.decoded = 0;
     front_end_energy.fetched_from_l1i = 0;
     front_end_energy.fetched_from_uop_cache = 0;
+    front_end_energy.fetched_from_loop_buffer = 0;
+    loop_buffer = {};
     front_end_energy.pref_decoded = 0;
 
     instr_checked = 0;
@@ -1817,6 +1921,9 @@ public:
     m_eviction_stats.by_pref_not_used = 0;
     m_eviction_stats.by_pref_used = 0;
 
+    uop_throttle_stats = {};
+    fetch_block = {};
+
     conflict_stats.conflict_btb = 0;
     conflict_stats.conflict_window = 0;
     conflict_stats.total_btb_conflict_check = 0;
@@ -2146,6 +2253,10 @@ public:
 
   decode_stats m_decode_stats;
   eviction_stats m_eviction_stats;
+  uop_pref_throttle_stats uop_throttle_stats;
+  uop_capacity_stats uop_capacity;
+  loop_buffer_stats loop_buffer;
+  fetch_block_stats fetch_block;
 
   uint64_t mrc_checks = 0;
   uint64_t mrc_hits = 0;
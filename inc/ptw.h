@@ -47,29 +47,37 @@ public:
   const long int MAX_READ, MAX_FILL;
   const uint64_t HIT_LATENCY;
 
-  std::deque<PACKET> RQ;
-  std::deque<PACKET> MSHR;
+  packet_queue RQ;
+  packet_queue MSHR;
 
   uint64_t total_miss_latency = 0;
+  uint64_t walks = 0, coalesced_walks = 0, speculative_walks = 0, dropped_walks = 0, walker_stall_cycles = 0;
 
   std::vector<pscl_type> pscl;
   VirtualMemory& vmem;
 
   const uint64_t CR3_addr;
 
+  // walks in flight at once (0 is unlimited), and whether a walk joins an in-flight walk that is reading the same PTE line
+  const std::size_t WALKERS;
+  const bool coalesce_walks;
+
   PageTableWalker(std::string v1, uint32_t cpu, double freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10, uint32_t v11,
-                  uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem);
+                  uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem, std::size_t walkers = 0,
+                  bool coalesce = false);
 
   // functions
   bool add_rq(const PACKET& packet) override final;
   bool add_wq(const PACKET&) override final { assert(0); }
-  bool add_pq(const PACKET&) override final { assert(0); }
+  bool add_pq(const PACKET& packet) override final; // speculative walks from a TLB prefetcher
   bool add_ptwq(const PACKET&) override final { assert(0); }
 
   void return_data(const PACKET& packet) override final;
   void operate() override final;
+  void begin_phase() override final;
 
   bool handle_read(const PACKET& pkt);
+  bool join_walk(const PACKET& pkt, std::size_t start_level);
   bool handle_fill(const PACKET& pkt);
   bool step_translation(uint64_t addr, std::size_t transl_level, const PACKET& source);
 
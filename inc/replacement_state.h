@@ -0,0 +1,136 @@
+#ifndef REPLACEMENT_STATE_H
+#define REPLACEMENT_STATE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace champsim
+{
+// count distinct sets of num_sets, in ascending order, drawn by the pseudo random generator of the original DRRIP and
+// SHiP samplers (the same sets for the same arguments)
+inline std::vector<std::size_t> sample_sets(std::size_t num_sets, std::size_t count)
+{
+  std::vector<std::size_t> sets;
+  count = std::min(count, num_sets);
+
+  std::size_t rand_seed = 1103515245 + 12345;
+  for (std::size_t i = 0; i < count; i++) {
+    std::size_t val = (rand_seed / 65536) % num_sets;
+    auto loc = std::lower_bound(std::begin(sets), std::end(sets), val);
+
+    while (loc != std::end(sets) && *loc == val) {
+      rand_seed = rand_seed * 1103515245 + 12345;
+      val = (rand_seed / 65536) % num_sets;
+      loc = std::lower_bound(std::begin(sets), std::end(sets), val);
+    }
+
+    sets.insert(loc, val);
+  }
+
+  return sets;
+}
+
+// Per way metadata of a replacement policy, NUM_WAY values per set stored set after set
+template <typename T>
+class way_metadata
+{
+  std::vector<T> values;
+  std::size_t ways;
+
+public:
+  using iterator = typename std::vector<T>::iterator;
+
+  way_metadata(std::size_t num_sets, std::size_t num_ways, const T& init = {}) : values(num_sets * num_ways, init), ways(num_ways) {}
+
+  T& operator()(std::size_t set, std::size_t way) { return values[set * ways + way]; }
+  const T& operator()(std::size_t set, std::size_t way) const { return values[set * ways + way]; }
+
+  std::pair<iterator, iterator> set_span(std::size_t set)
+  {
+    auto begin = std::next(std::begin(values), static_cast<long>(set * ways));
+    return {begin, std::next(begin, static_cast<long>(ways))};
+  }
+
+  // way of an iterator of set_span(set)
+  uint32_t way_of(std::size_t set, typename std::vector<T>::const_iterator it) const
+  {
+    return static_cast<uint32_t>(std::distance(std::begin(values), it) - static_cast<long>(set * ways));
+  }
+};
+
+/*
+ * Set dueling (Qureshi et al., ISCA 2007) between two policies. Every core owns leader sets of each policy, taken
+ * from sample_sets(), and a saturating PSEL counter: a miss of the core in one of its leader sets moves the counter
+ * towards the other policy, and the core follows the policy with fewer leader misses in all other sets.
+ */
+class set_dueling
+{
+public:
+  static constexpr std::size_t NUM_POLICIES = 2;
+
+private:
+  static constexpr uint16_t FOLLOWER = std::numeric_limits<uint16_t>::max();
+
+  std::vector<uint16_t> leader_of; // per set: cpu * NUM_POLICIES + policy of a leader set, FOLLOWER otherwise
+  std::vector<unsigned> psel;      // per cpu
+  unsigned psel_max;
+  std::size_t leaders_per_policy;
+
+public:
+  // at most a quarter of the sets lead each policy, so that some sets follow
+  set_dueling(std::size_t num_sets, std::size_t num_cpus, std::size_t leader_sets, unsigned psel_bits = 10)
+      : leader_of(num_sets, FOLLOWER), psel(num_cpus, ((1u << psel_bits) - 1) / 2), psel_max((1u << psel_bits) - 1),
+        leaders_per_policy(std::max<std::size_t>(1, std::min(leader_sets, num_sets / (2 * NUM_POLICIES * num_cpus))))
+  {
+    auto sets = sample_sets(num_sets, num_cpus * NUM_POLICIES * leaders_per_policy);
+    for (std::size_t i = 0; i < std::size(sets); ++i) {
+      const std::size_t cpu = i / (NUM_POLICIES * leaders_per_policy);
+      leader_of[sets[i]] = static_cast<uint16_t>(cpu * NUM_POLICIES + i % NUM_POLICIES);
+    }
+  }
+
+  bool is_leader(uint32_t cpu, std::size_t set) const { return leader_of[set] != FOLLOWER && leader_of[set] / NUM_POLICIES == cpu; }
+
+  // the policy cpu applies in set
+  std::size_t policy(uint32_t cpu, std::size_t set) const { return is_leader(cpu, set) ? leader_of[set] % NUM_POLICIES : winner(cpu); }
+
+  // the policy of the follower sets of cpu
+  std::size_t winner(uint32_t cpu) const { return psel[cpu] > psel_max / 2 ? 1 : 0; }
+
+  void record_miss(uint32_t cpu, std::size_t set)
+  {
+    if (!is_leader(cpu, set))
+      return;
+    if (leader_of[set] % NUM_POLICIES == 0)
+      psel[cpu] = std::min(psel[cpu] + 1, psel_max);
+    else if (psel[cpu] > 0)
+      psel[cpu]--;
+  }
+
+  std::size_t leader_sets() const { return leaders_per_policy; }
+};
+
+namespace detail
+{
+inline std::size_t next_replacement_state_slot()
+{
+  static std::size_t next = 0;
+  return next++;
+}
+
+// index of the state type of a replacement module in CACHE::repl_states, allocated the first time it is asked for
+template <typename T>
+std::size_t replacement_state_slot()
+{
+  static const std::size_t slot = next_replacement_state_slot();
+  return slot;
+}
+} // namespace detail
+} // namespace champsim
+
+#endif
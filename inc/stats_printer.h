@@ -29,6 +29,10 @@ struct phase_stats {
   std::vector<O3_CPU::stats_type> roi_cpu_stats, sim_cpu_stats;
   std::vector<CACHE::stats_type> roi_cache_stats, sim_cache_stats;
   std::vector<DRAM_CHANNEL::stats_type> roi_dram_stats, sim_dram_stats;
+
+  // the uop cache is shared by the cores, its telemetry covers the phase as a whole
+  std::string uop_cache_name;
+  prefetch_telemetry uop_cache_telemetry;
 };
 
 class plain_printer
@@ -50,6 +54,7 @@ public:
   plain_printer(std::ostream& str) : stream(str) {}
   void print(phase_stats& stats);
   void print(std::vector<phase_stats>& stats);
+  void print(const prefetch_telemetry& telemetry, const std::string& name);
 };
 
 class json_printer
@@ -66,6 +71,7 @@ class json_printer
   void print(std::vector<O3_CPU::stats_type> stats_list);
   void print(std::vector<CACHE::stats_type> stats_list);
   void print(std::vector<DRAM_CHANNEL::stats_type> stats_list);
+  void print(const prefetch_telemetry& telemetry);
 
 public:
   json_printer(std::ostream& str) : stream(str) {}
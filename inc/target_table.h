@@ -3,50 +3,37 @@
  */
 
 #include "ooo_cpu.h"
-
-struct target_table_m {
-  uint64_t target;
-  uint64_t bb_size;
-  uint64_t lru;
-};
+#include "packed_tags.h"
 
 template <uint32_t SETS, uint32_t WAYS>
 
 class TargetTable {
 private:
 
-  target_table_m m_tt[SETS][WAYS];
-  uint64_t lru_counter;
+  // packed partial-tag table, tags of a set are contiguous for the way compare
+  alignas(16) uint16_t m_tag[SETS][WAYS];
+  uint32_t m_bb_size[SETS][WAYS];
+  uint8_t m_lru_age[SETS][WAYS];
+  uint32_t m_valid[SETS];
 
   uint64_t set_index(uint64_t target) {
     return ((target >> 2) & (SETS - 1));
   }
 
-  target_table_m* find_entry(uint64_t target) {
-    uint64_t set = set_index(target);
-    for (uint32_t i = 0; i < WAYS; i++) {
-      if (m_tt[set][i].target == target) {
-        return &(m_tt[set][i]);
-      }
-    }
-    return NULL;
+  uint16_t get_tag(uint64_t target) {
+    return packed_tag16((target >> 2) / SETS);
   }
 
-  target_table_m* get_lru_entry(uint64_t set) {
-    uint32_t lru_way = 0;
-    uint64_t lru_value = m_tt[set][lru_way].lru;
-    for (uint32_t i = 0; i < WAYS; i++) {
-      if (m_tt[set][i].lru < lru_value) {
-        lru_way = i;
-        lru_value = m_tt[set][lru_way].lru;
-      }
-    }
-    return &(m_tt[set][lru_way]);
+  int find_way(uint64_t set, uint64_t target) {
+    return packed_first_way(packed_tag_match<WAYS>(m_tag[set], get_tag(target)) & m_valid[set]);
+  }
+
+  uint32_t get_lru_way(uint64_t set) {
+    return packed_age_victim<WAYS>(m_lru_age[set], m_valid[set]);
   }
 
-  void update_lru(target_table_m* btb_entry) {
-    btb_entry->lru = lru_counter;
-    lru_counter++;
+  void update_lru(uint64_t set, uint32_t way) {
+    packed_age_touch<WAYS>(m_lru_age[set], way);
   }
 
 public:
@@ -54,29 +41,32 @@ public:
   void initialize() {
     for (uint32_t i = 0; i < SETS; i++) {
       for (uint32_t j = 0; j < WAYS; j++) {
-        m_tt[i][j].target = 0;
-        m_tt[i][j].bb_size = 0;
-        m_tt[i][j].lru = 0;
+        m_tag[i][j] = 0;
+        m_bb_size[i][j] = 0;
+        m_lru_age[i][j] = j; // ages must stay a permutation of the ways
       }
+      m_valid[i] = 0;
     }
   }
 
   uint64_t get_bb_size(uint64_t target) {
-    auto entry = find_entry(target);
-    if (entry != NULL) {
-      update_lru(entry);
-      return entry->bb_size;
+    uint64_t set = set_index(target);
+    int way = find_way(set, target);
+    if (way >= 0) {
+      update_lru(set, way);
+      return m_bb_size[set][way];
     }
     return 0;
   }
 
   void m_update_bb_size(uint64_t target, uint64_t bb_size) {
-    auto entry = find_entry(target);
-    if (entry == NULL) {
-      auto victim = get_lru_entry(set_index(target));
-      victim->target = target;
-      victim->bb_size = bb_size;
-      update_lru(victim);
+    uint64_t set = set_index(target);
+    if (find_way(set, target) < 0) {
+      uint32_t victim = get_lru_way(set);
+      m_tag[set][victim] = get_tag(target);
+      m_bb_size[set][victim] = bb_size;
+      m_valid[set] |= (1u << victim);
+      update_lru(set, victim);
     }
   }
 
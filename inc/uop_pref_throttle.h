@@ -0,0 +1,202 @@
+#ifndef UOP_PREF_THROTTLE_H
+#define UOP_PREF_THROTTLE_H
+
+#include <algorithm>
+#include <array>
+
+#include "defines.h"
+#include "profiler.h"
+#include "util.h"
+
+// Feedback controller for the alternate-path uop cache prefetcher.
+// Usefulness of every prefetched window is reported back by the micro-op cache (first hit or eviction before use)
+// together with the demand windows that were evicted to make room for it. The controller keeps
+//   - a per-epoch view (accuracy and pollution) that sets a global throttle level: each level halves the
+//     alternate path depth (MAX_IP_CHECK and the H2P_T end counter)
+//   - a per-issuing-branch confidence counter that disables prefetching for H2P branches whose alternate paths
+//     are never used and inserts their windows at low priority while they are unconfident
+
+#ifndef UOP_PREF_THROTTLE_EPOCH
+#define UOP_PREF_THROTTLE_EPOCH 65536 // cycles
+#endif
+// UOP_PREF_THROTTLE_LEVELS is in profiler.h
+#define UOP_PREF_THROTTLE_MIN_SAMPLES 64 // resolved prefetches needed before an epoch is allowed to change the level
+#define UOP_PREF_THROTTLE_ACC_LOW 25     // percent
+#define UOP_PREF_THROTTLE_ACC_HIGH 50    // percent
+#define UOP_PREF_THROTTLE_POLLUTION_HIGH 25 // percent of prefetch fills that evicted a demand window
+#define UOP_PREF_THROTTLE_MIN_IP_CHECK 4
+
+#define UOP_PREF_THROTTLE_SETS 256
+#define UOP_PREF_THROTTLE_WAYS 4
+#define UOP_PREF_THROTTLE_CONF_BITS 3
+
+class UopPrefThrottle
+{
+private:
+  struct ENTRY {
+    uint64_t ip_tag = 0;
+    uint64_t lru = 0;
+    SaturationCounter confidence = SaturationCounter(UOP_PREF_THROTTLE_CONF_BITS);
+  };
+
+  ENTRY btable[UOP_PREF_THROTTLE_SETS][UOP_PREF_THROTTLE_WAYS];
+  uint64_t lru_counter = 0;
+
+  // current epoch
+  uint64_t epoch_start = 0;
+  uint64_t epoch_fills = 0;
+  uint64_t epoch_used = 0;
+  uint64_t epoch_unused = 0;
+  uint64_t epoch_demand_evicted = 0;
+
+  unsigned level = 0;
+  bool low_accuracy = false;
+
+  uint64_t set_index(uint64_t ip) { return (ip >> 2) % UOP_PREF_THROTTLE_SETS; }
+
+  ENTRY* find_entry(uint64_t ip)
+  {
+    uint64_t set = set_index(ip);
+    for (uint32_t i = 0; i < UOP_PREF_THROTTLE_WAYS; i++) {
+      if (btable[set][i].ip_tag == ip) {
+        return &(btable[set][i]);
+      }
+    }
+    return NULL;
+  }
+
+  ENTRY* allocate_entry(uint64_t ip)
+  {
+    uint64_t set = set_index(ip);
+    ENTRY* victim = std::min_element(std::begin(btable[set]), std::end(btable[set]), [](const ENTRY& a, const ENTRY& b) { return a.lru < b.lru; });
+    victim->ip_tag = ip;
+    // new branches start just above the confidence threshold so they get a fair chance
+    victim->confidence.set(victim->confidence.max_value / 2 + 1);
+    update_lru(victim);
+    return victim;
+  }
+
+  void update_lru(ENTRY* entry)
+  {
+    entry->lru = lru_counter;
+    lru_counter++;
+  }
+
+  // counts the branches whose alternate paths this disables
+  void lower_confidence(uint64_t br_ip)
+  {
+    ENTRY* entry = find_entry(br_ip);
+    if (entry == NULL || entry->confidence.value() == 0) {
+      return;
+    }
+    entry->confidence.decrement();
+    if (entry->confidence.value() == 0) {
+      get_profiler_ptr->uop_throttle_stats.branch_disabled++;
+    }
+  }
+
+  void end_epoch()
+  {
+    get_profiler_ptr->uop_throttle_stats.epochs++;
+    get_profiler_ptr->uop_throttle_stats.epochs_at_level[level]++;
+
+    uint64_t resolved = epoch_used + epoch_unused;
+    if (resolved >= UOP_PREF_THROTTLE_MIN_SAMPLES) {
+      uint64_t accuracy = (epoch_used * 100) / resolved;
+      uint64_t pollution = epoch_fills > 0 ? (epoch_demand_evicted * 100) / epoch_fills : 0;
+
+      if ((accuracy < UOP_PREF_THROTTLE_ACC_LOW || pollution > UOP_PREF_THROTTLE_POLLUTION_HIGH) && level < UOP_PREF_THROTTLE_LEVELS - 1) {
+        level++;
+        get_profiler_ptr->uop_throttle_stats.throttle_up++;
+      } else if (accuracy >= UOP_PREF_THROTTLE_ACC_HIGH && pollution <= UOP_PREF_THROTTLE_POLLUTION_HIGH && level > 0) {
+        level--;
+        get_profiler_ptr->uop_throttle_stats.throttle_down++;
+      }
+      low_accuracy = accuracy < UOP_PREF_THROTTLE_ACC_HIGH;
+    }
+
+    // give disabled branches one more chance every epoch so that phase changes are picked up
+    for (auto& set : btable) {
+      for (auto& entry : set) {
+        if (entry.ip_tag != 0 && entry.confidence.value() == 0) {
+          entry.confidence.set(1);
+          get_profiler_ptr->uop_throttle_stats.branch_reenabled++;
+        }
+      }
+    }
+
+    epoch_fills = 0;
+    epoch_used = 0;
+    epoch_unused = 0;
+    epoch_demand_evicted = 0;
+  }
+
+public:
+  void Operate(uint64_t current_cycle)
+  {
+    if (current_cycle - epoch_start >= UOP_PREF_THROTTLE_EPOCH) {
+      end_epoch();
+      epoch_start = current_cycle;
+    }
+  }
+
+  // per branch enable/disable, called before an alternate path is walked for the H2P branch
+  bool AllowPrefetch(uint64_t br_ip)
+  {
+    ENTRY* entry = find_entry(br_ip);
+    if (entry == NULL) {
+      allocate_entry(br_ip);
+      return true;
+    }
+    update_lru(entry);
+    if (entry->confidence.value() == 0) {
+      get_profiler_ptr->uop_throttle_stats.blocked_lookups++;
+      return false;
+    }
+    return true;
+  }
+
+  // alternate path depth
+  uint64_t MaxIpCheck() { return std::max<uint64_t>(MAX_IP_CHECK >> level, UOP_PREF_THROTTLE_MIN_IP_CHECK); }
+  int EndThreshold() { return std::max(H2P_T >> level, 1); }
+
+  // insertion priority of a prefetched window in the micro-op cache
+  bool LowPriorityInsert(uint64_t br_ip)
+  {
+    if (low_accuracy) {
+      return true;
+    }
+    ENTRY* entry = find_entry(br_ip);
+    return entry != NULL && !entry->confidence.confident();
+  }
+
+  // feedback from the micro-op cache
+  void OnPrefetchFill() { epoch_fills++; }
+
+  void OnPrefetchUsed(uint64_t br_ip)
+  {
+    epoch_used++;
+    get_profiler_ptr->uop_throttle_stats.pref_used++;
+    if (ENTRY* entry = find_entry(br_ip); entry != NULL) {
+      entry->confidence.increment();
+    }
+  }
+
+  void OnPrefetchUnused(uint64_t br_ip)
+  {
+    epoch_unused++;
+    get_profiler_ptr->uop_throttle_stats.pref_unused++;
+    lower_confidence(br_ip);
+  }
+
+  void OnDemandEvicted(uint64_t br_ip)
+  {
+    epoch_demand_evicted++;
+    get_profiler_ptr->uop_throttle_stats.demand_evicted_by_pref++;
+    lower_confidence(br_ip);
+  }
+};
+
+inline UopPrefThrottle* m_uop_pref_throttle_ptr = new UopPrefThrottle();
+
+#endif // UOP_PREF_THROTTLE_H
@@ -61,7 +61,7 @@ struct SaturationCounter {
     return false;
   }
 
-  bool confident() {
+  bool confident() const {
     if (counter >= max_value / 2) {
       return true;
     }
@@ -71,7 +71,7 @@ struct SaturationCounter {
   int value() {
     return counter;
   }
-  bool reset() {
+  void reset() {
     counter = 0;
   }
 
@@ -79,7 +79,7 @@ struct SaturationCounter {
     counter = m_counter;
   }
 
-  bool max() {
+  void max() {
     counter = max_value;
   }
   bool saturated() {
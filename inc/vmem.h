@@ -17,11 +17,14 @@
 #ifndef VMEM_H
 #define VMEM_H
 
+#include <array>
 #include <cstdint>
 #include <deque>
-#include <map>
+#include <tuple>
+#include <vector>
 
 #include "champsim_constants.h"
+#include "msl/flat_hash_map.h"
 
 class MEMORY_CONTROLLER;
 
@@ -30,11 +33,67 @@ inline constexpr auto VMEM_RESERVE_CAPACITY = std::max<uint64_t>(PAGE_SIZE, 1ull
 
 inline constexpr std::size_t PTE_BYTES = 8;
 
+// entries of the per-CPU cache of the last translations in front of the page map
+inline constexpr std::size_t VMEM_RECENT_TRANSLATIONS = 16;
+
+/*
+ * Huge pages. A virtual region gets a huge page when it is first touched if
+ *  - it falls in one of the configured ranges ("huge_page_ranges", each with its own page size), or
+ *  - the policy asks for it: "text" maps the regions first touched by an instruction fetch, "all" maps every region
+ * and no smaller page was mapped in it before. Huge frames are taken from the top of the physical memory so that the
+ * base size pages keep their placement. Sizes must be a whole number of page table levels (2MB and 1GB with 4KB PTE pages).
+ */
+enum class huge_page_policy { none, text, all };
+
+struct huge_page_range {
+  uint64_t begin, end; // virtual addresses, end excluded
+  unsigned shift;      // log2 of the page size
+};
+
+struct huge_page_spec {
+  huge_page_policy policy = huge_page_policy::none;
+  unsigned shift = 21; // page size of the policy
+  std::vector<huge_page_range> ranges = {};
+};
+
 class VirtualMemory
 {
 private:
-  std::map<std::pair<uint32_t, uint64_t>, uint64_t> vpage_to_ppage_map;
-  std::map<std::tuple<uint32_t, uint64_t, uint32_t>, uint64_t> page_table;
+  struct vpage_key {
+    uint32_t cpu;
+    uint64_t vpage;
+    bool operator==(const vpage_key& other) const { return cpu == other.cpu && vpage == other.vpage; }
+  };
+
+  struct pte_key {
+    uint32_t cpu;
+    uint64_t prefix; // vaddr >> shamt(level)
+    uint32_t level;
+    bool operator==(const pte_key& other) const { return cpu == other.cpu && prefix == other.prefix && level == other.level; }
+  };
+
+  struct key_hash {
+    std::size_t operator()(const vpage_key& key) const { return key.vpage ^ (uint64_t{key.cpu} << 48); }
+    std::size_t operator()(const pte_key& key) const { return key.prefix ^ (uint64_t{key.cpu} << 48) ^ (uint64_t{key.level} << 56); }
+  };
+
+  struct recent_translation {
+    uint64_t vpage = 0, ppage = 0;
+    bool valid = false;
+  };
+
+  champsim::msl::flat_hash_map<vpage_key, uint64_t, key_hash> vpage_to_ppage_map{1 << 16};
+  champsim::msl::flat_hash_map<pte_key, uint64_t, key_hash> page_table{1 << 12};
+  std::array<std::array<recent_translation, VMEM_RECENT_TRANSLATIONS>, NUM_CPUS> recent_translations = {};
+
+  // per huge page size, largest first: region -> base of its huge frame, 0 if smaller pages are mapped in it
+  struct huge_region_map {
+    unsigned shift;
+    champsim::msl::flat_hash_map<vpage_key, uint64_t, key_hash> regions{1 << 10};
+  };
+
+  const huge_page_spec huge_pages;
+  std::vector<huge_region_map> huge_regions;
 
   uint64_t next_pte_page = 0;
 
@@ -43,6 +102,10 @@ private:
 
   uint64_t ppage_front() const;
   void ppage_pop();
+  uint64_t huge_ppage_pop(unsigned shift);
+
+  unsigned requested_shift(uint64_t vaddr, bool instruction) const;
+  std::tuple<unsigned, uint64_t, bool> map_huge_page(uint32_t cpu_num, uint64_t vaddr, bool instruction, bool allocate); // shift, frame, fault
 
 public:
   const uint64_t minor_fault_penalty;
@@ -50,11 +113,20 @@ public:
   const uint64_t pte_page_size; // Size of a PTE page
 
   // capacity and pg_size are measured in bytes, and capacity must be a multiple of pg_size
-  VirtualMemory(uint64_t pg_size, std::size_t page_table_levels, uint64_t minor_penalty, MEMORY_CONTROLLER& dram);
+  VirtualMemory(uint64_t pg_size, std::size_t page_table_levels, uint64_t minor_penalty, MEMORY_CONTROLLER& dram, huge_page_spec huge = {});
   uint64_t shamt(std::size_t level) const;
   uint64_t get_offset(uint64_t vaddr, std::size_t level) const;
   std::size_t available_ppages() const;
-  std::pair<uint64_t, uint64_t> va_to_pa(uint32_t cpu_num, uint64_t vaddr);
+  std::pair<uint64_t, uint64_t> va_to_pa(uint32_t cpu_num, uint64_t vaddr, bool instruction = false);
+
+  // whether vaddr already has a page, without mapping one
+  bool is_mapped(uint32_t cpu_num, uint64_t vaddr);
+
+  // log2 of the size of the page holding vaddr, or of the page it would get if it is not mapped yet
+  unsigned page_shift(uint32_t cpu_num, uint64_t vaddr, bool instruction = false);
+  // number of page table levels below the leaf entry of a page of this size
+  std::size_t skipped_levels(unsigned shift) const;
+  uint64_t huge_pages_mapped = 0;
   std::pair<uint64_t, uint64_t> get_pte_pa(uint32_t cpu_num, uint64_t vaddr, std::size_t level);
 };
 
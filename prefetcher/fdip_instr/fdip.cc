@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+#include "cache.h"
+#include "instruction.h"
+
+/*
+ * Fetch-directed instruction prefetching (FDIP). The fetch target queue (IFETCH_BUFFER) is filled by the branch
+ * predictor ahead of fetch, so the lines of its entries are the upcoming fetch lines. Every cycle the prefetcher scans
+ * the entries it has not seen yet and prefetches their lines:
+ *   - into the L1I for the first FDIP_L1I_DISTANCE entries of the FTQ,
+ *   - into the L2 only (no L1I fill) for the entries up to FDIP_LOOKAHEAD,
+ * at most FDIP_BANDWIDTH prefetches per cycle. Lines present in the L1I or already requested by the uop cache
+ * prefetcher (UOP_CACHE_MSHR) are filtered out.
+ */
+
+#ifndef FDIP_LOOKAHEAD
+#define FDIP_LOOKAHEAD 192
+#endif
+#ifndef FDIP_L1I_DISTANCE
+#define FDIP_L1I_DISTANCE 64
+#endif
+#ifndef FDIP_BANDWIDTH
+#define FDIP_BANDWIDTH 2
+#endif
+
+namespace
+{
+constexpr std::size_t LOOKAHEAD = FDIP_LOOKAHEAD;
+constexpr std::size_t L1I_DISTANCE = FDIP_L1I_DISTANCE < FDIP_LOOKAHEAD ? FDIP_L1I_DISTANCE : FDIP_LOOKAHEAD;
+constexpr unsigned BANDWIDTH = FDIP_BANDWIDTH;
+
+struct fdip_state {
+  // next FTQ entry (instr_id) to scan, for the L1I and the L2 windows
+  uint64_t l1i_next_id = 0, l2_next_id = 0;
+  uint64_t l1i_last_line = 0, l2_last_line = 0;
+
+  uint64_t issued_l1i = 0, issued_l2 = 0;
+  uint64_t filtered_tag = 0, filtered_uop_mshr = 0, pq_full = 0;
+};
+
+std::map<CACHE*, fdip_state> states;
+} // namespace
+
+void CACHE::prefetcher_initialize()
+{
+  std::cout << NAME << " FDIP prefetcher lookahead: " << LOOKAHEAD << " L1I distance: " << L1I_DISTANCE << " bandwidth: " << BANDWIDTH << std::endl;
+}
+
+void CACHE::prefetcher_branch_operate(uint64_t ip, uint8_t branch_type, uint64_t branch_target) {}
+
+uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cache_hit, uint8_t type, uint32_t metadata_in)
+{
+  assert(addr == ip); // Invariant for instruction prefetchers
+  return metadata_in;
+}
+
+uint32_t CACHE::prefetcher_cache_fill(uint64_t addr, uint32_t set, uint32_t way, uint8_t prefetch, uint64_t evicted_addr, uint32_t metadata_in)
+{
+  return metadata_in;
+}
+
+void CACHE::prefetcher_cycle_operate()
+{
+  if (fetch_target_queue == nullptr || std::empty(*fetch_target_queue))
+    return;
+
+  auto& state = ::states[this];
+  const auto& ftq = *fetch_target_queue;
+  unsigned budget = BANDWIDTH;
+
+  // Scan ftq[first, last) from the entry with instr_id next_id, returns false when out of bandwidth or PQ entries
+  auto scan = [&](std::size_t first, std::size_t last, uint64_t& next_id, uint64_t& last_line, bool fill_l1i) {
+    auto begin = std::partition_point(std::next(std::begin(ftq), static_cast<long>(first)), std::next(std::begin(ftq), static_cast<long>(last)),
+                                      [next_id](const ooo_model_instr& x) { return x.instr_id < next_id; });
+    for (auto it = begin; it != std::next(std::begin(ftq), static_cast<long>(last)); ++it) {
+      const uint64_t line = it->ip >> LOG2_BLOCK_SIZE;
+      if (line != last_line && it->fetched == 0) {
+        auto [set_begin, set_end] = get_set_span(it->ip);
+        const bool in_l1i =
+            std::any_of(set_begin, set_end, [line](const BLOCK& x) { return x.valid && (x.v_address >> LOG2_BLOCK_SIZE) == line; });
+        const bool in_uop_mshr = std::any_of(std::begin(UOP_CACHE_MSHR), std::end(UOP_CACHE_MSHR), [line](const uop_mshr_entry& x) { return x.cache_line_addr == line; });
+
+        if (in_l1i) {
+          state.filtered_tag++;
+        } else if (in_uop_mshr) {
+          state.filtered_uop_mshr++;
+        } else {
+          if (budget == 0)
+            return false;
+          if (!prefetch_line(line << LOG2_BLOCK_SIZE, fill_l1i, 0)) {
+            state.pq_full++;
+            return false;
+          }
+          budget--;
+          (fill_l1i ? state.issued_l1i : state.issued_l2)++;
+        }
+      }
+
+      last_line = line;
+      next_id = it->instr_id + 1;
+    }
+    return true;
+  };
+
+  const std::size_t l1i_end = std::min(std::size(ftq), L1I_DISTANCE);
+  const std::size_t l2_end = std::min(std::size(ftq), LOOKAHEAD);
+  if (scan(0, l1i_end, state.l1i_next_id, state.l1i_last_line, true))
+    scan(l1i_end, l2_end, state.l2_next_id, state.l2_last_line, false);
+}
+
+void CACHE::prefetcher_final_stats()
+{
+  const auto& state = ::states[this];
+  std::cout << NAME << " FDIP ISSUED L1I: " << state.issued_l1i << " L2: " << state.issued_l2;
+  std::cout << " FILTERED L1I TAG: " << state.filtered_tag << " UOP MSHR: " << state.filtered_uop_mshr;
+  std::cout << " PQ FULL: " << state.pq_full << std::endl;
+}
@@ -28,13 +28,14 @@ struct tracker {
   constexpr static std::size_t TRACKER_SETS = 256;
   constexpr static std::size_t TRACKER_WAYS = 4;
   constexpr static int PREFETCH_DEGREE = 3;
+  constexpr static int PREFETCH_DISTANCE = 1; // strides ahead of the access of the first prefetch
 
   std::optional<lookahead_entry> active_lookahead;
 
   champsim::msl::lru_table<tracker_entry> table{TRACKER_SETS, TRACKER_WAYS};
 
 public:
-  void initiate_lookahead(uint64_t ip, uint64_t cl_addr)
+  void initiate_lookahead(uint64_t ip, uint64_t cl_addr, int degree, int distance)
   {
     int64_t stride = 0;
 
@@ -49,7 +50,7 @@ public:
       // Initialize prefetch state unless we somehow saw the same address twice in
       // a row or if this is the first time we've seen this stride
       if (stride != 0 && stride == found->last_stride)
-        active_lookahead = {cl_addr << LOG2_BLOCK_SIZE, stride, PREFETCH_DEGREE};
+        active_lookahead = {static_cast<uint64_t>(static_cast<int64_t>(cl_addr) + (distance - 1) * stride) << LOG2_BLOCK_SIZE, stride, degree};
     }
 
     // update tracking set
@@ -92,7 +93,8 @@ void CACHE::prefetcher_initialize() { std::cout << NAME << " IP-based stride pre
 void CACHE::prefetcher_cycle_operate() { ::trackers[this].advance_lookahead(this); }
 
 uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cache_hit, uint8_t type, uint32_t metadata_in){
-  ::trackers[this].initiate_lookahead(ip, addr >> LOG2_BLOCK_SIZE);
+  ::trackers[this].initiate_lookahead(ip, addr >> LOG2_BLOCK_SIZE, static_cast<int>(prefetch_degree(tracker::PREFETCH_DEGREE)),
+                                      static_cast<int>(prefetch_distance(tracker::PREFETCH_DISTANCE)));
   return metadata_in;
 }
 
@@ -6,8 +6,12 @@ void CACHE::prefetcher_initialize() { std::cout << NAME << " next line prefetche
 
 uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cache_hit, uint8_t type, uint32_t metadata_in)
 {
-  uint64_t pf_addr = addr + (1 << LOG2_BLOCK_SIZE);
-  prefetch_line(pf_addr, true, metadata_in);
+  // the next line, or the next degree lines from distance lines ahead once throttled
+  const uint64_t distance = prefetch_distance(1);
+  for (uint64_t i = 0; i < prefetch_degree(1); i++) {
+    uint64_t pf_addr = addr + ((distance + i) << LOG2_BLOCK_SIZE);
+    prefetch_line(pf_addr, true, metadata_in);
+  }
   return metadata_in;
 }
 
@@ -1,5 +1,7 @@
 #include "spp_dev.h"
 
+#include <algorithm>
+
 #include "cache.h"
 
 namespace
@@ -67,6 +69,8 @@ uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cac
   uint64_t base_addr = addr;
   uint32_t lookahead_conf = 100, pf_q_head = 0, pf_q_tail = 0;
   uint8_t do_lookahead = 0;
+  // the lookahead is bounded by the queues (MSHR_SIZE entries), the throttle shortens it
+  const uint32_t max_depth = std::min<uint32_t>(MSHR_SIZE, prefetch_distance(MSHR_SIZE));
 
   do {
     uint32_t lookahead_way = spp::PT_WAY;
@@ -131,7 +135,7 @@ uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cac
       std::cout << "Looping curr_sig: " << std::hex << curr_sig << " base_addr: " << base_addr << std::dec;
       std::cout << " pf_q_head: " << pf_q_head << " pf_q_tail: " << pf_q_tail << " depth: " << depth << std::endl;
     }
-  } while (spp::LOOKAHEAD_ON && do_lookahead);
+  } while (spp::LOOKAHEAD_ON && do_lookahead && (!pf_throttle.enabled || depth < max_depth));
 
   return metadata_in;
 }
@@ -356,12 +360,15 @@ void spp::PATTERN_TABLE::read_pattern(uint32_t curr_sig, std::vector<int>& delta
   // Update (sig, delta) correlation
   uint32_t set = get_hash(curr_sig) % spp::PT_SET, local_conf = 0, pf_conf = 0, max_conf = 0;
 
+  // the lookahead stops once the queues are full
+  const uint32_t q_size = static_cast<uint32_t>(std::min(std::size(delta_q), std::size(confidence_q)));
+
   if (c_sig[set]) {
     for (uint32_t way = 0; way < spp::PT_WAY; way++) {
       local_conf = (100 * c_delta[set][way]) / c_sig[set];
       pf_conf = depth ? (::GHR.global_accuracy * c_delta[set][way] / c_sig[set] * lookahead_conf / 100) : local_conf;
 
-      if (pf_conf >= PF_THRESHOLD) {
+      if (pf_conf >= PF_THRESHOLD && pf_q_tail < q_size) {
         confidence_q[pf_q_tail] = pf_conf;
         delta_q[pf_q_tail] = delta[set][way];
 
@@ -385,7 +392,7 @@ void spp::PATTERN_TABLE::read_pattern(uint32_t curr_sig, std::vector<int>& delta
         }
       }
     }
-    pf_q_tail++;
+    pf_q_tail = std::min(pf_q_tail + 1, q_size);
 
     lookahead_conf = max_conf;
     if (lookahead_conf >= PF_THRESHOLD)
@@ -394,7 +401,7 @@ void spp::PATTERN_TABLE::read_pattern(uint32_t curr_sig, std::vector<int>& delta
     if constexpr (spp::SPP_DEBUG_PRINT) {
       std::cout << "global_accuracy: " << ::GHR.global_accuracy << " lookahead_conf: " << lookahead_conf << std::endl;
     }
-  } else {
+  } else if (pf_q_tail < q_size) {
     confidence_q[pf_q_tail] = 0;
   }
 }
@@ -0,0 +1,62 @@
+#include <iostream>
+#include <map>
+
+#include "cache.h"
+
+/*
+ * Next-page / stride TLB prefetcher for the STLB. Every demand miss prefetches the translation of the next page,
+ * or of the next PREFETCH_DEGREE pages along the stride when the same page stride was seen twice in a row.
+ * The prefetches miss into the page table walker, which runs them as speculative walks that fill the STLB.
+ * The STLB needs a prefetch queue ("pq_size" > 0).
+ */
+
+namespace
+{
+constexpr int PREFETCH_DEGREE = 2;
+
+struct tracker {
+  uint64_t last_vpage = 0;
+  int64_t last_stride = 0;
+};
+
+std::map<CACHE*, tracker> trackers;
+} // namespace
+
+void CACHE::prefetcher_initialize()
+{
+  std::cout << NAME << " next page TLB prefetcher" << std::endl;
+  if (queues.PQ_SIZE == 0)
+    std::cout << "WARNING: " << NAME << " has no prefetch queue, no speculative walk will be issued" << std::endl;
+}
+
+uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cache_hit, uint8_t type, uint32_t metadata_in)
+{
+  if (cache_hit || type == PREFETCH)
+    return metadata_in;
+
+  auto& [last_vpage, last_stride] = ::trackers[this];
+  uint64_t vpage = addr >> LOG2_PAGE_SIZE;
+  int64_t stride = static_cast<int64_t>(vpage) - static_cast<int64_t>(last_vpage);
+
+  if (stride != 0 && stride == last_stride) {
+    for (int i = 1; i <= PREFETCH_DEGREE; i++) {
+      if (int64_t pf_vpage = static_cast<int64_t>(vpage) + i * stride; pf_vpage > 0)
+        prefetch_line(static_cast<uint64_t>(pf_vpage) << LOG2_PAGE_SIZE, true, metadata_in);
+    }
+  } else {
+    prefetch_line((vpage + 1) << LOG2_PAGE_SIZE, true, metadata_in);
+  }
+
+  last_vpage = vpage;
+  last_stride = stride;
+  return metadata_in;
+}
+
+uint32_t CACHE::prefetcher_cache_fill(uint64_t addr, uint32_t set, uint32_t way, uint8_t prefetch, uint64_t evicted_addr, uint32_t metadata_in)
+{
+  return metadata_in;
+}
+
+void CACHE::prefetcher_cycle_operate() {}
+
+void CACHE::prefetcher_final_stats() {}
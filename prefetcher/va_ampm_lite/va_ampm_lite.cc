@@ -62,9 +62,12 @@ uint32_t CACHE::prefetcher_cache_operate(uint64_t addr, uint64_t ip, uint8_t cac
   // mark this demand access
   demand_region->access_map.set(page_offset);
 
+  const std::size_t max_distance = prefetch_distance(MAX_DISTANCE);
+  const std::size_t degree = prefetch_degree(PREFETCH_DEGREE);
+
   // attempt to prefetch in the positive, then negative direction
   for (auto direction : {1, -1}) {
-    for (std::size_t i = 1, prefetches_issued = 0; i <= MAX_DISTANCE && prefetches_issued < PREFETCH_DEGREE; i++) {
+    for (std::size_t i = 1, prefetches_issued = 0; i <= max_distance && prefetches_issued < degree; i++) {
       const auto pos_step_addr = addr + direction * (i * BLOCK_SIZE);
       const auto neg_step_addr = addr - direction * (i * BLOCK_SIZE);
       const auto neg_2step_addr = addr - direction * (2 * i * BLOCK_SIZE);
@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "cache.h"
+#include "msl/fwcounter.h"
+#include "optgen.h"
+
+/*
+ * Hawkeye (Jain and Lin, ISCA 2016). OPTgen replays the accesses of a few sampled sets and tells, for every reuse,
+ * whether Belady's OPT would have kept the line since its previous access. The answer trains a predictor indexed by
+ * the signature (PC, prefetch) of that previous access. Lines filled or hit by a cache friendly signature are kept
+ * with RRIP priorities, lines of a cache averse signature are inserted for eviction first.
+ */
+
+namespace
+{
+constexpr unsigned maxRRPV = 7;
+constexpr std::size_t SAMPLED_SETS = 64 * NUM_CPUS;
+constexpr std::size_t HISTORY_FACTOR = 8; // OPTgen looks back 8 times the associativity, in accesses to the set
+constexpr std::size_t PREDICTOR_SIZE = 8192;
+constexpr unsigned PREDICTOR_WIDTH = 3;
+
+using predictor_counter = champsim::msl::fwcounter<PREDICTOR_WIDTH>;
+constexpr long long FRIENDLY = (predictor_counter::maximum + 1) / 2;
+
+struct hawkeye_state {
+  champsim::way_metadata<unsigned> rrpv;
+  champsim::way_metadata<std::size_t> signature; // of the last access to the line
+  std::vector<std::size_t> optgen_of;            // per set: index in optgen, max() if not sampled
+  std::vector<champsim::optgen> optgen;
+  std::vector<predictor_counter> predictor;
+
+  uint64_t averse_fills = 0, friendly_evictions = 0;
+
+  hawkeye_state(std::size_t sets, std::size_t ways)
+      : rrpv(sets, ways, maxRRPV), signature(sets, ways), optgen_of(sets, std::numeric_limits<std::size_t>::max()),
+        predictor(PREDICTOR_SIZE, predictor_counter{FRIENDLY})
+  {
+    auto sampled = champsim::sample_sets(sets, SAMPLED_SETS);
+    for (std::size_t i = 0; i < std::size(sampled); ++i)
+      optgen_of[sampled[i]] = i;
+    optgen.assign(std::size(sampled), champsim::optgen{ways, HISTORY_FACTOR * ways});
+  }
+};
+
+std::size_t get_signature(uint64_t ip, uint32_t cpu, bool prefetch)
+{
+  uint64_t hash = ip ^ (ip >> 11) ^ (ip >> 22);
+  hash = (hash << 1) | (prefetch ? 1 : 0);
+  return static_cast<std::size_t>((hash ^ (uint64_t{cpu} * 0x9E3779B1)) % PREDICTOR_SIZE);
+}
+} // namespace
+
+void CACHE::initialize_replacement() { emplace_replacement_state<hawkeye_state>(NUM_SET, NUM_WAY); }
+
+// find replacement victim
+uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
+{
+  auto& state = replacement_state<hawkeye_state>();
+  auto [begin, end] = state.rrpv.set_span(set);
+
+  // a cache averse line if there is one, otherwise the oldest cache friendly line, whose signature was wrong (trained
+  // in the sampled sets only, like OPTgen)
+  auto victim = std::find(begin, end, ::maxRRPV);
+  if (victim == end) {
+    victim = std::max_element(begin, end);
+    if (state.optgen_of[set] != std::numeric_limits<std::size_t>::max())
+      state.predictor[state.signature(set, state.rrpv.way_of(set, victim))]--;
+    state.friendly_evictions++;
+  }
+
+  assert(begin <= victim);
+  assert(victim < end);
+  return state.rrpv.way_of(set, victim);
+}
+
+// called on every cache hit and cache fill
+void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
+                                     uint8_t hit)
+{
+  auto& state = replacement_state<hawkeye_state>();
+
+  // writebacks are not predicted
+  if (type == WRITE) {
+    if (!hit)
+      state.rrpv(set, way) = ::maxRRPV;
+    return;
+  }
+
+  const auto signature = ::get_signature(ip, triggering_cpu, type == PREFETCH);
+  if (state.optgen_of[set] != std::numeric_limits<std::size_t>::max()) {
+    // train the predictor with the outcome of the previous access to the line
+    if (auto outcome = state.optgen[state.optgen_of[set]].access(full_addr >> LOG2_BLOCK_SIZE, signature); outcome.has_value()) {
+      if (outcome->opt_hit)
+        state.predictor[outcome->signature]++;
+      else
+        state.predictor[outcome->signature]--;
+    }
+  }
+
+  state.signature(set, way) = signature;
+  if (state.predictor[signature].value() < ::FRIENDLY) {
+    state.rrpv(set, way) = ::maxRRPV;
+    if (!hit)
+      state.averse_fills++;
+    return;
+  }
+
+  // a cache friendly fill ages the other cache friendly lines of the set
+  if (!hit) {
+    auto [begin, end] = state.rrpv.set_span(set);
+    for (auto it = begin; it != end; ++it) {
+      if (*it < ::maxRRPV - 1)
+        ++(*it);
+    }
+  }
+  state.rrpv(set, way) = 0;
+}
+
+// use this function to print out your own stats at the end of simulation
+void CACHE::replacement_final_stats()
+{
+  const auto& state = replacement_state<hawkeye_state>();
+  uint64_t optgen_accesses = 0, optgen_hits = 0;
+  for (const auto& sampled : state.optgen) {
+    optgen_accesses += sampled.accesses;
+    optgen_hits += sampled.hits;
+  }
+  std::cout << NAME << " HAWKEYE OPTGEN ACCESSES: " << optgen_accesses << " HITS: " << optgen_hits;
+  std::cout << " AVERSE FILLS: " << state.averse_fills << " FRIENDLY EVICTIONS: " << state.friendly_evictions << std::endl;
+}
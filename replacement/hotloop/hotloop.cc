@@ -1,28 +1,29 @@
 #include <algorithm>
-#include <map>
 #include <vector>
 
 #include "cache.h"
 
 namespace
 {
-  std::map<CACHE*, std::vector<uint64_t>> last_used_cycles;
-}
+struct hotloop_state {
+  champsim::way_metadata<uint64_t> last_used_cycles;
 
-void CACHE::initialize_replacement() {
-  ::last_used_cycles[this] = std::vector<uint64_t>(NUM_SET * NUM_WAY);
-}
+  hotloop_state(std::size_t sets, std::size_t ways) : last_used_cycles(sets, ways) {}
+};
+} // namespace
+
+void CACHE::initialize_replacement() { emplace_replacement_state<hotloop_state>(NUM_SET, NUM_WAY); }
 
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
 {
-  auto begin = std::next(std::begin(::last_used_cycles[this]), set * NUM_WAY);
-  auto end = std::next(begin, NUM_WAY);
+  auto& last_used_cycles = replacement_state<hotloop_state>().last_used_cycles;
+  auto [begin, end] = last_used_cycles.set_span(set);
 
   // Find the way whose last use cycle is most distant
   auto victim = std::min_element(begin, end);
   assert(begin <= victim);
   assert(victim < end);
-  return static_cast<uint32_t>(std::distance(begin, victim)); // cast protected by prior asserts
+  return last_used_cycles.way_of(set, victim);
 }
 
 void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
@@ -31,15 +32,14 @@ void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint
   // Mark the way as being used on the current cycle
   if (!hit || type != WRITE) // Skip this for writeback hits
   {
-    ::last_used_cycles[this].at(set * NUM_WAY + way)++;
-    if (::last_used_cycles[this].at(set * NUM_WAY + way) >= 512) {
-      auto begin = std::next(std::begin(::last_used_cycles[this]), set * NUM_WAY);
-      auto end = std::next(begin, NUM_WAY);
+    auto& last_used_cycles = replacement_state<hotloop_state>().last_used_cycles;
+    last_used_cycles(set, way)++;
+    if (last_used_cycles(set, way) >= 512) {
+      auto [begin, end] = last_used_cycles.set_span(set);
       std::for_each(begin, end, [](auto& x) { x = x / 2; });
-      ::last_used_cycles[this].at(set * NUM_WAY + way)++;
+      last_used_cycles(set, way)++;
     }
   }
 }
 
 void CACHE::replacement_final_stats() {}
- 
\ No newline at end of file
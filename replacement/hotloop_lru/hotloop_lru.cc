@@ -1,5 +1,4 @@
 #include <algorithm>
-#include <map>
 #include <vector>
 
 #include "cache.h"
@@ -11,21 +10,19 @@ struct hotloop_entry {
 
 namespace
 {
-  std::map<CACHE*, std::vector<hotloop_entry>> hotness;
-}
+struct hotloop_lru_state {
+  champsim::way_metadata<hotloop_entry> hotness;
 
-void CACHE::initialize_replacement() {
-  ::hotness[this] = std::vector<hotloop_entry>(NUM_SET * NUM_WAY);
-  for (auto& x : ::hotness[this]) {
-    x.hotness_counter = 0;
-    x.last_used = 0;
-  }
-}
+  hotloop_lru_state(std::size_t sets, std::size_t ways) : hotness(sets, ways, hotloop_entry{0, 0}) {}
+};
+} // namespace
+
+void CACHE::initialize_replacement() { emplace_replacement_state<hotloop_lru_state>(NUM_SET, NUM_WAY); }
 
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
 {
-  auto begin = std::next(std::begin(::hotness[this]), set * NUM_WAY);
-  auto end = std::next(begin, NUM_WAY);
+  auto& hotness = replacement_state<hotloop_lru_state>().hotness;
+  auto [begin, end] = hotness.set_span(set);
 
   // Find the way whose last use cycle is most distant
 
@@ -52,7 +49,7 @@ uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t
 
   assert(begin <= victim);
   assert(victim < end);
-  return static_cast<uint32_t>(std::distance(begin, victim)); // cast protected by prior asserts
+  return hotness.way_of(set, victim);
 }
 
 void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
@@ -61,14 +58,14 @@ void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint
   // Mark the way as being used on the current cycle
   if (!hit || type != WRITE) // Skip this for writeback hits
   {
-    hotloop_entry& update = ::hotness[this].at(set * NUM_WAY + way);
+    auto& hotness = replacement_state<hotloop_lru_state>().hotness;
+    hotloop_entry& update = hotness(set, way);
 
     update.hotness_counter++;
     update.last_used = current_cycle;
 
     if (update.hotness_counter >= 512) {
-      auto begin = std::next(std::begin(::hotness[this]), set * NUM_WAY);
-      auto end = std::next(begin, NUM_WAY);
+      auto [begin, end] = hotness.set_span(set);
       std::for_each(begin, end, [](auto& x) {
         hotloop_entry& entry = x;
       entry.hotness_counter = entry.hotness_counter / 2;
@@ -1,42 +1,37 @@
 #include <algorithm>
-#include <map>
 #include <vector>
 
 #include "cache.h"
 
 namespace
 {
-  std::map<CACHE*, std::vector<uint64_t>> last_used_cycles;
-}
- 
-void CACHE::initialize_replacement() {
-  ::last_used_cycles[this] = std::vector<uint64_t>(NUM_SET * NUM_WAY);
-}
+struct lru_state {
+  champsim::way_metadata<uint64_t> last_used_cycles;
+
+  lru_state(std::size_t sets, std::size_t ways) : last_used_cycles(sets, ways) {}
+};
+} // namespace
+
+void CACHE::initialize_replacement() { emplace_replacement_state<lru_state>(NUM_SET, NUM_WAY); }
 
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
 {
-  auto begin = std::next(std::begin(::last_used_cycles[this]), set * NUM_WAY);
-  auto end = std::next(begin, NUM_WAY);
+  auto& last_used_cycles = replacement_state<lru_state>().last_used_cycles;
+  auto [begin, end] = last_used_cycles.set_span(set);
 
   // Find the way whose last use cycle is most distant
   auto victim = std::min_element(begin, end);
   assert(begin <= victim);
   assert(victim < end);
-  return static_cast<uint32_t>(std::distance(begin, victim)); // cast protected by prior asserts
+  return last_used_cycles.way_of(set, victim);
 }
 
 void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
   uint8_t hit)
 {
-  // if (NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0) {
-  //   std::cout << __func__ << " set? " << std::dec << set << " way? " << way
-  //     << " addr " << std::hex << full_addr
-  //     << " v_addr " << ip
-  //     << std::endl;
-  // }
   // Mark the way as being used on the current cycle
   if (!hit || type != WRITE) // Skip this for writeback hits
-    ::last_used_cycles[this].at(set * NUM_WAY + way) = current_cycle;
+    replacement_state<lru_state>().last_used_cycles(set, way) = current_cycle;
 }
 
 void CACHE::replacement_final_stats() {}
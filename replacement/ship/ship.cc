@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <array>
-#include <map>
-#include <utility>
+#include <limits>
 #include <vector>
 
 #include "cache.h"
@@ -25,45 +24,33 @@ public:
   uint64_t last_used = 0;
 };
 
-// sampler
-std::map<CACHE*, std::vector<std::size_t>> rand_sets;
-std::map<CACHE*, std::vector<SAMPLER_class>> sampler;
-std::map<CACHE*, std::vector<int>> rrpv_values;
-
-// prediction table structure
-std::map<std::pair<CACHE*, std::size_t>, std::array<unsigned, SHCT_SIZE>> SHCT;
+struct ship_state {
+  std::vector<std::size_t> sampler_of;               // per set: first entry of its sampler set, max() if not sampled
+  std::vector<SAMPLER_class> sampler;                // NUM_WAY entries per sampled set
+  champsim::way_metadata<int> rrpv_values;
+  std::vector<std::array<unsigned, SHCT_SIZE>> SHCT; // prediction table, per cpu
+
+  ship_state(std::size_t sets, std::size_t ways)
+      : sampler_of(sets, std::numeric_limits<std::size_t>::max()), rrpv_values(sets, ways, maxRRPV), SHCT(NUM_CPUS, std::array<unsigned, SHCT_SIZE>{})
+  {
+    auto sampled = champsim::sample_sets(sets, SAMPLER_SET);
+    for (std::size_t i = 0; i < std::size(sampled); ++i)
+      sampler_of[sampled[i]] = i * ways;
+    sampler.resize(std::size(sampled) * ways);
+  }
+};
 } // namespace
 
 // initialize replacement state
-void CACHE::initialize_replacement()
-{
-  // randomly selected sampler sets
-  std::size_t rand_seed = 1103515245 + 12345;
-  ;
-  for (std::size_t i = 0; i < ::SAMPLER_SET; i++) {
-    std::size_t val = (rand_seed / 65536) % NUM_SET;
-    std::vector<std::size_t>::iterator loc = std::lower_bound(std::begin(::rand_sets[this]), std::end(::rand_sets[this]), val);
-
-    while (loc != std::end(::rand_sets[this]) && *loc == val) {
-      rand_seed = rand_seed * 1103515245 + 12345;
-      val = (rand_seed / 65536) % NUM_SET;
-      loc = std::lower_bound(std::begin(::rand_sets[this]), std::end(::rand_sets[this]), val);
-    }
-
-    ::rand_sets[this].insert(loc, val);
-  }
-
-  sampler.emplace(this, ::SAMPLER_SET * NUM_WAY);
-
-  ::rrpv_values[this] = std::vector<int>(NUM_SET * NUM_WAY, ::maxRRPV);
-}
+void CACHE::initialize_replacement() { emplace_replacement_state<ship_state>(NUM_SET, NUM_WAY); }
 
 // find replacement victim
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
 {
+  auto& rrpv_values = replacement_state<ship_state>().rrpv_values;
+
   // look for the maxRRPV line
-  auto begin = std::next(std::begin(::rrpv_values[this]), set * NUM_WAY);
-  auto end = std::next(begin, NUM_WAY);
+  auto [begin, end] = rrpv_values.set_span(set);
   auto victim = std::find(begin, end, ::maxRRPV);
   while (victim == end) {
     for (auto it = begin; it != end; ++it)
@@ -73,25 +60,27 @@ uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t
   }
 
   assert(begin <= victim);
-  return static_cast<uint32_t>(std::distance(begin, victim)); // cast pretected by prior assert
+  return rrpv_values.way_of(set, victim);
 }
 
 // called on every cache hit and cache fill
 void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
                                      uint8_t hit)
 {
+  auto& state = replacement_state<ship_state>();
+  auto& SHCT = state.SHCT[triggering_cpu];
+
   // handle writeback access
   if (type == WRITE) {
     if (!hit)
-      ::rrpv_values[this][set * NUM_WAY + way] = ::maxRRPV - 1;
+      state.rrpv_values(set, way) = ::maxRRPV - 1;
 
     return;
   }
 
   // update sampler
-  auto s_idx = std::find(std::begin(::rand_sets[this]), std::end(::rand_sets[this]), set);
-  if (s_idx != std::end(::rand_sets[this])) {
-    auto s_set_begin = std::next(std::begin(sampler[this]), std::distance(std::begin(::rand_sets[this]), s_idx));
+  if (state.sampler_of[set] != std::numeric_limits<std::size_t>::max()) {
+    auto s_set_begin = std::next(std::begin(state.sampler), static_cast<long>(state.sampler_of[set]));
     auto s_set_end = std::next(s_set_begin, NUM_WAY);
 
     // check hit
@@ -99,8 +88,8 @@ void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint
                               [addr = full_addr, shamt = 8 + champsim::lg2(NUM_WAY)](auto x) { return x.valid && (x.address >> shamt) == (addr >> shamt); });
     if (match != s_set_end) {
       auto SHCT_idx = match->ip % ::SHCT_PRIME;
-      if (::SHCT[std::make_pair(this, triggering_cpu)][SHCT_idx] > 0)
-        ::SHCT[std::make_pair(this, triggering_cpu)][SHCT_idx]--;
+      if (SHCT[SHCT_idx] > 0)
+        SHCT[SHCT_idx]--;
 
       match->used = 1;
     } else {
@@ -108,8 +97,8 @@ void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint
 
       if (match->used) {
         auto SHCT_idx = match->ip % ::SHCT_PRIME;
-        if (::SHCT[std::make_pair(this, triggering_cpu)][SHCT_idx] < ::SHCT_MAX)
-          ::SHCT[std::make_pair(this, triggering_cpu)][SHCT_idx]++;
+        if (SHCT[SHCT_idx] < ::SHCT_MAX)
+          SHCT[SHCT_idx]++;
       }
 
       match->valid = 1;
@@ -123,14 +112,14 @@ void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint
   }
 
   if (hit)
-    ::rrpv_values[this][set * NUM_WAY + way] = 0;
+    state.rrpv_values(set, way) = 0;
   else {
     // SHIP prediction
     auto SHCT_idx = ip % ::SHCT_PRIME;
 
-    ::rrpv_values[this][set * NUM_WAY + way] = ::maxRRPV - 1;
-    if (::SHCT[std::make_pair(this, triggering_cpu)][SHCT_idx] == ::SHCT_MAX)
-      ::rrpv_values[this][set * NUM_WAY + way] = ::maxRRPV;
+    state.rrpv_values(set, way) = ::maxRRPV - 1;
+    if (SHCT[SHCT_idx] == ::SHCT_MAX)
+      state.rrpv_values(set, way) = ::maxRRPV;
   }
 }
 
@@ -1,21 +1,28 @@
+#include <algorithm>
+
 #include "cache.h"
-#include <unordered_map>
 
 namespace
 {
 constexpr int maxRRPV = 3;
-std::unordered_map<CACHE*, std::vector<int>> rrpv_values;
+
+struct srrip_state {
+  champsim::way_metadata<int> rrpv_values;
+
+  srrip_state(std::size_t sets, std::size_t ways) : rrpv_values(sets, ways, maxRRPV) {}
+};
 } // namespace
 
 // initialize replacement state
-void CACHE::initialize_replacement() { ::rrpv_values[this] = std::vector<int>(NUM_SET * NUM_WAY, ::maxRRPV); }
+void CACHE::initialize_replacement() { emplace_replacement_state<srrip_state>(NUM_SET, NUM_WAY); }
 
 // find replacement victim
 uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t set, const BLOCK* current_set, uint64_t ip, uint64_t full_addr, uint32_t type)
 {
+  auto& rrpv_values = replacement_state<srrip_state>().rrpv_values;
+
   // look for the maxRRPV line
-  auto begin = std::next(std::begin(::rrpv_values[this]), set * NUM_WAY);
-  auto end = std::next(begin, NUM_WAY);
+  auto [begin, end] = rrpv_values.set_span(set);
   auto victim = std::find(begin, end, ::maxRRPV); // hijack the lru field
   while (victim == end) {
     for (auto it = begin; it != end; ++it)
@@ -26,17 +33,18 @@ uint32_t CACHE::find_victim(uint32_t triggering_cpu, uint64_t instr_id, uint32_t
 
   assert(begin <= victim);
   assert(victim < end);
-  return static_cast<uint32_t>(std::distance(begin, victim)); // cast protected by assertions
+  return rrpv_values.way_of(set, victim);
 }
 
 // called on every cache hit and cache fill
 void CACHE::update_replacement_state(uint32_t triggering_cpu, uint32_t set, uint32_t way, uint64_t full_addr, uint64_t ip, uint64_t victim_addr, uint32_t type,
                                      uint8_t hit)
 {
+  auto& rrpv_values = replacement_state<srrip_state>().rrpv_values;
   if (hit)
-    ::rrpv_values[this][set * NUM_WAY + way] = 0;
+    rrpv_values(set, way) = 0;
   else
-    ::rrpv_values[this][set * NUM_WAY + way] = ::maxRRPV - 1;
+    rrpv_values(set, way) = ::maxRRPV - 1;
 }
 
 // use this function to print out your own stats at the end of simulation
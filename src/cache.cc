@@ -29,11 +29,18 @@ Commit at Commits on Nov 18, 2022 have the issue solved. The hash of the commit
 #include "instruction.h"
 #include "util.h"
 
-void CACHE::update_dib_from_prefetch(const PACKET& pref_entry)
+namespace
 {
+champsim::prefetch_source source_of(const PACKET& pkt) { return pkt.uop_pref ? champsim::prefetch_source::UOP_CACHE : champsim::prefetch_source::MODULE; }
+} // namespace
+
+bool CACHE::update_dib_from_prefetch(const PACKET& pref_entry)
+{
+  bool delivered = false;
   for (auto& mshr : UOP_CACHE_MSHR) {
     if ((mshr.cache_line_addr == (pref_entry.v_address >> LOG2_BLOCK_SIZE)) && !mshr.pref_done) {
       mshr.pref_done = true;
+      delivered = true;
       // if (mshr.cache_line_addr == 69375)
       //   cout << "IP received in CAHCE by " << mshr.by_instr << " size " << mshr.ips_in_line.size() << endl;
       for (auto& ips : mshr.ips_in_line) {
@@ -50,6 +57,7 @@ void CACHE::update_dib_from_prefetch(const PACKET& pref_entry)
 
         // ADDED: SET alternate path flag
         pd_entry.is_alternate_path = mshr.is_alternate_path;
+        pd_entry.by_ip = mshr.by_ip;
 
         pd_entry.taken = false;
         for (auto& br_taken : mshr.predicted_taken_branches) {
@@ -71,18 +79,57 @@ void CACHE::update_dib_from_prefetch(const PACKET& pref_entry)
       // }
     }
   }
+  return delivered;
+}
+
+uint32_t CACHE::find_victim_way(const PACKET& fill_mshr, uint32_t set, const BLOCK* current_set, uint64_t full_addr)
+{
+  uint32_t victim;
+  if (!repl_duel.has_value()) {
+    victim = impl_find_victim(fill_mshr.cpu, fill_mshr.instr_id, set, current_set, fill_mshr.ip, full_addr, fill_mshr.type);
+  } else {
+    // only the module the set follows chooses, both keep their state up to date
+    const auto policy = repl_duel->policy(fill_mshr.cpu, set);
+    sim_stats.back().repl_duel_victims[policy]++;
+
+    std::bitset<NUM_REPLACEMENT_MODULES> candidates;
+    candidates.set(repl_duel_modules[policy]);
+    victim = impl_find_victim_among(candidates, fill_mshr.cpu, fill_mshr.instr_id, set, current_set, fill_mshr.ip, full_addr, fill_mshr.type);
+  }
+
+  // the reserved ways keep the code lines of the set from data fills, the data line filled the longest ago goes instead.
+  // The modules choose among every way of the set, so the reservation can only override their choice afterwards: what
+  // find_victim did for its victim (aging, detraining its signature) stays, though the code line is not evicted. These
+  // mismatches are counted as code_protected.
+  if (code_priority.reserved_ways > 0 && !fill_mshr.instruction && current_set[victim].instruction) {
+    const auto set_end = std::next(current_set, NUM_WAY);
+    const auto code_lines = std::count_if(current_set, set_end, [](const BLOCK& x) { return x.valid && x.instruction; });
+    auto oldest_data = std::min_element(current_set, set_end, [](const BLOCK& x, const BLOCK& y) {
+      return !x.instruction && (y.instruction || x.fill_cycle < y.fill_cycle);
+    });
+    if (code_lines <= code_priority.reserved_ways && !oldest_data->instruction) {
+      victim = static_cast<uint32_t>(std::distance(current_set, oldest_data));
+      sim_stats.back().code_protected++;
+    }
+  }
+
+  return victim;
 }
 
 bool CACHE::handle_fill(const PACKET& fill_mshr)
 {
   cpu = fill_mshr.cpu;
 
+  // a huge page translation takes one entry for the whole page
+  const bool huge_page = fill_mshr.page_shift > OFFSET_BITS;
+  const auto fill_address = huge_page ? fill_mshr.address & ~champsim::bitmask(fill_mshr.page_shift) : fill_mshr.address;
+  const auto set_address = huge_page ? huge_page_set_address(fill_address, fill_mshr.page_shift) : fill_address;
+
   // find victim
-  auto [set_begin, set_end] = get_set_span(fill_mshr.address);
+  auto [set_begin, set_end] = get_set_span(set_address);
   auto way = std::find_if_not(set_begin, set_end, [](auto x) { return x.valid; });
   if (way == set_end)
-    way = std::next(set_begin, impl_find_victim(fill_mshr.cpu, fill_mshr.instr_id, get_set_index(fill_mshr.address), &*set_begin, fill_mshr.ip,
-                                                fill_mshr.address, fill_mshr.type));
+    way = std::next(set_begin, find_victim_way(fill_mshr, get_set_index(set_address), &*set_begin, fill_address));
   assert(set_begin <= way);
   assert(way <= set_end);
   const auto way_idx = static_cast<std::size_t>(std::distance(set_begin, way)); // cast protected by earlier assertion
@@ -125,23 +172,47 @@ bool CACHE::handle_fill(const PACKET& fill_mshr)
     if (success) {
       auto evicting_address = (ever_seen_data ? way->address : way->v_address) & ~champsim::bitmask(match_offset_bits ? 0 : OFFSET_BITS);
 
-      if (way->prefetch)
+      if (pf_throttle.enabled && fill_mshr.prefetch_from_this && way->valid) {
+        if (pf_evicted[0].size() >= PF_EVICTED_LINES) {
+          std::swap(pf_evicted[0], pf_evicted[1]);
+          pf_evicted[0].clear();
+        }
+        pf_evicted[0].insert(way->address >> OFFSET_BITS);
+      }
+
+      if (way->prefetch) {
         sim_stats.back().pf_useless++;
+        sim_stats.back().pf_telemetry[way->pf_source].early++;
+      }
 
       if (fill_mshr.type == PREFETCH)
         sim_stats.back().pf_fill++;
 
+      if (fill_mshr.instruction)
+        sim_stats.back().code_fills++;
+      if (way->valid && way->instruction)
+        (fill_mshr.instruction ? sim_stats.back().code_evicted_by_code : sim_stats.back().code_evicted_by_data)++;
+
       way->valid = true;
       way->prefetch = fill_mshr.prefetch_from_this;
+      way->pf_source = source_of(fill_mshr);
+      way->fill_cycle = current_cycle;
+      way->instruction = fill_mshr.instruction;
       way->dirty = (fill_mshr.type == WRITE);
-      way->address = fill_mshr.address;
-      way->v_address = fill_mshr.v_address;
-      way->data = fill_mshr.data;
+      way->address = fill_address;
+      way->v_address = huge_page ? fill_mshr.v_address & ~champsim::bitmask(fill_mshr.page_shift) : fill_mshr.v_address;
+      way->data = huge_page ? fill_mshr.data & ~champsim::bitmask(fill_mshr.page_shift) : fill_mshr.data;
+      way->page_shift = huge_page ? fill_mshr.page_shift : 0;
+      if (huge_page)
+        huge_page_shifts |= 1ull << fill_mshr.page_shift;
 
       metadata_thru =
-          impl_prefetcher_cache_fill(pkt_address, get_set_index(fill_mshr.address), way_idx, fill_mshr.type == PREFETCH, evicting_address, metadata_thru);
-      impl_update_replacement_state(fill_mshr.cpu, get_set_index(fill_mshr.address), way_idx, fill_mshr.address, fill_mshr.ip, evicting_address, fill_mshr.type,
+          impl_prefetcher_cache_fill(pkt_address, get_set_index(set_address), way_idx, fill_mshr.type == PREFETCH, evicting_address, metadata_thru);
+      impl_update_replacement_state(fill_mshr.cpu, get_set_index(set_address), way_idx, fill_address, fill_mshr.ip, evicting_address, fill_mshr.type,
                                     false);
+      // a boosted code fill is then promoted like a hit, the module has seen it as the miss it was
+      if (code_priority.boost && fill_mshr.instruction)
+        impl_update_replacement_state(fill_mshr.cpu, get_set_index(set_address), way_idx, fill_address, fill_mshr.ip, 0, fill_mshr.type, true);
 
       way->pf_metadata = metadata_thru;
     }
@@ -154,6 +225,9 @@ bool CACHE::handle_fill(const PACKET& fill_mshr)
   }
 
   if (success) {
+    // the duel counts each demand miss once, when its fill goes through
+    if (repl_duel.has_value() && fill_mshr.type != WRITE && fill_mshr.type != PREFETCH)
+      repl_duel->record_miss(fill_mshr.cpu, get_set_index(set_address));
 
 #ifdef PREFETCH_PATHS
     if (NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0 && fill_mshr.type == PREFETCH) {
@@ -185,6 +259,26 @@ bool CACHE::handle_fill(const PACKET& fill_mshr)
   return success;
 }
 
+// huge pages are spread over the sets by their own page number, not by the base page number of their first base page
+uint64_t CACHE::huge_page_set_address(uint64_t base, unsigned shift) const { return base >> (shift - OFFSET_BITS); }
+
+bool CACHE::find_huge_page(uint64_t address, set_type::iterator& set_begin, set_type::iterator& set_end, set_type::iterator& way)
+{
+  // largest pages first
+  for (unsigned shift = 64; shift-- > OFFSET_BITS;) {
+    if ((huge_page_shifts >> shift) & 1) {
+      auto base = address & ~champsim::bitmask(shift);
+      auto [begin, end] = get_set_span(huge_page_set_address(base, shift));
+      auto found = std::find_if(begin, end, [base, shift](const BLOCK& x) { return x.valid && x.page_shift == shift && x.address == base; });
+      if (found != end) {
+        std::tie(set_begin, set_end, way) = std::tie(begin, end, found);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 bool CACHE::try_hit(const PACKET& handle_pkt)
 {
   cpu = handle_pkt.cpu;
@@ -192,7 +286,7 @@ bool CACHE::try_hit(const PACKET& handle_pkt)
   // access cache
   auto [set_begin, set_end] = get_set_span(handle_pkt.address);
   auto way = std::find_if(set_begin, set_end, eq_addr<BLOCK>(handle_pkt.address, OFFSET_BITS));
-  const auto hit = (way != set_end);
+  const auto hit = (way != set_end) || (huge_page_shifts != 0 && find_huge_page(handle_pkt.address, set_begin, set_end, way));
 
   if constexpr (champsim::debug_print) {
     std::cout << "[" << NAME << "] " << __func__;
@@ -237,12 +331,17 @@ bool CACHE::try_hit(const PACKET& handle_pkt)
     // cout << "type " << int(handle_pkt.type) << " cpu " << handle_pkt.cpu << " id " << handle_pkt.instr_id << endl;
     sim_stats.back().hits[handle_pkt.type][handle_pkt.cpu]++;
 
+    if (handle_pkt.instruction)
+      way->instruction = true;
+
     // update replacement policy
     const auto way_idx = static_cast<std::size_t>(std::distance(set_begin, way)); // cast protected by earlier assertion
-    impl_update_replacement_state(handle_pkt.cpu, get_set_index(handle_pkt.address), way_idx, way->address, handle_pkt.ip, 0, handle_pkt.type, true);
+    const auto set_idx = static_cast<std::size_t>(std::distance(std::begin(block), set_begin)) / NUM_WAY;
+    impl_update_replacement_state(handle_pkt.cpu, set_idx, way_idx, way->address, handle_pkt.ip, 0, handle_pkt.type, true);
 
     auto copy{handle_pkt};
-    copy.data = way->data;
+    copy.data = way->page_shift != 0 ? champsim::splice_bits(way->data, handle_pkt.address, way->page_shift) : way->data;
+    copy.page_shift = way->page_shift;
     copy.pf_metadata = metadata_thru;
 
     for (auto ret : copy.to_return) {
@@ -251,6 +350,13 @@ bool CACHE::try_hit(const PACKET& handle_pkt)
 
     way->dirty = (handle_pkt.type == WRITE);
 
+    if (handle_pkt.type == PREFETCH && handle_pkt.prefetch_from_this) {
+      sim_stats.back().pf_telemetry[source_of(handle_pkt)].redundant++;
+    } else if (way->prefetch) {
+      sim_stats.back().pf_telemetry[way->pf_source].useful++;
+      sim_stats.back().pf_telemetry[way->pf_source].add_lead_time(current_cycle - way->fill_cycle);
+    }
+
     // update prefetch stats and reset prefetch bit
     if (way->prefetch) {
       sim_stats.back().pf_useful++;
@@ -258,6 +364,15 @@ bool CACHE::try_hit(const PACKET& handle_pkt)
     }
   } else {
     sim_stats.back().misses[handle_pkt.type][handle_pkt.cpu]++;
+
+    if (pf_throttle.enabled && handle_pkt.type != PREFETCH) {
+      pf_epoch.demand_misses++;
+      const auto line = handle_pkt.address >> OFFSET_BITS;
+      if (std::any_of(std::begin(pf_evicted), std::end(pf_evicted), [line](const auto& x) { return x.contains(line); })) {
+        pf_epoch.polluting_misses++;
+        sim_stats.back().pf_polluting_misses++;
+      }
+    }
   }
   return hit;
 }
@@ -273,6 +388,14 @@ void CACHE::check_tag(uint64_t ip, uint64_t id, bool all_uop_hit)
   last_ip_to_pref = ip;
 }
 
+namespace
+{
+auto mshr_match(uint64_t address, unsigned shamt)
+{
+  return [eq = eq_addr<PACKET>{address, shamt}](const auto& entry) mutable { return eq(entry.pkt); };
+}
+} // namespace
+
 bool CACHE::handle_miss(const PACKET& handle_pkt)
 {
 
@@ -293,43 +416,55 @@ bool CACHE::handle_miss(const PACKET& handle_pkt)
   cpu = handle_pkt.cpu;
 
   // check mshr
-  auto mshr_entry = std::find_if(MSHR.begin(), MSHR.end(), eq_addr<PACKET>(handle_pkt.address, OFFSET_BITS));
-  bool mshr_full = (MSHR.size() == MSHR_SIZE);
+  auto mshr_entry = std::find_if(MSHR.begin(), MSHR.end(), mshr_match(handle_pkt.address, OFFSET_BITS));
+  const bool is_prefetch = (handle_pkt.type == PREFETCH);
+  // prefetches may not take the entries reserved for demand misses
+  const std::size_t mshr_limit = MSHR_SIZE - (is_prefetch ? std::min<std::size_t>(mshr_spec.demand_reserve, MSHR_SIZE) : 0);
+  bool mshr_full = (MSHR.size() >= mshr_limit);
 
   if (mshr_entry != MSHR.end()) // miss already inflight
   {
-    auto instr_copy = std::move(mshr_entry->instr_depend_on_me);
-    auto ret_copy = std::move(mshr_entry->to_return);
+    // the line is code if any of the merged requests is for an instruction
+    const bool instruction = mshr_entry->pkt.instruction || handle_pkt.instruction;
+    merge_dependents(mshr_entry->pkt, handle_pkt);
+    (is_prefetch ? mshr_entry->prefetch_sectors : mshr_entry->demand_sectors) |= sector_mask(handle_pkt);
 
-    std::set_union(std::begin(instr_copy), std::end(instr_copy), std::begin(handle_pkt.instr_depend_on_me), std::end(handle_pkt.instr_depend_on_me),
-                   std::back_inserter(mshr_entry->instr_depend_on_me), ooo_model_instr::program_order);
-    std::set_union(std::begin(ret_copy), std::end(ret_copy), std::begin(handle_pkt.to_return), std::end(handle_pkt.to_return),
-                   std::back_inserter(mshr_entry->to_return));
+    if (is_prefetch && handle_pkt.prefetch_from_this)
+      sim_stats.back().pf_telemetry[source_of(handle_pkt)].redundant++;
 
-    if (mshr_entry->type == PREFETCH && handle_pkt.type != PREFETCH) {
+    if (mshr_entry->pkt.type == PREFETCH && !is_prefetch) {
       // Mark the prefetch as useful
-      if (mshr_entry->prefetch_from_this)
+      if (mshr_entry->pkt.prefetch_from_this) {
         sim_stats.back().pf_useful++;
+        sim_stats.back().pf_telemetry[source_of(mshr_entry->pkt)].useful++;
+        sim_stats.back().pf_telemetry[source_of(mshr_entry->pkt)].late++;
+      }
+      sim_stats.back().mshr_late_prefetch++;
 
-      uint64_t prior_event_cycle = mshr_entry->event_cycle;
-      auto to_return = std::move(mshr_entry->to_return);
-      *mshr_entry = handle_pkt;
+      uint64_t prior_event_cycle = mshr_entry->pkt.event_cycle;
+      auto to_return = std::move(mshr_entry->pkt.to_return);
+      mshr_entry->pkt = handle_pkt;
 
       // in case request is already returned, we should keep event_cycle
-      mshr_entry->event_cycle = prior_event_cycle;
-      mshr_entry->cycle_enqueued = current_cycle;
-      mshr_entry->to_return = std::move(to_return);
+      mshr_entry->pkt.event_cycle = prior_event_cycle;
+      mshr_entry->pkt.cycle_enqueued = current_cycle;
+      mshr_entry->pkt.to_return = std::move(to_return);
 
       // if (handle_pkt.instr_id == 51541377) {
       //   cout << __func__ << NAME << " merge " << mshr_entry->instr_id << " addr " << mshr_entry->address << " "  << current_cycle << endl;
       // }
     }
+    mshr_entry->pkt.instruction = instruction;
   } else {
     if (mshr_full) // not enough MSHR resource
     {
       // if (handle_pkt.instr_id == 51541377) {
       //   cout << __func__ << NAME << " MSHR FULL " << current_cycle << endl;
       // }
+      if (is_prefetch)
+        sim_stats.back().mshr_prefetch_full_cycles++;
+      else
+        sim_stats.back().mshr_demand_full_cycles++;
       return false;
     } // TODO should we allow prefetches anyway if they will not be filled to this level?
 
@@ -364,10 +499,11 @@ bool CACHE::handle_miss(const PACKET& handle_pkt)
 
     // Allocate an MSHR
     if (!std::empty(fwd_pkt.to_return)) {
-      mshr_entry = MSHR.insert(std::end(MSHR), handle_pkt);
-      mshr_entry->pf_metadata = fwd_pkt.pf_metadata;
-      mshr_entry->cycle_enqueued = current_cycle;
-      mshr_entry->event_cycle = std::numeric_limits<uint64_t>::max();
+      mshr_entry = MSHR.insert(std::end(MSHR), {handle_pkt});
+      mshr_entry->pkt.pf_metadata = fwd_pkt.pf_metadata;
+      mshr_entry->pkt.cycle_enqueued = current_cycle;
+      mshr_entry->pkt.event_cycle = std::numeric_limits<uint64_t>::max();
+      (is_prefetch ? mshr_entry->prefetch_sectors : mshr_entry->demand_sectors) = sector_mask(handle_pkt);
       // if (handle_pkt.instr_id == 51541377) {
       //   cout << __func__ << NAME << " MSHR Alloc " << current_cycle << endl;
       // }
@@ -400,14 +536,21 @@ bool CACHE::handle_write(const PACKET& handle_pkt)
 template <typename R, typename F>
 long int operate_queue(R& queue, long int sz, F&& func)
 {
-  auto [begin, end] = champsim::get_span_p(std::cbegin(queue), std::cend(queue), sz, std::forward<F>(func));
-  auto retval = std::distance(begin, end);
-  queue.erase(begin, end);
+  // Walk by index: a prefetcher trained by func may push to this very queue, which invalidates the iterators of a deque
+  // (not the references). The packets added meanwhile wait for the next cycle.
+  const auto limit = std::min<long int>(sz, static_cast<long int>(std::size(queue)));
+  long int retval = 0;
+  while (retval < limit && func(queue[static_cast<std::size_t>(retval)]))
+    ++retval;
+  queue.erase(std::begin(queue), std::next(std::begin(queue), retval));
   return retval;
 }
 
 void CACHE::operate()
 {
+  sim_stats.back().pf_telemetry.tick(current_cycle);
+  if (pf_throttle.enabled)
+    update_prefetch_throttle();
 
   auto tag_bw = MAX_TAG;
   auto fill_bw = MAX_FILL;
@@ -424,8 +567,19 @@ void CACHE::operate()
     return queues.is_ready(pkt) && (this->try_hit(pkt) || this->handle_write(pkt));
   };
 
-  for (auto q : {std::ref(MSHR), std::ref(inflight_writes)})
-    fill_bw -= operate_queue(q.get(), fill_bw, do_fill);
+  fill_bw -= operate_queue(MSHR, fill_bw, [&, this](const mshr_entry& x) {
+    if (!do_fill(x.pkt))
+      return false;
+    sim_stats.back().mshr_fills++;
+    sim_stats.back().mshr_demand_sectors += static_cast<uint64_t>(std::bitset<64>{x.demand_sectors}.count());
+    return true;
+  });
+  fill_bw -= operate_queue(inflight_writes, fill_bw, do_fill);
+  stage_fills();
+
+  sim_stats.back().mshr_occupancy += std::size(MSHR);
+  sim_stats.back().mshr_cycles++;
+  sim_stats.back().mshr_peak = std::max(sim_stats.back().mshr_peak, std::size(MSHR));
 
   if (match_offset_bits) {
     // Treat writes (that is, stores) like reads
@@ -441,6 +595,43 @@ void CACHE::operate()
   impl_prefetcher_cycle_operate();
 }
 
+// Returned misses beyond the fill buffers wait for one, and only start their fill latency once they have it
+void CACHE::stage_fills()
+{
+  if (mshr_spec.fill_buffers == 0)
+    return;
+
+  auto returned_end = std::find_if(std::begin(MSHR), std::end(MSHR), [](const auto& x) { return x.pkt.event_cycle == std::numeric_limits<uint64_t>::max(); });
+  if (static_cast<std::size_t>(std::distance(std::begin(MSHR), returned_end)) <= mshr_spec.fill_buffers)
+    return;
+
+  // the next free fill buffer goes to the oldest waiting demand miss
+  auto waiting = std::next(std::begin(MSHR), static_cast<long>(mshr_spec.fill_buffers));
+  std::stable_partition(waiting, returned_end, [](const auto& x) { return x.pkt.type != PREFETCH; });
+  for (auto it = waiting; it != returned_end; ++it) {
+    it->pkt.event_cycle = std::max(it->pkt.event_cycle, current_cycle + 1 + (warmup ? 0 : FILL_LATENCY));
+    sim_stats.back().fill_buffer_waits++;
+  }
+}
+
+// sub-blocks of its line a request asks for: those of the instructions waiting on it, or the one of its address
+uint64_t CACHE::sector_mask(const PACKET& pkt) const
+{
+  if (mshr_spec.sectors <= 1)
+    return 1;
+
+  const auto sector_shift = OFFSET_BITS - champsim::lg2(mshr_spec.sectors);
+  auto sector_of = [&](uint64_t addr) { return uint64_t{1} << ((addr & champsim::bitmask(OFFSET_BITS)) >> sector_shift); };
+
+  if (std::empty(pkt.instr_depend_on_me))
+    return sector_of(pkt.v_address != 0 ? pkt.v_address : pkt.address);
+
+  uint64_t mask = 0;
+  for (const ooo_model_instr& instr : pkt.instr_depend_on_me)
+    mask |= sector_of(instr.ip);
+  return mask;
+}
+
 uint64_t CACHE::get_set(uint64_t address) const { return get_set_index(address); }
 
 std::size_t CACHE::get_set_index(uint64_t address) const { return (address >> OFFSET_BITS) & champsim::bitmask(champsim::lg2(NUM_SET)); }
@@ -532,16 +723,93 @@ int CACHE::prefetch_line_pkt(PACKET& pf_packet)
   pf_packet.address = pf_base_addr;
 
   auto success = this->add_pq(pf_packet);
-  if (success)
+  if (success) {
     ++sim_stats.back().pf_issued;
+    sim_stats.back().pf_telemetry[champsim::prefetch_source::UOP_CACHE].issued++;
+  }
 
   return success;
 }
 
+void CACHE::update_prefetch_throttle()
+{
+  if (memory_controller != nullptr) {
+    pf_epoch.dram_occupancy += memory_controller->get_occupancy(1, 0);
+    pf_epoch.dram_size += memory_controller->get_size(1, 0);
+  }
+
+  if (pf_epoch.end_cycle == 0)
+    pf_epoch.end_cycle = current_cycle + pf_throttle.epoch;
+  if (current_cycle < pf_epoch.end_cycle)
+    return;
+
+  const auto& now = sim_stats.back().pf_telemetry[champsim::prefetch_source::MODULE];
+  prefetch_controller::epoch_sample sample;
+  sample.issued = now.issued - pf_epoch.at_begin.issued;
+  sample.useful = now.useful - pf_epoch.at_begin.useful;
+  sample.late = now.late - pf_epoch.at_begin.late;
+  sample.demand_misses = pf_epoch.demand_misses;
+  sample.polluting_misses = pf_epoch.polluting_misses;
+  sample.dram_occupancy = pf_epoch.dram_size > 0 ? static_cast<double>(pf_epoch.dram_occupancy) / static_cast<double>(pf_epoch.dram_size) : 0.0;
+
+  auto change = pf_controller.end_epoch(sample);
+  if (change > 0)
+    sim_stats.back().pf_throttle_up++;
+  else if (change < 0)
+    sim_stats.back().pf_throttle_down++;
+  sim_stats.back().pf_level_epochs[pf_controller.level()]++;
+
+  pf_epoch = {};
+  pf_epoch.end_cycle = current_cycle + pf_throttle.epoch;
+  pf_epoch.at_begin = now;
+  for (auto& filter : pf_evicted)
+    filter.clear();
+}
+
+bool CACHE::drop_redundant_prefetch(uint64_t pf_addr)
+{
+  const uint64_t line = pf_addr >> OFFSET_BITS;
+  if (recent_prefetches.recently_requested(line)) {
+    sim_stats.back().pf_filtered_recent++;
+    return true;
+  }
+
+  // the uop cache only knows virtual addresses
+  if (virtual_prefetch) {
+    if (std::any_of(std::begin(UOP_CACHE_MSHR), std::end(UOP_CACHE_MSHR), [line](const uop_mshr_entry& x) { return x.cache_line_addr == line; })) {
+      sim_stats.back().pf_filtered_uop_mshr++;
+      return true;
+    }
+    if (uop_cache_holds_line && uop_cache_holds_line(pf_addr)) {
+      sim_stats.back().pf_filtered_uop_cache++;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void CACHE::record_uop_prefetch(uint64_t v_address)
+{
+#ifdef PREF_FILTER
+  if (virtual_prefetch)
+    recent_prefetches.record(v_address >> OFFSET_BITS);
+#endif
+}
+
 int CACHE::prefetch_line(uint64_t pf_addr, bool fill_this_level, uint32_t prefetch_metadata)
 {
   // cout << "Prefetched! " << std::hex << pf_addr << std::dec << endl;
   sim_stats.back().pf_requested++;
+
+#ifdef PREF_FILTER
+  // a dropped prefetch is reported as issued, the line is already covered
+  if (NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0 && drop_redundant_prefetch(pf_addr)) {
+    sim_stats.back().pf_telemetry[champsim::prefetch_source::MODULE].redundant++;
+    return true;
+  }
+#endif
+
   PACKET pf_packet;
   pf_packet.type = PREFETCH;
   pf_packet.prefetch_from_this = true;
@@ -550,10 +818,18 @@ int CACHE::prefetch_line(uint64_t pf_addr, bool fill_this_level, uint32_t prefet
   pf_packet.cpu = cpu;
   pf_packet.address = pf_addr;
   pf_packet.v_address = virtual_prefetch ? pf_addr : 0;
+  pf_packet.instruction = NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0;
 
   auto success = this->add_pq(pf_packet);
-  if (success)
+  if (success) {
     ++sim_stats.back().pf_issued;
+    sim_stats.back().pf_telemetry[champsim::prefetch_source::MODULE].issued++;
+#ifdef PREF_FILTER
+    // a prefetch that stops at the lower level does not make an L1I prefetch of the line redundant
+    if (fill_this_level && NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0)
+      recent_prefetches.record(pf_addr >> OFFSET_BITS);
+#endif
+  }
 
   return success;
 }
@@ -578,8 +854,8 @@ void CACHE::return_data(const PACKET& packet)
 {
 
   // check MSHR information
-  auto mshr_entry = std::find_if(MSHR.begin(), MSHR.end(), eq_addr<PACKET>(packet.address, OFFSET_BITS));
-  auto first_unreturned = std::find_if(MSHR.begin(), MSHR.end(), [](auto x) { return x.event_cycle == std::numeric_limits<uint64_t>::max(); });
+  auto mshr_entry = std::find_if(MSHR.begin(), MSHR.end(), mshr_match(packet.address, OFFSET_BITS));
+  auto first_unreturned = std::find_if(MSHR.begin(), MSHR.end(), [](const auto& x) { return x.pkt.event_cycle == std::numeric_limits<uint64_t>::max(); });
 
   // sanity check
   if (mshr_entry == MSHR.end()) {
@@ -594,20 +870,44 @@ void CACHE::return_data(const PACKET& packet)
     // return;
   }
 
+  // the page table walker dropped the speculative walk of an unmapped page, there is no translation to fill
+  if (packet.page_not_present) {
+    auto dropped = mshr_entry->pkt;
+    MSHR.erase(mshr_entry);
+    if (dropped.type == PREFETCH) {
+      for (auto ret : dropped.to_return)
+        ret->return_data(packet);
+    } else {
+      // a demand miss merged into it, it is replayed to walk the page
+      dropped.event_cycle = current_cycle;
+      queues.RQ.push_front(dropped);
+    }
+    return;
+  }
+
   // MSHR holds the most updated information about this request
-  mshr_entry->data = packet.data;
-  mshr_entry->pf_metadata = packet.pf_metadata;
-  mshr_entry->event_cycle = current_cycle + (warmup ? 0 : FILL_LATENCY);
+  mshr_entry->pkt.data = packet.data;
+  mshr_entry->pkt.pf_metadata = packet.pf_metadata;
+  mshr_entry->pkt.page_shift = packet.page_shift;
+  mshr_entry->pkt.event_cycle = current_cycle + (warmup ? 0 : FILL_LATENCY);
+
+#ifdef PREFETCH_PATHS
+  // the uop cache prefetch decoder takes the line from the fill buffer
+  if (mshr_spec.decode_bypass && mshr_entry->pkt.type == PREFETCH && NAME.length() >= 3 && NAME.compare(NAME.length() - 3, 3, "L1I") == 0) {
+    if (update_dib_from_prefetch(mshr_entry->pkt))
+      sim_stats.back().decode_bypass++;
+  }
+#endif
 
   // if (mshr_entry->instr_id == 51541377) {
   //   cout << __func__ << NAME << " " << current_cycle << endl;
   // }
 
   if constexpr (champsim::debug_print) {
-    std::cout << "[" << NAME << "_MSHR] " << __func__ << " instr_id: " << mshr_entry->instr_id;
-    std::cout << " address: " << std::hex << mshr_entry->address;
-    std::cout << " data: " << mshr_entry->data << std::dec;
-    std::cout << " event: " << mshr_entry->event_cycle << " current: " << current_cycle << std::endl;
+    std::cout << "[" << NAME << "_MSHR] " << __func__ << " instr_id: " << mshr_entry->pkt.instr_id;
+    std::cout << " address: " << std::hex << mshr_entry->pkt.address;
+    std::cout << " data: " << mshr_entry->pkt.data << std::dec;
+    std::cout << " event: " << mshr_entry->pkt.event_cycle << " current: " << current_cycle << std::endl;
   }
 
   // Order this entry after previously-returned entries, but before non-returned
@@ -647,6 +947,25 @@ std::size_t CACHE::get_size(uint8_t queue_type, uint64_t)
 
 void CACHE::initialize()
 {
+  assert(mshr_spec.sectors > 0 && mshr_spec.sectors <= 64 && (mshr_spec.sectors & (mshr_spec.sectors - 1)) == 0);
+  assert(champsim::lg2(mshr_spec.sectors) <= OFFSET_BITS);
+
+  // the memory controller is the first level below that is not a cache
+  memory_controller = lower_level;
+  while (auto lower_cache = dynamic_cast<CACHE*>(memory_controller))
+    memory_controller = lower_cache->lower_level;
+
+  // the two modules duel in the order of their bits in repl_type
+  if (repl_duel_spec.enabled) {
+    assert(repl_type.count() == champsim::set_dueling::NUM_POLICIES);
+    std::size_t policy = 0;
+    for (std::size_t bit = 0; bit < std::size(repl_type); ++bit) {
+      if (repl_type[bit])
+        repl_duel_modules[policy++] = bit;
+    }
+    repl_duel.emplace(NUM_SET, NUM_CPUS, repl_duel_spec.leader_sets);
+  }
+
   impl_prefetcher_initialize();
   impl_initialize_replacement();
 }
@@ -658,6 +977,9 @@ void CACHE::begin_phase()
 
   roi_stats.back().name = NAME;
   sim_stats.back().name = NAME;
+
+  // the counters of the epoch are taken from the new phase's stats
+  pf_epoch = {};
 }
 
 void CACHE::end_phase(unsigned finished_cpu)
@@ -672,8 +994,32 @@ void CACHE::end_phase(unsigned finished_cpu)
   roi_stats.back().pf_useful = sim_stats.back().pf_useful;
   roi_stats.back().pf_useless = sim_stats.back().pf_useless;
   roi_stats.back().pf_fill = sim_stats.back().pf_fill;
+  roi_stats.back().pf_filtered_recent = sim_stats.back().pf_filtered_recent;
+  roi_stats.back().pf_filtered_uop_cache = sim_stats.back().pf_filtered_uop_cache;
+  roi_stats.back().pf_filtered_uop_mshr = sim_stats.back().pf_filtered_uop_mshr;
+  roi_stats.back().pf_telemetry = sim_stats.back().pf_telemetry;
 
   roi_stats.back().total_miss_latency = sim_stats.back().total_miss_latency;
+
+  roi_stats.back().mshr_demand_full_cycles = sim_stats.back().mshr_demand_full_cycles;
+  roi_stats.back().mshr_prefetch_full_cycles = sim_stats.back().mshr_prefetch_full_cycles;
+  roi_stats.back().mshr_late_prefetch = sim_stats.back().mshr_late_prefetch;
+  roi_stats.back().mshr_occupancy = sim_stats.back().mshr_occupancy;
+  roi_stats.back().mshr_cycles = sim_stats.back().mshr_cycles;
+  roi_stats.back().mshr_peak = sim_stats.back().mshr_peak;
+  roi_stats.back().fill_buffer_waits = sim_stats.back().fill_buffer_waits;
+  roi_stats.back().mshr_fills = sim_stats.back().mshr_fills;
+  roi_stats.back().mshr_demand_sectors = sim_stats.back().mshr_demand_sectors;
+  roi_stats.back().decode_bypass = sim_stats.back().decode_bypass;
+  roi_stats.back().pf_throttle_up = sim_stats.back().pf_throttle_up;
+  roi_stats.back().pf_throttle_down = sim_stats.back().pf_throttle_down;
+  roi_stats.back().pf_level_epochs = sim_stats.back().pf_level_epochs;
+  roi_stats.back().pf_polluting_misses = sim_stats.back().pf_polluting_misses;
+  roi_stats.back().repl_duel_victims = sim_stats.back().repl_duel_victims;
+  roi_stats.back().code_fills = sim_stats.back().code_fills;
+  roi_stats.back().code_evicted_by_data = sim_stats.back().code_evicted_by_data;
+  roi_stats.back().code_evicted_by_code = sim_stats.back().code_evicted_by_code;
+  roi_stats.back().code_protected = sim_stats.back().code_protected;
 }
 
 bool CACHE::should_activate_prefetcher(const PACKET& pkt) const { return ((1 << pkt.type) & pref_activate_mask) && !pkt.prefetch_from_this; }
@@ -683,10 +1029,10 @@ void CACHE::print_deadlock()
   if (!std::empty(MSHR)) {
     std::cout << NAME << " MSHR Entry" << std::endl;
     std::size_t j = 0;
-    for (PACKET entry : MSHR) {
+    for (const auto& [entry, demand_sectors, prefetch_sectors] : MSHR) {
       std::cout << "[" << NAME << " MSHR] entry: " << j++ << " instr_id: " << entry.instr_id;
       std::cout << " address: " << std::hex << entry.address << " v_addr: " << entry.v_address << std::dec << " type: " << +entry.type;
-      std::cout << " event_cycle: " << entry.event_cycle << std::endl;
+      std::cout << " event_cycle: " << entry.event_cycle << std::hex << " sectors: " << demand_sectors << "/" << prefetch_sectors << std::dec << std::endl;
     }
   } else {
     std::cout << NAME << " MSHR empty" << std::endl;
@@ -28,101 +28,166 @@ void CACHE::TranslatingQueues::operate()
   detect_misses();
 }
 
-template <typename Iter, typename F>
-bool do_collision_for(Iter begin, Iter end, PACKET& packet, unsigned shamt, F&& func)
+void merge_dependents(PACKET& destination, const PACKET& source)
 {
-  auto found = std::find_if(begin, end, eq_addr<PACKET>(packet.address, shamt));
-
-  if (found != end) {
-    if (!packet.is_translated || !(*found).is_translated) {
-      // We make sure that both merge packet address have been translated. If
-      // not this can happen: package with address virtual and physical X
-      // (not translated) is inserted, package with physical address
-      // (already translated) X.
-      return false;
+  auto instr_copy = std::move(destination.instr_depend_on_me);
+  auto ret_copy = std::move(destination.to_return);
+
+  std::set_union(std::begin(instr_copy), std::end(instr_copy), std::begin(source.instr_depend_on_me), std::end(source.instr_depend_on_me),
+                 std::back_inserter(destination.instr_depend_on_me), ooo_model_instr::program_order);
+  std::set_union(std::begin(ret_copy), std::end(ret_copy), std::begin(source.to_return), std::end(source.to_return), std::back_inserter(destination.to_return));
+}
+
+void queue_line_index::reset(std::size_t queue_size)
+{
+  // at most half full, so that probes stay short and always end on a free slot
+  std::size_t capacity = 2;
+  while (capacity < 2 * queue_size)
+    capacity <<= 1;
+  if (std::size(slots) < capacity)
+    slots.assign(capacity, slot_t{});
+  epoch++;
+}
+
+std::size_t queue_line_index::home_slot(uint64_t line) const
+{
+  uint64_t h = line * 0x9E3779B97F4A7C15ull;
+  return static_cast<std::size_t>(h ^ (h >> 32)) & (std::size(slots) - 1);
+}
+
+std::size_t queue_line_index::find(uint64_t line) const
+{
+  for (auto i = home_slot(line);; i = (i + 1) & (std::size(slots) - 1)) {
+    if (slots[i].epoch != epoch)
+      return NONE;
+    if (slots[i].line == line)
+      return slots[i].pos;
+  }
+}
+
+void queue_line_index::insert(uint64_t line, std::size_t pos)
+{
+  for (auto i = home_slot(line);; i = (i + 1) & (std::size(slots) - 1)) {
+    if (slots[i].epoch != epoch) {
+      slots[i] = {line, pos, epoch};
+      return;
     }
-    func(packet, *found);
-    return true;
+    if (slots[i].line == line)
+      return;
   }
+}
 
-  return false;
+namespace
+{
+template <typename R>
+std::size_t first_unchecked(const R& queue)
+{
+  return static_cast<std::size_t>(std::distance(std::begin(queue), std::find_if(std::begin(queue), std::end(queue), std::not_fn(&PACKET::forward_checked))));
 }
 
-template <typename Iter>
-bool do_collision_for_merge(Iter begin, Iter end, PACKET& packet, unsigned shamt)
+// index the packets of queue[0, last), invalid (untranslated) packets never match
+template <typename R>
+void index_lines(queue_line_index& index, const R& queue, std::size_t last, unsigned shamt)
 {
-  return do_collision_for(begin, end, packet, shamt, [](PACKET& source, PACKET& destination) {
-    if (source.fill_this_level || destination.fill_this_level) {
-      // If one of the package will fill this level the resulted package should
-      // also fill this level
-      destination.fill_this_level = true;
-    }
+  index.reset(std::size(queue));
+  for (std::size_t pos = 0; pos < last; ++pos) {
+    if (is_valid<PACKET>{}(queue[pos]))
+      index.insert(queue[pos].address >> shamt, pos);
+  }
+}
 
-    auto instr_copy = std::move(destination.instr_depend_on_me);
-    auto ret_copy = std::move(destination.to_return);
+// the first packet of the indexed queue with the same line as the packet, if both are translated
+template <typename R>
+PACKET* find_collision(const queue_line_index& index, R& queue, const PACKET& packet, unsigned shamt)
+{
+  if (!is_valid<PACKET>{}(packet))
+    return nullptr;
+
+  auto pos = index.find(packet.address >> shamt);
+  if (pos == queue_line_index::NONE)
+    return nullptr;
+
+  // We make sure that both merge packet address have been translated. If
+  // not this can happen: package with address virtual and physical X
+  // (not translated) is inserted, package with physical address
+  // (already translated) X.
+  PACKET& found = queue[pos];
+  if (!packet.is_translated || !found.is_translated)
+    return nullptr;
+  return &found;
+}
 
-    std::set_union(std::begin(instr_copy), std::end(instr_copy), std::begin(source.instr_depend_on_me), std::end(source.instr_depend_on_me),
-                   std::back_inserter(destination.instr_depend_on_me), ooo_model_instr::program_order);
-    std::set_union(std::begin(ret_copy), std::end(ret_copy), std::begin(source.to_return), std::end(source.to_return),
-                   std::back_inserter(destination.to_return));
+void merge_packet(PACKET& source, PACKET& destination)
+{
+  if (source.fill_this_level || destination.fill_this_level) {
+    // If one of the package will fill this level the resulted package should
+    // also fill this level
+    destination.fill_this_level = true;
+  }
 
-  });
+  merge_dependents(destination, source);
 }
 
-template <typename Iter>
-bool do_collision_for_return(Iter begin, Iter end, PACKET& packet, unsigned shamt)
+void return_packet(PACKET& source, const PACKET& destination)
 {
-  return do_collision_for(begin, end, packet, shamt, [](PACKET& source, PACKET& destination) {
-    source.data = destination.data;
-    source.pf_metadata = destination.pf_metadata;
-    for (auto ret : source.to_return)
-      ret->return_data(source);
-  });
+  source.data = destination.data;
+  source.pf_metadata = destination.pf_metadata;
+  for (auto ret : source.to_return)
+    ret->return_data(source);
 }
+} // namespace
 
 void CACHE::NonTranslatingQueues::check_collision()
 {
   auto write_shamt = match_offset_bits ? 0 : OFFSET_BITS;
   auto read_shamt = OFFSET_BITS;
 
-  // Check WQ for duplicates, merging if they are found
-  for (auto wq_it = std::find_if(std::begin(WQ), std::end(WQ), std::not_fn(&PACKET::forward_checked)); wq_it != std::end(WQ);) {
-    if (do_collision_for_merge(std::begin(WQ), wq_it, *wq_it, write_shamt)) {
+  auto wq_begin = first_unchecked(WQ);
+  auto rq_begin = first_unchecked(RQ);
+  auto pq_begin = first_unchecked(PQ);
+  if (wq_begin == std::size(WQ) && rq_begin == std::size(RQ) && pq_begin == std::size(PQ))
+    return;
+
+  // Check WQ for duplicates, merging if they are found. The index then holds the whole WQ for the forwarding checks.
+  index_lines(wq_lines, WQ, wq_begin, write_shamt);
+  for (auto pos = wq_begin; pos < std::size(WQ);) {
+    auto& wq_entry = WQ[pos];
+    if (auto found = find_collision(wq_lines, WQ, wq_entry, write_shamt); found != nullptr) {
+      merge_packet(wq_entry, *found);
       sim_stats.back().WQ_MERGED++;
-      wq_it = WQ.erase(wq_it);
+      WQ.erase(std::next(std::begin(WQ), static_cast<long>(pos)));
     } else {
-      wq_it->forward_checked = true;
-      ++wq_it;
+      wq_entry.forward_checked = true;
+      if (is_valid<PACKET>{}(wq_entry))
+        wq_lines.insert(wq_entry.address >> write_shamt, pos);
+      ++pos;
     }
   }
 
-  // Check RQ for forwarding from WQ (return if found), then for duplicates (merge if found)
-  for (auto rq_it = std::find_if(std::begin(RQ), std::end(RQ), std::not_fn(&PACKET::forward_checked)); rq_it != std::end(RQ);) {
-    if (do_collision_for_return(std::begin(WQ), std::end(WQ), *rq_it, write_shamt)) {
-      sim_stats.back().WQ_FORWARD++;
-      rq_it = RQ.erase(rq_it);
-    } else if (do_collision_for_merge(std::begin(RQ), rq_it, *rq_it, read_shamt)) {
-      sim_stats.back().RQ_MERGED++;
-      rq_it = RQ.erase(rq_it);
-    } else {
-      rq_it->forward_checked = true;
-      ++rq_it;
+  // Check RQ and PQ for forwarding from WQ (return if found), then for duplicates (merge if found)
+  auto check_read_queue = [&](auto& queue, std::size_t begin, uint64_t cache_queue_stats::*merged) {
+    index_lines(line_index, queue, begin, read_shamt);
+    for (auto pos = begin; pos < std::size(queue);) {
+      auto& entry = queue[pos];
+      if (auto fwd = find_collision(wq_lines, WQ, entry, write_shamt); fwd != nullptr) {
+        return_packet(entry, *fwd);
+        sim_stats.back().WQ_FORWARD++;
+        queue.erase(std::next(std::begin(queue), static_cast<long>(pos)));
+      } else if (auto found = find_collision(line_index, queue, entry, read_shamt); found != nullptr) {
+        merge_packet(entry, *found);
+        sim_stats.back().*merged += 1;
+        queue.erase(std::next(std::begin(queue), static_cast<long>(pos)));
+      } else {
+        entry.forward_checked = true;
+        if (is_valid<PACKET>{}(entry))
+          line_index.insert(entry.address >> read_shamt, pos);
+        ++pos;
+      }
     }
-  }
+  };
 
-  // Check PQ for forwarding from WQ (return if found), then for duplicates (merge if found)
-  for (auto pq_it = std::find_if(std::begin(PQ), std::end(PQ), std::not_fn(&PACKET::forward_checked)); pq_it != std::end(PQ);) {
-    if (do_collision_for_return(std::begin(WQ), std::end(WQ), *pq_it, write_shamt)) {
-      sim_stats.back().WQ_FORWARD++;
-      pq_it = PQ.erase(pq_it);
-    } else if (do_collision_for_merge(std::begin(PQ), pq_it, *pq_it, read_shamt)) {
-      sim_stats.back().PQ_MERGED++;
-      pq_it = PQ.erase(pq_it);
-    } else {
-      pq_it->forward_checked = true;
-      ++pq_it;
-    }
-  }
+  check_read_queue(RQ, rq_begin, &cache_queue_stats::RQ_MERGED);
+  check_read_queue(PQ, pq_begin, &cache_queue_stats::PQ_MERGED);
 }
 
 void CACHE::TranslatingQueues::issue_translation()
@@ -287,26 +352,27 @@ void CACHE::TranslatingQueues::return_data(const PACKET& packet)
     std::cout << " event: " << packet.event_cycle << " current: " << current_cycle << std::endl;
   }
 
-  // Find all packets that match the page of the returned packet
+  // Find all packets that match the page of the returned packet, a huge page translates all of its base pages
+  const unsigned page_shift = packet.page_shift != 0 ? packet.page_shift : LOG2_PAGE_SIZE;
   for (auto& wq_entry : WQ) {
-    if ((wq_entry.v_address >> LOG2_PAGE_SIZE) == (packet.v_address >> LOG2_PAGE_SIZE)) {
-      wq_entry.address = champsim::splice_bits(packet.data, wq_entry.v_address, LOG2_PAGE_SIZE); // translated address
+    if ((wq_entry.v_address >> page_shift) == (packet.v_address >> page_shift)) {
+      wq_entry.address = champsim::splice_bits(packet.data, wq_entry.v_address, page_shift); // translated address
       wq_entry.event_cycle = std::min(wq_entry.event_cycle, current_cycle + (warmup ? 0 : HIT_LATENCY));
       wq_entry.is_translated = true; // This entry is now translated
     }
   }
 
   for (auto& rq_entry : RQ) {
-    if ((rq_entry.v_address >> LOG2_PAGE_SIZE) == (packet.v_address >> LOG2_PAGE_SIZE)) {
-      rq_entry.address = champsim::splice_bits(packet.data, rq_entry.v_address, LOG2_PAGE_SIZE); // translated address
+    if ((rq_entry.v_address >> page_shift) == (packet.v_address >> page_shift)) {
+      rq_entry.address = champsim::splice_bits(packet.data, rq_entry.v_address, page_shift); // translated address
       rq_entry.event_cycle = std::min(rq_entry.event_cycle, current_cycle + (warmup ? 0 : HIT_LATENCY));
       rq_entry.is_translated = true; // This entry is now translated
     }
   }
 
   for (auto& pq_entry : PQ) {
-    if ((pq_entry.v_address >> LOG2_PAGE_SIZE) == (packet.v_address >> LOG2_PAGE_SIZE)) {
-      pq_entry.address = champsim::splice_bits(packet.data, pq_entry.v_address, LOG2_PAGE_SIZE); // translated address
+    if ((pq_entry.v_address >> page_shift) == (packet.v_address >> page_shift)) {
+      pq_entry.address = champsim::splice_bits(packet.data, pq_entry.v_address, page_shift); // translated address
       pq_entry.event_cycle = std::min(pq_entry.event_cycle, current_cycle + (warmup ? 0 : HIT_LATENCY));
       pq_entry.is_translated = true; // This entry is now translated
     }
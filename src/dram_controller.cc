@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <tuple>
 
 #include "champsim_constants.h"
 #include "instruction.h"
@@ -31,10 +32,43 @@ uint64_t cycles(double time, int io_freq)
   return result < 0 ? 0 : static_cast<uint64_t>(result);
 }
 
-MEMORY_CONTROLLER::MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround)
+dram_request_class request_class(const PACKET& packet)
+{
+  if (packet.type == TRANSLATION)
+    return dram_request_class::critical;
+  if (packet.uop_pref || (packet.type == PREFETCH && packet.instruction))
+    return dram_request_class::instruction_prefetch;
+  if (packet.type == PREFETCH)
+    return dram_request_class::prefetch;
+  return packet.instruction ? dram_request_class::critical : dram_request_class::demand;
+}
+
+MEMORY_CONTROLLER::MEMORY_CONTROLLER(double freq_scale, int io_freq, double t_rp, double t_rcd, double t_cas, double turnaround, dram_timing_spec spec,
+                                     dram_scheduler_spec scheduling)
     : champsim::operable(freq_scale), tRP(cycles(t_rp / 1000, io_freq)), tRCD(cycles(t_rcd / 1000, io_freq)), tCAS(cycles(t_cas / 1000, io_freq)),
-      DRAM_DBUS_TURN_AROUND_TIME(cycles(turnaround / 1000, io_freq)), DRAM_DBUS_RETURN_TIME(cycles(std::ceil(BLOCK_SIZE) / std::ceil(DRAM_CHANNEL_WIDTH), 1))
+      DRAM_DBUS_TURN_AROUND_TIME(cycles(turnaround / 1000, io_freq)), DRAM_DBUS_RETURN_TIME(cycles(std::ceil(BLOCK_SIZE) / std::ceil(DRAM_CHANNEL_WIDTH), 1)),
+      timing_spec(spec), scheduler_spec(scheduling)
 {
+  if (timing_spec.detailed) {
+    dram_timing_model::cycles_type timing{tRP,
+                                          tRCD,
+                                          tCAS,
+                                          cycles(spec.tRAS / 1000, io_freq),
+                                          cycles(spec.tWR / 1000, io_freq),
+                                          cycles(spec.tWTR / 1000, io_freq),
+                                          cycles(spec.tRTP / 1000, io_freq),
+                                          cycles(spec.tCCD_S / 1000, io_freq),
+                                          cycles(spec.tCCD_L / 1000, io_freq),
+                                          cycles(spec.tRRD_S / 1000, io_freq),
+                                          cycles(spec.tRRD_L / 1000, io_freq),
+                                          cycles(spec.tFAW / 1000, io_freq),
+                                          cycles(spec.tREFI / 1000, io_freq),
+                                          cycles(spec.tRFC / 1000, io_freq),
+                                          cycles(spec.tRFCpb / 1000, io_freq),
+                                          DRAM_DBUS_RETURN_TIME};
+    for (auto& channel : channels)
+      channel.timing.emplace(timing, spec.refresh, spec.page_policy);
+  }
 }
 
 void MEMORY_CONTROLLER::operate()
@@ -50,6 +84,9 @@ void MEMORY_CONTROLLER::operate()
 
       for (auto& entry : channel.WQ)
         entry = {};
+
+      channel.RQ_index.clear();
+      channel.WQ_index.clear();
     }
 
     // Check for forwarding
@@ -62,19 +99,28 @@ void MEMORY_CONTROLLER::operate()
 
       channel.active_request->valid = false;
 
-      *channel.active_request->pkt = {};
+      auto& queue = channel.active_request->is_write ? channel.WQ : channel.RQ;
+      channel.erase(channel.active_request->is_write, static_cast<std::size_t>(std::distance(std::begin(queue), channel.active_request->pkt)));
       channel.active_request = std::end(channel.bank_request);
     }
 
+    if (channel.timing.has_value())
+      channel.sim_stats.back().REFRESHES += channel.timing->refresh(current_cycle);
+
+    if (scheduler_spec.fairness == dram_fairness::bliss && current_cycle >= channel.next_blacklist_clear) {
+      channel.blacklisted = {};
+      channel.next_blacklist_clear = current_cycle + scheduler_spec.bliss_clear_interval;
+    }
+
     // Check queue occupancy
-    auto wq_occu = static_cast<std::size_t>(std::count_if(std::begin(channel.WQ), std::end(channel.WQ), [](const auto& x) { return x.address != 0; }));
-    auto rq_occu = static_cast<std::size_t>(std::count_if(std::begin(channel.RQ), std::end(channel.RQ), [](const auto& x) { return x.address != 0; }));
+    auto wq_occu = channel.WQ_index.size();
+    auto rq_occu = channel.RQ_index.size();
 
     // Change modes if the queues are unbalanced
     if ((!channel.write_mode && (wq_occu >= DRAM_WRITE_HIGH_WM || (rq_occu == 0 && wq_occu > 0)))
         || (channel.write_mode && (wq_occu == 0 || (rq_occu > 0 && wq_occu < DRAM_WRITE_LOW_WM)))) {
-      // Reset scheduled requests
-      for (auto it = std::begin(channel.bank_request); it != std::end(channel.bank_request); ++it) {
+      // Reset scheduled requests. The detailed timing model has already committed their commands, so they drain instead.
+      for (auto it = std::begin(channel.bank_request); it != std::end(channel.bank_request) && !channel.timing.has_value(); ++it) {
         // Leave active request on the data bus
         if (it != channel.active_request && it->valid) {
           // Leave rows charged
@@ -85,6 +131,11 @@ void MEMORY_CONTROLLER::operate()
           it->valid = false;
           it->pkt->scheduled = false;
           it->pkt->event_cycle = current_cycle;
+          if (is_valid<PACKET>{}(*it->pkt)) {
+            auto& queue = it->is_write ? channel.WQ : channel.RQ;
+            auto& index = it->is_write ? channel.WQ_index : channel.RQ_index;
+            index.make_ready(static_cast<std::size_t>(std::distance(std::begin(queue), it->pkt)), current_cycle);
+          }
         }
       }
 
@@ -109,11 +160,11 @@ void MEMORY_CONTROLLER::operate()
         channel.active_request->event_cycle = current_cycle + DRAM_DBUS_RETURN_TIME;
 
         if (iter_next_process->row_buffer_hit)
-          if (channel.write_mode)
+          if (iter_next_process->is_write)
             channel.sim_stats.back().WQ_ROW_BUFFER_HIT++;
           else
             channel.sim_stats.back().RQ_ROW_BUFFER_HIT++;
-        else if (channel.write_mode)
+        else if (iter_next_process->is_write)
           channel.sim_stats.back().WQ_ROW_BUFFER_MISS++;
         else
           channel.sim_stats.back().RQ_ROW_BUFFER_MISS++;
@@ -128,16 +179,10 @@ void MEMORY_CONTROLLER::operate()
     }
 
     // Look for queued packets that have not been scheduled
-    auto next_schedule = [](const auto& lhs, const auto& rhs) {
-      return !(rhs.address != 0 && !rhs.scheduled) || ((lhs.address != 0 && !lhs.scheduled) && lhs.event_cycle < rhs.event_cycle);
-    };
-    std::vector<PACKET>::iterator iter_next_schedule;
-    if (channel.write_mode)
-      iter_next_schedule = std::min_element(std::begin(channel.WQ), std::end(channel.WQ), next_schedule);
-    else
-      iter_next_schedule = std::min_element(std::begin(channel.RQ), std::end(channel.RQ), next_schedule);
-
-    if (is_valid<PACKET>()(*iter_next_schedule) && iter_next_schedule->event_cycle <= current_cycle) {
+    auto& queue = channel.write_mode ? channel.WQ : channel.RQ;
+    auto& index = channel.write_mode ? channel.WQ_index : channel.RQ_index;
+    if (auto slot = next_schedule(channel); slot != dram_queue_index::NONE) {
+      auto iter_next_schedule = std::next(std::begin(queue), static_cast<long>(slot));
       uint32_t op_rank = dram_get_rank(iter_next_schedule->address), op_bank = dram_get_bank(iter_next_schedule->address),
                op_row = dram_get_row(iter_next_schedule->address);
 
@@ -145,15 +190,196 @@ void MEMORY_CONTROLLER::operate()
 
       if (!channel.bank_request[op_idx].valid) {
         bool row_buffer_hit = (channel.bank_request[op_idx].open_row == op_row);
+        uint64_t data_cycle = current_cycle + tCAS + (row_buffer_hit ? 0 : tRP + tRCD);
+
+        if (channel.timing.has_value()) {
+          // the adaptive policy keeps the row open only for a queued packet that hits it
+          bool keep_open = channel.timing->page_policy() == dram_page_policy::open
+                           || (channel.timing->page_policy() == dram_page_policy::adaptive && index.any_ready(op_idx, [&](std::size_t other) {
+                                 return other != slot && dram_get_row(queue[other].address) == op_row;
+                               }));
+          auto result = channel.timing->access(op_rank, op_bank, op_row, channel.write_mode, keep_open, current_cycle);
+          row_buffer_hit = result.row_buffer_hit;
+          data_cycle = result.data_cycle;
+        }
 
         // this bank is now busy
-        channel.bank_request[op_idx] = {true, row_buffer_hit, op_row, current_cycle + tCAS + (row_buffer_hit ? 0 : tRP + tRCD), iter_next_schedule};
+        channel.bank_request[op_idx] = {true, row_buffer_hit, op_row, data_cycle, iter_next_schedule, channel.write_mode};
 
         iter_next_schedule->scheduled = true;
         iter_next_schedule->event_cycle = std::numeric_limits<uint64_t>::max();
+        index.remove_ready(slot);
+
+        if (!channel.write_mode) {
+          if (channel.RQ_class[slot] == dram_request_class::critical)
+            channel.sim_stats.back().RQ_CRITICAL++;
+          note_served(channel, *iter_next_schedule);
+        }
+      }
+    }
+  }
+}
+
+std::size_t MEMORY_CONTROLLER::next_schedule(DRAM_CHANNEL& channel)
+{
+  auto& queue = channel.write_mode ? channel.WQ : channel.RQ;
+  auto& index = channel.write_mode ? channel.WQ_index : channel.RQ_index;
+
+  if (scheduler_spec.policy == dram_scheduler::fcfs && scheduler_spec.priority == dram_priority::none && scheduler_spec.fairness == dram_fairness::none) {
+    auto slot = index.oldest_ready();
+    return (slot != dram_queue_index::NONE && queue[slot].event_cycle <= current_cycle) ? slot : dram_queue_index::NONE;
+  }
+
+  auto class_rank = [this](dram_request_class cls) -> unsigned {
+    switch (scheduler_spec.priority) {
+    case dram_priority::critical:
+      return static_cast<unsigned>(cls);
+    case dram_priority::demand:
+      return cls >= dram_request_class::instruction_prefetch ? 1 : 0;
+    case dram_priority::none:
+    default:
+      return 0;
+    }
+  };
+
+  // lane, blacklisted, class, row miss, age, slot
+  using key_type = std::tuple<bool, bool, unsigned, bool, uint64_t, std::size_t>;
+  std::optional<key_type> best;
+  for (std::size_t bank_idx = 0; bank_idx < std::size(channel.bank_request); ++bank_idx) {
+    if (channel.bank_request[bank_idx].valid)
+      continue;
+
+    uint64_t open_row = channel.timing.has_value() ? channel.timing->open_row(bank_idx / DRAM_BANKS, bank_idx % DRAM_BANKS)
+                                                   : channel.bank_request[bank_idx].open_row;
+    index.for_each_ready(bank_idx, current_cycle, [&](std::size_t slot) {
+      const auto& pkt = queue[slot];
+      bool row_miss = scheduler_spec.policy == dram_scheduler::frfcfs && dram_get_row(pkt.address) != open_row;
+      key_type key{false, false, 0, row_miss, pkt.event_cycle, slot};
+      if (!channel.write_mode) {
+        auto cls = channel.RQ_class[slot];
+        std::get<0>(key) = !(scheduler_spec.priority == dram_priority::critical && cls == dram_request_class::critical);
+        std::get<1>(key) = scheduler_spec.fairness == dram_fairness::bliss && pkt.cpu < NUM_CPUS && channel.blacklisted[pkt.cpu];
+        std::get<2>(key) = class_rank(cls);
+      }
+      if (!best.has_value() || key < *best)
+        best = key;
+    });
+  }
+
+  return best.has_value() ? std::get<5>(*best) : dram_queue_index::NONE;
+}
+
+void MEMORY_CONTROLLER::note_served(DRAM_CHANNEL& channel, const PACKET& packet)
+{
+  // a single core has nobody to be unfair to
+  if (scheduler_spec.fairness != dram_fairness::bliss || NUM_CPUS < 2 || packet.cpu >= NUM_CPUS)
+    return;
+
+  if (packet.cpu == channel.last_served_cpu) {
+    channel.served_streak++;
+  } else {
+    channel.last_served_cpu = packet.cpu;
+    channel.served_streak = 1;
+  }
+
+  if (channel.served_streak > scheduler_spec.bliss_threshold && !channel.blacklisted[packet.cpu]) {
+    channel.blacklisted[packet.cpu] = true;
+    channel.sim_stats.back().BLACKLISTINGS++;
+  }
+}
+
+dram_timing_model::dram_timing_model(cycles_type timing, dram_refresh refresh, dram_page_policy page_policy)
+    : t(timing), refresh_mode(refresh), policy(page_policy)
+{
+  if (refresh_mode == dram_refresh::all_bank)
+    next_refresh = t.tREFI;
+  else if (refresh_mode == dram_refresh::per_bank)
+    next_refresh = t.tREFI / std::size(banks);
+}
+
+auto dram_timing_model::access(std::size_t rank_idx, std::size_t bank_idx, uint32_t row, bool is_write, bool keep_open, uint64_t current_cycle)
+    -> access_result
+{
+  auto& rank = ranks[rank_idx];
+  auto& bank = banks[rank_idx * DRAM_BANKS + bank_idx];
+  auto group = bank_idx % DRAM_BANK_GROUPS;
+
+  bool row_buffer_hit = (bank.open_row == row);
+  if (!row_buffer_hit) {
+    uint64_t act_cycle = std::max(current_cycle, bank.act_ready);
+    if (bank.open_row != NO_ROW)
+      act_cycle = std::max(act_cycle, std::max(current_cycle, bank.pre_ready) + t.tRP); // precharge the open row first
+    act_cycle = std::max({act_cycle, rank.act_ready, rank.group_act_ready[group], rank.faw_ready.front()});
+
+    std::rotate(std::begin(rank.faw_ready), std::next(std::begin(rank.faw_ready)), std::end(rank.faw_ready));
+    rank.faw_ready.back() = act_cycle + t.tFAW;
+    rank.act_ready = act_cycle + t.tRRD_S;
+    rank.group_act_ready[group] = act_cycle + t.tRRD_L;
+
+    bank.open_row = row;
+    bank.col_ready = act_cycle + t.tRCD;
+    bank.pre_ready = act_cycle + t.tRAS;
+  }
+
+  uint64_t col_cycle = std::max({current_cycle, bank.col_ready, rank.col_ready, rank.group_col_ready[group]});
+  if (!is_write)
+    col_cycle = std::max(col_cycle, rank.read_ready);
+
+  rank.col_ready = col_cycle + t.tCCD_S;
+  rank.group_col_ready[group] = col_cycle + t.tCCD_L;
+
+  uint64_t data_cycle = col_cycle + t.tCAS;
+  if (is_write) {
+    bank.pre_ready = std::max(bank.pre_ready, data_cycle + t.burst + t.tWR);
+    rank.read_ready = data_cycle + t.burst + t.tWTR;
+  } else {
+    bank.pre_ready = std::max(bank.pre_ready, col_cycle + t.tRTP);
+  }
+
+  // auto precharge
+  if (!keep_open) {
+    bank.open_row = NO_ROW;
+    bank.act_ready = std::max(bank.act_ready, bank.pre_ready + t.tRP);
+  }
+
+  return {data_cycle, row_buffer_hit};
+}
+
+void dram_timing_model::refresh_bank(bank_state& bank, uint64_t start, uint64_t duration)
+{
+  // an open row is precharged before the refresh
+  uint64_t refresh_cycle = std::max(start, bank.act_ready);
+  if (bank.open_row != NO_ROW)
+    refresh_cycle = std::max(refresh_cycle, std::max(start, bank.pre_ready) + t.tRP);
+  bank.open_row = NO_ROW;
+  bank.act_ready = refresh_cycle + duration;
+}
+
+unsigned dram_timing_model::refresh(uint64_t current_cycle)
+{
+  unsigned issued = 0;
+  while (refresh_mode != dram_refresh::none && next_refresh <= current_cycle) {
+    if (refresh_mode == dram_refresh::all_bank) {
+      // every bank of a rank waits for the slowest one
+      for (std::size_t rank = 0; rank < DRAM_RANKS; rank++) {
+        uint64_t start = current_cycle;
+        for (std::size_t bank = 0; bank < DRAM_BANKS; bank++) {
+          auto& state = banks[rank * DRAM_BANKS + bank];
+          start = std::max({start, state.act_ready, state.open_row != NO_ROW ? state.pre_ready + t.tRP : 0});
+        }
+        for (std::size_t bank = 0; bank < DRAM_BANKS; bank++)
+          refresh_bank(banks[rank * DRAM_BANKS + bank], start, t.tRFC);
       }
+      next_refresh += t.tREFI;
+    } else {
+      // one bank at a time, each bank once per tREFI
+      refresh_bank(banks[next_refresh_bank], current_cycle, t.tRFCpb);
+      next_refresh_bank = (next_refresh_bank + 1) % std::size(banks);
+      next_refresh += std::max<uint64_t>(t.tREFI / std::size(banks), 1);
     }
+    issued++;
   }
+  return issued;
 }
 
 void MEMORY_CONTROLLER::initialize()
@@ -165,6 +391,20 @@ void MEMORY_CONTROLLER::initialize()
   else
     std::cout << dram_size << " MiB";
   std::cout << " Channels: " << DRAM_CHANNELS << " Width: " << 8 * DRAM_CHANNEL_WIDTH << "-bit Data Rate: " << DRAM_IO_FREQ << " MT/s" << std::endl;
+  if (timing_spec.detailed) {
+    constexpr std::array<const char*, 3> policy_names{"open", "closed", "adaptive"};
+    constexpr std::array<const char*, 3> refresh_names{"none", "all bank", "per bank"};
+    std::cout << "DRAM detailed timing: Bank groups: " << DRAM_BANK_GROUPS << " Page policy: " << policy_names[static_cast<std::size_t>(timing_spec.page_policy)]
+              << " Refresh: " << refresh_names[static_cast<std::size_t>(timing_spec.refresh)] << std::endl;
+  }
+  if (scheduler_spec.policy != dram_scheduler::fcfs || scheduler_spec.priority != dram_priority::none || scheduler_spec.fairness != dram_fairness::none) {
+    constexpr std::array<const char*, 2> scheduler_names{"fcfs", "frfcfs"};
+    constexpr std::array<const char*, 3> priority_names{"none", "demand", "critical"};
+    constexpr std::array<const char*, 2> fairness_names{"none", "bliss"};
+    std::cout << "DRAM scheduler: " << scheduler_names[static_cast<std::size_t>(scheduler_spec.policy)]
+              << " Priority: " << priority_names[static_cast<std::size_t>(scheduler_spec.priority)]
+              << " Fairness: " << fairness_names[static_cast<std::size_t>(scheduler_spec.fairness)] << std::endl;
+  }
 }
 
 void MEMORY_CONTROLLER::begin_phase()
@@ -182,50 +422,53 @@ void MEMORY_CONTROLLER::end_phase(unsigned)
     chan.roi_stats.push_back(chan.sim_stats.back());
 }
 
+void DRAM_CHANNEL::erase(bool is_write, std::size_t slot)
+{
+  auto& queue = is_write ? WQ : RQ;
+  if (is_valid<PACKET>{}(queue[slot]))
+    (is_write ? WQ_index : RQ_index).erase(slot);
+  queue[slot] = {};
+}
+
 void DRAM_CHANNEL::check_collision()
 {
-  for (auto wq_it = std::begin(WQ); wq_it != std::end(WQ); ++wq_it) {
+  // Only the packets inserted since the last check, in slot order. An older duplicate is found through the address index.
+  for (auto slot : WQ_index.take_unchecked()) {
+    auto wq_it = std::next(std::begin(WQ), static_cast<long>(slot));
     if (is_valid<PACKET>{}(*wq_it) && !wq_it->forward_checked) {
-      eq_addr<PACKET> checker{wq_it->address, LOG2_BLOCK_SIZE};
-      if (auto found = std::find_if(std::begin(WQ), wq_it, checker); found != wq_it) { // Forward check
-        *wq_it = {};
-      } else if (found = std::find_if(std::next(wq_it), std::end(WQ), checker); found != std::end(WQ)) { // Backward check
-        *wq_it = {};
+      auto block = wq_it->address >> LOG2_BLOCK_SIZE;
+      if (WQ_index.find(block, 0, slot) != dram_queue_index::NONE) { // Forward check
+        erase(true, slot);
+      } else if (WQ_index.find(block, slot + 1) != dram_queue_index::NONE) { // Backward check
+        erase(true, slot);
       } else {
         wq_it->forward_checked = true;
       }
     }
   }
 
-  for (auto rq_it = std::begin(RQ); rq_it != std::end(RQ); ++rq_it) {
+  for (auto slot : RQ_index.take_unchecked()) {
+    auto rq_it = std::next(std::begin(RQ), static_cast<long>(slot));
     if (is_valid<PACKET>{}(*rq_it) && !rq_it->forward_checked) {
-      eq_addr<PACKET> checker{rq_it->address, LOG2_BLOCK_SIZE};
-      if (auto wq_it = std::find_if(std::begin(WQ), std::end(WQ), checker); wq_it != std::end(WQ)) {
-        rq_it->data = wq_it->data;
+      auto block = rq_it->address >> LOG2_BLOCK_SIZE;
+      if (auto wq_slot = WQ_index.find(block); wq_slot != dram_queue_index::NONE) {
+        rq_it->data = WQ[wq_slot].data;
         for (auto ret : rq_it->to_return)
           ret->return_data(*rq_it);
 
-        *rq_it = {};
-      } else if (auto found = std::find_if(std::begin(RQ), rq_it, checker); found != rq_it) {
-        auto instr_copy = std::move(found->instr_depend_on_me);
-        auto ret_copy = std::move(found->to_return);
+        erase(false, slot);
+      } else if (auto found_slot = RQ_index.find(block, 0, slot); found_slot != dram_queue_index::NONE) {
+        auto found = std::next(std::begin(RQ), static_cast<long>(found_slot));
+        RQ_class[found_slot] = std::min(RQ_class[found_slot], RQ_class[slot]);
+        merge_dependents(*found, *rq_it);
 
-        std::set_union(std::begin(instr_copy), std::end(instr_copy), std::begin(rq_it->instr_depend_on_me), std::end(rq_it->instr_depend_on_me),
-                       std::back_inserter(found->instr_depend_on_me), ooo_model_instr::program_order);
-        std::set_union(std::begin(ret_copy), std::end(ret_copy), std::begin(rq_it->to_return), std::end(rq_it->to_return),
-                       std::back_inserter(found->to_return));
+        erase(false, slot);
+      } else if (found_slot = RQ_index.find(block, slot + 1); found_slot != dram_queue_index::NONE) {
+        auto found = std::next(std::begin(RQ), static_cast<long>(found_slot));
+        RQ_class[found_slot] = std::min(RQ_class[found_slot], RQ_class[slot]);
+        merge_dependents(*found, *rq_it);
 
-        *rq_it = {};
-      } else if (found = std::find_if(std::next(rq_it), std::end(RQ), checker); found != std::end(RQ)) {
-        auto instr_copy = std::move(found->instr_depend_on_me);
-        auto ret_copy = std::move(found->to_return);
-
-        std::set_union(std::begin(instr_copy), std::end(instr_copy), std::begin(rq_it->instr_depend_on_me), std::end(rq_it->instr_depend_on_me),
-                       std::back_inserter(found->instr_depend_on_me), ooo_model_instr::program_order);
-        std::set_union(std::begin(ret_copy), std::end(ret_copy), std::begin(rq_it->to_return), std::end(rq_it->to_return),
-                       std::back_inserter(found->to_return));
-
-        *rq_it = {};
+        erase(false, slot);
       } else {
         rq_it->forward_checked = true;
       }
@@ -238,10 +481,14 @@ bool MEMORY_CONTROLLER::add_rq(const PACKET& packet)
   auto& channel = channels[dram_get_channel(packet.address)];
 
   // Find empty slot
-  if (auto rq_it = std::find_if_not(std::begin(channel.RQ), std::end(channel.RQ), is_valid<PACKET>()); rq_it != std::end(channel.RQ)) {
+  if (auto slot = channel.RQ_index.free_slot(); slot != dram_queue_index::NONE) {
+    auto rq_it = std::next(std::begin(channel.RQ), static_cast<long>(slot));
     *rq_it = packet;
     rq_it->forward_checked = false;
     rq_it->event_cycle = current_cycle;
+    channel.RQ_class[slot] = request_class(packet);
+    channel.RQ_index.insert(slot, packet.address >> LOG2_BLOCK_SIZE, dram_get_rank(packet.address) * DRAM_BANKS + dram_get_bank(packet.address),
+                            current_cycle);
 
     return true;
   }
@@ -254,10 +501,13 @@ bool MEMORY_CONTROLLER::add_wq(const PACKET& packet)
   auto& channel = channels[dram_get_channel(packet.address)];
 
   // search for the empty index
-  if (auto wq_it = std::find_if_not(std::begin(channel.WQ), std::end(channel.WQ), is_valid<PACKET>()); wq_it != std::end(channel.WQ)) {
+  if (auto slot = channel.WQ_index.free_slot(); slot != dram_queue_index::NONE) {
+    auto wq_it = std::next(std::begin(channel.WQ), static_cast<long>(slot));
     *wq_it = packet;
     wq_it->forward_checked = false;
     wq_it->event_cycle = current_cycle;
+    channel.WQ_index.insert(slot, packet.address >> LOG2_BLOCK_SIZE, dram_get_rank(packet.address) * DRAM_BANKS + dram_get_bank(packet.address),
+                            current_cycle);
 
     return true;
   }
@@ -268,48 +518,25 @@ bool MEMORY_CONTROLLER::add_wq(const PACKET& packet)
 
 bool MEMORY_CONTROLLER::add_pq(const PACKET& packet) { return add_rq(packet); }
 
-/*
- * | row address | rank index | column address | bank index | channel | block
- * offset |
- */
+// See DRAM_ADDRESS_LAYOUT for the field order and dram_address_map for the hashing
 
-uint32_t MEMORY_CONTROLLER::dram_get_channel(uint64_t address)
-{
-  int shift = LOG2_BLOCK_SIZE;
-  return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_CHANNELS));
-}
+uint32_t MEMORY_CONTROLLER::dram_get_channel(uint64_t address) { return DRAM_ADDRESS_MAP.channel(address); }
 
-uint32_t MEMORY_CONTROLLER::dram_get_bank(uint64_t address)
-{
-  int shift = champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
-  return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_BANKS));
-}
+uint32_t MEMORY_CONTROLLER::dram_get_bank(uint64_t address) { return DRAM_ADDRESS_MAP.bank(address); }
 
-uint32_t MEMORY_CONTROLLER::dram_get_column(uint64_t address)
-{
-  int shift = champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
-  return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_COLUMNS));
-}
+uint32_t MEMORY_CONTROLLER::dram_get_column(uint64_t address) { return DRAM_ADDRESS_MAP.column(address); }
 
-uint32_t MEMORY_CONTROLLER::dram_get_rank(uint64_t address)
-{
-  int shift = champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_COLUMNS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
-  return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_RANKS));
-}
+uint32_t MEMORY_CONTROLLER::dram_get_rank(uint64_t address) { return DRAM_ADDRESS_MAP.rank(address); }
 
-uint32_t MEMORY_CONTROLLER::dram_get_row(uint64_t address)
-{
-  int shift = champsim::lg2(DRAM_RANKS) + champsim::lg2(DRAM_BANKS) + champsim::lg2(DRAM_COLUMNS) + champsim::lg2(DRAM_CHANNELS) + LOG2_BLOCK_SIZE;
-  return (address >> shift) & champsim::bitmask(champsim::lg2(DRAM_ROWS));
-}
+uint32_t MEMORY_CONTROLLER::dram_get_row(uint64_t address) { return DRAM_ADDRESS_MAP.row(address); }
 
 std::size_t MEMORY_CONTROLLER::get_occupancy(uint8_t queue_type, uint64_t address)
 {
   uint32_t channel = dram_get_channel(address);
   if (queue_type == 1)
-    return static_cast<std::size_t>(std::count_if(std::begin(channels[channel].RQ), std::end(channels[channel].RQ), is_valid<PACKET>()));
+    return channels[channel].RQ_index.size();
   else if (queue_type == 2)
-    return static_cast<std::size_t>(std::count_if(std::begin(channels[channel].WQ), std::end(channels[channel].WQ), is_valid<PACKET>()));
+    return channels[channel].WQ_index.size();
   else if (queue_type == 3)
     return get_occupancy(1, address);
 
@@ -330,3 +557,121 @@ std::size_t MEMORY_CONTROLLER::get_size(uint8_t queue_type, uint64_t address)
 }
 
 std::size_t MEMORY_CONTROLLER::size() const { return DRAM_CHANNELS * DRAM_RANKS * DRAM_BANKS * DRAM_ROWS * DRAM_COLUMNS * BLOCK_SIZE; }
+
+dram_queue_index::dram_queue_index(std::size_t slots, std::size_t banks)
+    : num_slots(slots), used((slots + 63) / 64), bucket_head(std::size_t{1} << champsim::lg2(2 * slots), NONE), chain_next(slots, NONE), bank_of(slots),
+      block_of(slots), ready(banks)
+{
+  clear();
+}
+
+std::size_t dram_queue_index::bucket(uint64_t block) const
+{
+  uint64_t h = block * 0x9E3779B97F4A7C15ull;
+  return static_cast<std::size_t>(h ^ (h >> 32)) & (std::size(bucket_head) - 1);
+}
+
+std::size_t dram_queue_index::free_slot() const
+{
+  for (std::size_t i = 0; i < std::size(used); i++) {
+    if (~used[i] != 0)
+      return i * 64 + static_cast<std::size_t>(__builtin_ctzll(~used[i]));
+  }
+  return NONE;
+}
+
+void dram_queue_index::insert(std::size_t slot, uint64_t block, std::size_t bank, uint64_t event_cycle)
+{
+  used[slot / 64] |= (1ull << (slot % 64));
+  occupancy++;
+
+  block_of[slot] = block;
+  chain_next[slot] = bucket_head[bucket(block)];
+  bucket_head[bucket(block)] = slot;
+
+  bank_of[slot] = bank;
+  make_ready(slot, event_cycle);
+  unchecked.push_back(slot);
+}
+
+void dram_queue_index::erase(std::size_t slot)
+{
+  used[slot / 64] &= ~(1ull << (slot % 64));
+  occupancy--;
+
+  auto* link = &bucket_head[bucket(block_of[slot])];
+  while (*link != slot)
+    link = &chain_next[*link];
+  *link = chain_next[slot];
+  chain_next[slot] = NONE;
+
+  remove_ready(slot);
+}
+
+void dram_queue_index::clear()
+{
+  std::fill(std::begin(used), std::end(used), 0);
+  // slots past the end of the queue are never free
+  if (num_slots % 64 != 0)
+    used.back() = ~((1ull << (num_slots % 64)) - 1);
+  occupancy = 0;
+
+  std::fill(std::begin(bucket_head), std::end(bucket_head), NONE);
+  std::fill(std::begin(chain_next), std::end(chain_next), NONE);
+  for (auto& list : ready)
+    list.clear();
+  unchecked.clear();
+}
+
+std::size_t dram_queue_index::find(uint64_t block, std::size_t first, std::size_t last) const
+{
+  std::size_t found = NONE;
+  for (auto slot = bucket_head[bucket(block)]; slot != NONE; slot = chain_next[slot]) {
+    if (block_of[slot] == block && slot >= first && slot < last && (found == NONE || slot < found))
+      found = slot;
+  }
+  return found;
+}
+
+void dram_queue_index::make_ready(std::size_t slot, uint64_t event_cycle)
+{
+  remove_ready(slot);
+
+  auto& list = ready[bank_of[slot]];
+  ready_entry entry{event_cycle, slot};
+
+  // packets become ready in event_cycle order, only those of the same cycle have to be sorted by slot
+  auto pos = std::end(list);
+  while (pos != std::begin(list) && std::prev(pos)->event_cycle == event_cycle && std::prev(pos)->slot > slot)
+    --pos;
+  list.insert(pos, entry);
+}
+
+void dram_queue_index::remove_ready(std::size_t slot)
+{
+  auto& list = ready[bank_of[slot]];
+  auto entry = std::find_if(std::begin(list), std::end(list), [slot](const ready_entry& x) { return x.slot == slot; });
+  if (entry != std::end(list))
+    list.erase(entry);
+}
+
+std::size_t dram_queue_index::oldest_ready() const
+{
+  const ready_entry* oldest = nullptr;
+  for (const auto& list : ready) {
+    if (!std::empty(list)
+        && (oldest == nullptr || list.front().event_cycle < oldest->event_cycle
+            || (list.front().event_cycle == oldest->event_cycle && list.front().slot < oldest->slot)))
+      oldest = &list.front();
+  }
+  return oldest == nullptr ? NONE : oldest->slot;
+}
+
+const std::vector<std::size_t>& dram_queue_index::take_unchecked()
+{
+  checking.clear();
+  std::swap(checking, unchecked);
+  std::sort(std::begin(checking), std::end(checking));
+  checking.erase(std::unique(std::begin(checking), std::end(checking)), std::end(checking));
+  return checking;
+}
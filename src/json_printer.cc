@@ -87,6 +87,36 @@ void champsim::json_printer::print(CACHE::stats_type stats)
   stream << indent() << "\"prefetch issued\": " << stats.pf_issued << "," << std::endl;
   stream << indent() << "\"useful prefetch\": " << stats.pf_useful << "," << std::endl;
   stream << indent() << "\"useless prefetch\": " << stats.pf_useless << "," << std::endl;
+  stream << indent() << "\"prefetch filtered recent\": " << stats.pf_filtered_recent << "," << std::endl;
+  stream << indent() << "\"prefetch filtered uop cache\": " << stats.pf_filtered_uop_cache << "," << std::endl;
+  stream << indent() << "\"prefetch filtered uop mshr\": " << stats.pf_filtered_uop_mshr << "," << std::endl;
+  stream << indent() << "\"mshr average occupancy\": " << (stats.mshr_cycles > 0 ? std::ceil(stats.mshr_occupancy) / stats.mshr_cycles : 0.0) << "," << std::endl;
+  stream << indent() << "\"mshr peak occupancy\": " << stats.mshr_peak << "," << std::endl;
+  stream << indent() << "\"mshr demand full cycles\": " << stats.mshr_demand_full_cycles << "," << std::endl;
+  stream << indent() << "\"mshr prefetch full cycles\": " << stats.mshr_prefetch_full_cycles << "," << std::endl;
+  stream << indent() << "\"mshr late prefetch\": " << stats.mshr_late_prefetch << "," << std::endl;
+  stream << indent() << "\"fill buffer waits\": " << stats.fill_buffer_waits << "," << std::endl;
+  stream << indent() << "\"mshr demand sectors\": " << stats.mshr_demand_sectors << "," << std::endl;
+  stream << indent() << "\"mshr fills\": " << stats.mshr_fills << "," << std::endl;
+  stream << indent() << "\"decode bypass\": " << stats.decode_bypass << "," << std::endl;
+  stream << indent() << "\"prefetch throttle up\": " << stats.pf_throttle_up << "," << std::endl;
+  stream << indent() << "\"prefetch throttle down\": " << stats.pf_throttle_down << "," << std::endl;
+  stream << indent() << "\"prefetch polluting misses\": " << stats.pf_polluting_misses << "," << std::endl;
+  stream << indent() << "\"prefetch epochs per level\": [";
+  for (std::size_t i = 0; i < std::size(stats.pf_level_epochs); ++i)
+    stream << (i == 0 ? "" : ", ") << stats.pf_level_epochs[i];
+  stream << "]," << std::endl;
+  stream << indent() << "\"replacement duel victims\": [";
+  for (std::size_t i = 0; i < std::size(stats.repl_duel_victims); ++i)
+    stream << (i == 0 ? "" : ", ") << stats.repl_duel_victims[i];
+  stream << "]," << std::endl;
+  stream << indent() << "\"code fills\": " << stats.code_fills << "," << std::endl;
+  stream << indent() << "\"code evicted by data\": " << stats.code_evicted_by_data << "," << std::endl;
+  stream << indent() << "\"code evicted by code\": " << stats.code_evicted_by_code << "," << std::endl;
+  stream << indent() << "\"code protected\": " << stats.code_protected << "," << std::endl;
+  stream << indent() << "\"prefetch telemetry\": ";
+  print(stats.pf_telemetry);
+  stream << "," << std::endl;
 
   double TOTAL_MISS = 0;
   for (const auto& type : types)
@@ -99,6 +129,34 @@ void champsim::json_printer::print(CACHE::stats_type stats)
   stream << indent() << "}";
 }
 
+void champsim::json_printer::print(const prefetch_telemetry& telemetry)
+{
+  auto print_counters = [this](const prefetch_counters& c) {
+    stream << "\"issued\": " << c.issued << ", \"useful\": " << c.useful << ", \"late\": " << c.late << ", \"early\": " << c.early
+           << ", \"redundant\": " << c.redundant;
+  };
+
+  stream << "{" << std::endl;
+  ++indent_level;
+  for (std::size_t i = 0; i < NUM_PREFETCH_SOURCES; ++i) {
+    const auto& c = telemetry[static_cast<prefetch_source>(i)];
+    stream << indent() << "\"" << prefetch_source_names[i] << "\": {";
+    print_counters(c);
+    stream << ", \"lead time\": [";
+    for (std::size_t b = 0; b < std::size(c.lead_time); ++b)
+      stream << (b == 0 ? "" : ", ") << c.lead_time[b];
+    stream << "], \"epoch cycles\": " << telemetry.epoch_cycles() << ", \"epochs\": [";
+    for (std::size_t e = 0; e < std::size(telemetry.series()); ++e) {
+      stream << (e == 0 ? "{" : ", {");
+      print_counters(telemetry.series()[e][i]);
+      stream << "}";
+    }
+    stream << "]}" << (i + 1 < NUM_PREFETCH_SOURCES ? "," : "") << std::endl;
+  }
+  --indent_level;
+  stream << indent() << "}";
+}
+
 void champsim::json_printer::print(DRAM_CHANNEL::stats_type stats)
 {
   stream << indent() << "{" << std::endl;
@@ -108,6 +166,9 @@ void champsim::json_printer::print(DRAM_CHANNEL::stats_type stats)
   stream << indent() << "\"WQ ROW_BUFFER_HIT\": " << stats.WQ_ROW_BUFFER_HIT << "," << std::endl;
   stream << indent() << "\"WQ ROW_BUFFER_MISS\": " << stats.WQ_ROW_BUFFER_MISS << "," << std::endl;
   stream << indent() << "\"WQ FULL\": " << stats.WQ_FULL << "," << std::endl;
+  stream << indent() << "\"REFRESHES\": " << stats.REFRESHES << "," << std::endl;
+  stream << indent() << "\"RQ CRITICAL\": " << stats.RQ_CRITICAL << "," << std::endl;
+  stream << indent() << "\"BLACKLISTINGS\": " << stats.BLACKLISTINGS << "," << std::endl;
   if (stats.dbus_count_congested > 0)
     stream << indent() << "\"AVG DBUS CONGESTED CYCLE\": " << std::ceil(stats.dbus_cycle_congested) / std::ceil(stats.dbus_count_congested) << std::endl;
   else
@@ -207,6 +268,16 @@ void champsim::json_printer::print(champsim::phase_stats& stats)
   print(stats.sim_cache_stats);
   stream << "," << std::endl;
 
+  if (!stats.uop_cache_telemetry.empty()) {
+    stream << indent() << "\"" << stats.uop_cache_name << "\": {" << std::endl;
+    ++indent_level;
+    stream << indent() << "\"prefetch telemetry\": ";
+    print(stats.uop_cache_telemetry);
+    stream << std::endl;
+    --indent_level;
+    stream << indent() << "}," << std::endl;
+  }
+
   print(stats.sim_dram_stats);
   stream << std::endl;
 
@@ -28,7 +28,7 @@
 #include "champsim.h"
 #include "champsim_constants.h"
 #include "dram_controller.h"
-// #include "micro_op_cache.h"
+#include "micro_op_cache.h"
 #include "ooo_cpu.h"
 #include "operable.h"
 #include "phase_info.h"
@@ -165,14 +165,30 @@ int main(int argc, char** argv)
 
   init_structures();
 
+  // the uop cache is shared by the cores, config/parse.py makes sure they agree on its replacement policy
+  m_microop_cache_ptr->uop_repl_type = ooo_cpu.front().get().uop_repl_type;
+  m_microop_cache_ptr->impl_uop_initialize_replacement();
+
   champsim_main(ooo_cpu, operables, phases, knob_cloudsuite, trace_names);
 
   std::cout << std::endl;
   std::cout << "ChampSim completed all CPUs" << std::endl;
+  if (vmem.huge_pages_mapped > 0)
+    std::cout << "Huge pages mapped: " << vmem.huge_pages_mapped << std::endl;
+  for (PageTableWalker& ptw : ptws) {
+    std::cout << ptw.NAME << " WALKS: " << ptw.walks << " COALESCED: " << ptw.coalesced_walks << " SPECULATIVE: " << ptw.speculative_walks
+              << " DROPPED: " << ptw.dropped_walks << " WALKER STALL CYCLES: " << ptw.walker_stall_cycles << std::endl;
+  }
   std::cout << std::endl;
 
   auto phase_stats = zip_phase_stats(phases, ooo_cpu, caches, DRAM);
 
+  // the uop cache telemetry is reset at the start of each phase, so it only describes the last one
+  if (!std::empty(phase_stats) && !std::empty(ooo_cpu)) {
+    phase_stats.back().uop_cache_name = "cpu" + std::to_string(ooo_cpu.front().get().cpu) + "_UOP_CACHE";
+    phase_stats.back().uop_cache_telemetry = m_microop_cache_ptr->pref_telemetry;
+  }
+
   champsim::plain_printer default_print{std::cout};
   default_print.print(phase_stats);
   get_profiler_ptr->print_json_stats_file();
@@ -182,6 +198,8 @@ int main(int argc, char** argv)
   for (CACHE& cache : caches)
     cache.impl_replacement_final_stats();
 
+  m_microop_cache_ptr->impl_uop_replacement_final_stats();
+
   // int i = 0;
   // for (O3_CPU& cpu : ooo_cpu) {
   //   std::cout << std::endl << "CPU " << i << " Instr per access: " << (((double)cpu.right_path_size) / cpu.right_path_accesses) << std::endl;
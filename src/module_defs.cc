@@ -1,6 +1,7 @@
 #include <functional>
 
 #include "cache.h"
+#include "micro_op_cache.h"
 #include "ooo_cpu.h"
 
 namespace
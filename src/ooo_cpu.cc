@@ -26,10 +26,12 @@
 #include "champsim.h"
 #include "defines.h"
 #include "instruction.h"
+#include "loop_buffer.h"
 #include "micro_op_cache.h"
 #include "mrc.h"
 #include "ooo_cpu.h"
 #include "profiler.h"
+#include "uop_pref_throttle.h"
 
 using namespace std;
 
@@ -70,6 +72,8 @@ void O3_CPU::operate()
 
   num_branch_this_cycle = 0;
 
+  m_microop_cache_ptr->pref_telemetry.tick(current_cycle);
+
   if (current_cycle % UOP_CACHE_NUM_TICKS == 0)
   {
     m_microop_cache_ptr->UpdateHotness();
@@ -164,6 +168,9 @@ void O3_CPU::operate()
   initialize_instruction();
   increment_alternate_path();
   decode_prefetched_instruction();
+#ifdef UOP_PREF_THROTTLE
+  m_uop_pref_throttle_ptr->Operate(current_cycle);
+#endif
 
   // heartbeat
   if (show_heartbeat && (num_retired >= next_print_instruction))
@@ -190,6 +197,10 @@ void O3_CPU::operate()
 
 void O3_CPU::initialize()
 {
+  static_cast<CACHE *>(L1I_bus.lower_level)->fetch_target_queue = &IFETCH_BUFFER;
+  static_cast<CACHE *>(L1I_bus.lower_level)->uop_cache_holds_line = [](uint64_t addr)
+  { return m_microop_cache_ptr->HoldsLine(addr); };
+
   // BRANCH PREDICTOR & BTB
   impl_initialize_branch_predictor();
   impl_initialize_btb();
@@ -199,6 +210,7 @@ void O3_CPU::begin_phase()
 {
   begin_phase_instr = num_retired;
   begin_phase_cycle = current_cycle;
+  m_microop_cache_ptr->pref_telemetry.reset();
 
   // Record where the next phase begins
   stats_type stats;
@@ -236,31 +248,22 @@ void O3_CPU::initialize_instruction()
     demand_ip_info to_add;
     while (fetch_w > 0)
     {
-      auto btb_info = impl_btb_prediction(last_demand_ip, 2);
-      get_profiler_ptr->detailed_energy.addr_gen_events++;
-      auto m_target = btb_info.first.first;
-      auto always_taken = btb_info.first.second;
-      // cout << "Spec generate! " << last_demand_ip << endl;
-      // FIXME
-      // this following will disrupt the branch predictor
-      // but as after this another prediction is called which overlaps all the updates done by the below
-      auto [m_prediction, add_br_info] = impl_predict_branch(last_demand_ip, 2, 0, 0, true);
-      if ((always_taken || m_prediction) && m_target > 0)
+      // the bb size of the last predicted branch is only meaningful if the wrong path continues where it ended
+      uint64_t bb_size_hint = (last_demand_ip == demand_block_next_ip) ? demand_block_bb_size : 0;
+      auto block = predict_fetch_block(last_demand_ip, 2, fetch_w, bb_size_hint);
+      for (uint64_t i = 0; i < block.num_instrs; i++)
       {
-        to_add.ip = m_target;
-        to_add.btb_contention_checked = false;
-        to_add.dib_contention_checked = false;
-        demand_ips.push_back(to_add);
-        if (demand_ips.size() > 1024)
+        uint64_t m_ip = block.start_ip + 4 * i;
+        get_profiler_ptr->detailed_energy.addr_gen_events++;
+        if (m_ip == block.branch_ip && block.taken)
         {
-          demand_ips.pop_front();
+          to_add.ip = block.target;
+        }
+        else
+        {
+          get_profiler_ptr->detailed_energy.addr_gen_events++;
+          to_add.ip = m_ip + 4;
         }
-        last_demand_ip = m_target;
-      }
-      else
-      {
-        get_profiler_ptr->detailed_energy.addr_gen_events++;
-        to_add.ip = last_demand_ip + 4;
         to_add.btb_contention_checked = false;
         to_add.dib_contention_checked = false;
         demand_ips.push_back(to_add);
@@ -268,17 +271,19 @@ void O3_CPU::initialize_instruction()
         {
           demand_ips.pop_front();
         }
-        last_demand_ip = last_demand_ip + 4;
-      }
+        last_demand_ip = to_add.ip;
 
-      // check the uop cache to see which fetch mode we are
-      auto hit = m_microop_cache_ptr->Lookup(to_add.ip, current_cycle);
-      if (!hit)
-      {
-        // cout << "Miss found in WP " << needs_decoders << endl;
-        needs_decoders = true;
+        // check the uop cache to see which fetch mode we are
+        auto hit = m_microop_cache_ptr->Lookup(to_add.ip, current_cycle);
+        if (!hit)
+        {
+          // cout << "Miss found in WP " << needs_decoders << endl;
+          needs_decoders = true;
+        }
+        fetch_w--;
       }
-      fetch_w--;
+      demand_block_next_ip = last_demand_ip;
+      demand_block_bb_size = block.next_bb_size;
     }
 
     if (!needs_decoders)
@@ -815,6 +820,7 @@ void O3_CPU::increment_alternate_path()
       read_pkt.nested_prefetch = pref_request->nested_pref;
       read_pkt.by_ip = pref_request->ip;
       read_pkt.by_br_miss = pref_request->by_br_miss;
+      read_pkt.instruction = true;
 
       // Add to MSHR to keep the inflight status
       CACHE::uop_mshr_entry to_mshr;
@@ -822,6 +828,7 @@ void O3_CPU::increment_alternate_path()
       to_mshr.event_cycle = current_cycle;
       to_mshr.is_valid = true; // by default we plan to add all the lines
       to_mshr.by_instr = pref_request->by_isntr;
+      to_mshr.by_ip = pref_request->by_ip;
 
       // ADDED THIS: Set alternate path flag in MSHR as false initially, in below loop if any ip is on alternate path, set it to true
       to_mshr.is_alternate_path = false;
@@ -848,6 +855,7 @@ void O3_CPU::increment_alternate_path()
       to_mshr.pq_pkt = read_pkt;
       assert(to_mshr.ip != 0);
       static_cast<CACHE *>(L1I_bus.lower_level)->UOP_CACHE_MSHR.push_back(to_mshr);
+      static_cast<CACHE *>(L1I_bus.lower_level)->record_uop_prefetch(to_mshr.ip);
     }
 
     for (auto i = pref_request; i != pref_end; i++)
@@ -1302,7 +1310,7 @@ void O3_CPU::do_init_instruction(ooo_model_instr &arch_instr)
       }
 #endif
 #ifdef H2P_HP_50
-      if (impl_get_yout(arch_instr.ip, 1) >= -50 && impl_get_yout(arch_instr.ip, 1) <= 50)
+      if (int yout = impl_get_yout(arch_instr.ip, 1); yout >= -50 && yout <= 50)
       {
         arch_instr.hard_to_predict_branch = true;
       }
@@ -1350,7 +1358,15 @@ void O3_CPU::do_init_instruction(ooo_model_instr &arch_instr)
     //          arch_instr.hard_to_predict_branch,
     //          arch_instr.branch_type);
 
+    bool throttle_allows = true;
+#ifdef UOP_PREF_THROTTLE
     if (arch_instr.hard_to_predict_branch && arch_instr.branch_type == BRANCH_CONDITIONAL)
+    {
+      throttle_allows = m_uop_pref_throttle_ptr->AllowPrefetch(arch_instr.ip);
+    }
+#endif
+
+    if (arch_instr.hard_to_predict_branch && arch_instr.branch_type == BRANCH_CONDITIONAL && throttle_allows)
     {
       // cout << "inside h2p prefetching" << endl;
       alt_path_has_indirect = false;
@@ -1364,7 +1380,8 @@ void O3_CPU::do_init_instruction(ooo_model_instr &arch_instr)
       uint64_t taken_bb_size = 0;
       uint64_t not_taken_bb_size = 0;
       taken_bb_size = impl_btb_bb_size(arch_instr.ip, 2).first;
-      not_taken_bb_size = h2p_not_taken_bb_size[arch_instr.ip].first;
+      if (auto bb_info = h2p_not_taken_bb_size.find(arch_instr.ip); bb_info != nullptr)
+        not_taken_bb_size = bb_info->first;
       std::pair<uint64_t, uint64_t> spec_path_info = {0, 0};
       spec_main_addrs = arch_instr.ip;
       impl_speculative_begin(arch_instr.ip, arch_instr.branch_target, arch_instr.branch_taken, arch_instr.branch_type, begin_branch_recovery);
@@ -1423,14 +1440,9 @@ void O3_CPU::do_init_instruction(ooo_model_instr &arch_instr)
     }
 #endif
 
-    if (last_br_type == BRANCH_RETURN)
-    {
-      h2p_tt_map[last_target] = last_bb_size;
-    }
     if (!last_br_taken)
     { // not taken bb_size does not cost a btb entry
-      h2p_not_taken_bb_size[last_ip].first = last_bb_size;
-      h2p_not_taken_bb_size[last_ip].second = last_br_type;
+      h2p_not_taken_bb_size[last_ip] = {last_bb_size, last_br_type};
     }
 
     impl_update_bb_size(last_ip, 1, last_bb_size, last_br_taken, last_br_type, 0);
@@ -1717,6 +1729,78 @@ void O3_CPU::do_init_instruction(ooo_model_instr &arch_instr)
     instr_unique_id_4b++;
   }
 }
+O3_CPU::fetch_block_info O3_CPU::predict_fetch_block(uint64_t start_ip, uint8_t level, uint64_t max_instrs, uint64_t bb_size_hint)
+{
+  // Predicts one fetch block with a single BTB + direction lookup instead of one per instruction address.
+  // The block ends at the first predicted taken branch. At level 1 (alternate path) it ends at every branch, as the
+  // alternate direction predictor has to be updated branch by branch.
+  // The first branch is located with the bb size the BTB recorded for the previous branch (bb_size_hint, branch
+  // included), sequential BTB tag probes are only needed when that size is unknown or stale.
+  fetch_block_info block;
+  block.start_ip = start_ip;
+  get_profiler_ptr->fetch_block.blocks++;
+
+  uint64_t ip = start_ip;
+  uint64_t end_ip = start_ip + 4 * max_instrs;
+  while (ip < end_ip) {
+    uint64_t br_ip = 0;
+    // the hint is only trusted when the BTB holds a branch at the hinted slot, a stale or aliased size falls back to
+    // the sequential probes so that no branch before it is skipped
+    if (bb_size_hint > 0) {
+      uint64_t hint_ip = ip + 4 * (bb_size_hint - 1);
+      get_profiler_ptr->fetch_block.tag_probes++;
+      if (impl_get_branch_type(hint_ip) != NOT_BRANCH) {
+        get_profiler_ptr->fetch_block.bb_size_hint_used++;
+        if (hint_ip >= end_ip) {
+          // the next branch lies beyond this block
+          block.next_bb_size = bb_size_hint - (end_ip - ip) / 4;
+          break;
+        }
+        br_ip = hint_ip;
+      }
+    }
+    for (uint64_t probe_ip = ip; br_ip == 0 && probe_ip < end_ip; probe_ip += 4) {
+      get_profiler_ptr->fetch_block.tag_probes++;
+      if (impl_get_branch_type(probe_ip) != NOT_BRANCH) {
+        br_ip = probe_ip;
+      }
+    }
+    if (br_ip == 0) {
+      block.next_bb_size = 0;
+      break;
+    }
+
+    get_profiler_ptr->fetch_block.branch_predictions++;
+    auto btb_info = impl_btb_prediction(br_ip, level);
+    block.branch_ip = br_ip;
+    block.branch_type = impl_get_branch_type(br_ip);
+    block.target = btb_info.first.first;
+    if (level == 1) {
+      block.taken = btb_info.first.second || alt_bp_predictor->GetPrediction(br_ip);
+      block.h2p_ctr = alt_bp_predictor->is_h2p(br_ip);
+    } else {
+      auto [prediction, add_br_info] = impl_predict_branch(br_ip, level, 0, 0, true);
+      block.taken = (btb_info.first.second || prediction) && block.target > 0;
+    }
+
+    auto [taken_bb_size, not_taken_bb_size] = impl_btb_bb_size(br_ip, level);
+    block.next_bb_size = (block.taken && block.target > 0) ? taken_bb_size : not_taken_bb_size;
+    if (block.taken || level == 1) {
+      break;
+    }
+    // predicted not taken, the block goes on past it
+    block.branch_ip = 0;
+    block.branch_type = NOT_BRANCH;
+    block.target = 0;
+    bb_size_hint = block.next_bb_size;
+    ip = br_ip + 4;
+  }
+
+  block.num_instrs = (block.branch_ip != 0) ? (block.branch_ip - start_ip) / 4 + 1 : max_instrs;
+  get_profiler_ptr->fetch_block.instrs += block.num_instrs;
+  return block;
+}
+
 std::pair<uint64_t, uint8_t> O3_CPU::prefetch_alternate_path(uint64_t starting_ip, uint64_t target, uint64_t bb_size, uint8_t branch_type, uint64_t by_instr,
                                                              bool branch_miss, ooo_model_instr &issuing_instr)
 {
@@ -1783,6 +1867,16 @@ std::pair<uint64_t, uint8_t> O3_CPU::prefetch_alternate_path(uint64_t starting_i
 
   int end_counter = 0;
 
+  uint64_t max_ip_check = MAX_IP_CHECK;
+  int end_threshold = H2P_T;
+#ifdef UOP_PREF_THROTTLE
+  max_ip_check = m_uop_pref_throttle_ptr->MaxIpCheck();
+  end_threshold = m_uop_pref_throttle_ptr->EndThreshold();
+#endif
+
+  fetch_block_info block;
+  uint64_t block_bb_size = bb_size;
+
   // if the alternate path started correctly
   if (issuing_instr.branch_prediction != issuing_instr.branch_taken && target == issuing_instr.branch_target)
   {
@@ -1792,15 +1886,24 @@ std::pair<uint64_t, uint8_t> O3_CPU::prefetch_alternate_path(uint64_t starting_i
   // now try to get the path and add it
   while (1)
   {
-    auto btb_info = impl_btb_prediction(m_ip, 1);
-    auto m_target = btb_info.first.first;
-    auto always_taken = btb_info.first.second;
-    auto br_type = impl_get_branch_type(m_ip);
-    auto m_prediction = alt_bp_predictor->GetPrediction(m_ip);
-    auto h2p_ctr_val = alt_bp_predictor->is_h2p(m_ip);
-    if (always_taken)
+    // predict a whole fetch block at once, the instructions before its branch are not looked up again
+    if (m_ip < block.start_ip || m_ip >= block.start_ip + 4 * block.num_instrs)
+    {
+      block = predict_fetch_block(m_ip, 1, max_ip_check - ips_checked, block_bb_size);
+      block_bb_size = block.next_bb_size;
+    }
+    uint64_t m_target = 0;
+    uint8_t br_type = NOT_BRANCH;
+    bool m_prediction = false;
+    int h2p_ctr_val = 0;
+    if (m_ip == block.branch_ip)
     {
-      m_prediction = true;
+      m_target = block.target;
+      br_type = block.branch_type;
+      m_prediction = block.taken;
+      h2p_ctr_val = block.h2p_ctr;
+      // the branch updates the alternate histories below, a path coming back into this block is predicted again
+      block = {};
     }
 
 #define CP_H2P_PATH
@@ -1886,7 +1989,7 @@ std::pair<uint64_t, uint8_t> O3_CPU::prefetch_alternate_path(uint64_t starting_i
       ips_checked = 0;
     }
 
-    if (ips_checked >= MAX_IP_CHECK)
+    if (ips_checked >= max_ip_check)
     {
       if (alt_is_correct)
         get_profiler_ptr->alt_path_stop_info.max_ip++;
@@ -1943,7 +2046,7 @@ std::pair<uint64_t, uint8_t> O3_CPU::prefetch_alternate_path(uint64_t starting_i
     }
 
 #ifdef CP_H2P_PATH
-    if (end_counter >= H2P_T)
+    if (end_counter >= end_threshold)
     {
       if (alt_is_correct)
         get_profiler_ptr->alt_path_stop_info.stop_at_sat_counter++;
@@ -1971,7 +2074,7 @@ void O3_CPU::decode_prefetched_instruction()
 #ifdef L1IPREF
   while (!static_cast<CACHE *>(L1I_bus.lower_level)->uop_pref_addrs.empty())
   {
-    if (h2p_map[static_cast<CACHE *>(L1I_bus.lower_level)->uop_pref_addrs.front()])
+    if (auto is_h2p = h2p_map.find(static_cast<CACHE *>(L1I_bus.lower_level)->uop_pref_addrs.front()); is_h2p != nullptr && *is_h2p)
     {
       m_microop_cache_ptr->Insert(static_cast<CACHE *>(L1I_bus.lower_level)->uop_pref_addrs.front(), current_cycle, true, false, true, false, false, true); // h2p path, these are instructions marked as critical for recovery after branch mispredictions hence is_alternate_path = true
     }
@@ -2009,7 +2112,7 @@ void O3_CPU::decode_prefetched_instruction()
     bool is_alternate = PRF_DECODE_BUFFER.front().is_alternate_path;
     // once branch related info is found out add them to the micro op cache
     m_microop_cache_ptr->Insert(PRF_DECODE_BUFFER.front().ip, current_cycle, true, PRF_DECODE_BUFFER.front().taken, true,
-                                PRF_DECODE_BUFFER.front().was_from_branch_miss, is_br, is_alternate);
+                                PRF_DECODE_BUFFER.front().was_from_branch_miss, is_br, is_alternate, PRF_DECODE_BUFFER.front().by_ip);
     last_pref_decoded = PRF_DECODE_BUFFER.front().ip;
     PRF_DECODE_BUFFER.pop_front();
     get_profiler_ptr->front_end_energy.pref_decoded++;
@@ -2026,6 +2129,7 @@ void O3_CPU::decode_prefetched_instruction()
     pd_entry.taken = static_cast<CACHE *>(L1I_bus.lower_level)->cache_pref_decode_buffer.front().taken;
     // ADDED: Copy alternate path flag
     pd_entry.is_alternate_path = static_cast<CACHE *>(L1I_bus.lower_level)->cache_pref_decode_buffer.front().is_alternate_path;
+    pd_entry.by_ip = static_cast<CACHE *>(L1I_bus.lower_level)->cache_pref_decode_buffer.front().by_ip;
     PRF_DECODE_BUFFER.push_back(pd_entry);
     static_cast<CACHE *>(L1I_bus.lower_level)->cache_pref_decode_buffer.pop_front();
   }
@@ -2144,12 +2248,38 @@ void O3_CPU::check_dib()
   bool hit = true;
   uint8_t dib_ports = 2;
 
+#ifdef LOOP_BUFFER
+  // the instructions of a locked loop stream from the loop buffer, they bypass the uop cache and the decoders
+  unsigned loop_buffer_width = LOOP_BUFFER_WIDTH;
+  for (auto it = std::find_if(std::begin(IFETCH_BUFFER), std::end(IFETCH_BUFFER), [](const ooo_model_instr &x)
+                              { return !x.dib_checked; });
+       loop_buffer_width > 0 && it != std::end(IFETCH_BUFFER) && loop_stream_detector.Streams(it->ip); ++it, --loop_buffer_width)
+  {
+    it->dib_checked = COMPLETED;
+    it->fetched = COMPLETED;
+    it->decoded = COMPLETED;
+    it->event_cycle = current_cycle;
+    it->uop_cache_hit = true; // same path to the uop queue as a uop cache hit
+    it->from_loop_buffer = true;
+    fetch_mode = STREAM;
+    get_profiler_ptr->front_end_energy.fetched_from_loop_buffer++;
+    loop_stream_detector.Observe(*it);
+  }
+#endif
+
   while (dib_ports > 0)
   {
 
     // each port will try to do the dib check for one window
     auto dib_begin = std::find_if(std::begin(IFETCH_BUFFER), std::end(IFETCH_BUFFER), [](const ooo_model_instr &x)
                                   { return !x.dib_checked; });
+#ifdef LOOP_BUFFER
+    // the rest of the locked loop waits for the loop buffer bandwidth
+    if (dib_begin != std::end(IFETCH_BUFFER) && loop_stream_detector.Streams(dib_begin->ip))
+    {
+      break;
+    }
+#endif
     auto dib_no_match_ip = [find_ip = dib_begin->ip](const ooo_model_instr &x)
     {
       return ((find_ip >> lg2(SIZE_WINDOWS)) != (x.ip >> lg2(SIZE_WINDOWS)));
@@ -2159,6 +2289,9 @@ void O3_CPU::check_dib()
     for (auto it = dib_begin; it != dib_end; ++it)
     {
       do_check_dib(*it);
+#ifdef LOOP_BUFFER
+      loop_stream_detector.Observe(*it);
+#endif
       get_profiler_ptr->detailed_energy.dib_check++;
       if (it->uop_cache_hit)
       {
@@ -2261,11 +2394,12 @@ void O3_CPU::do_check_dib(ooo_model_instr &instr)
 #if defined(NO_PREFETCH_ALL_HIT)
   if (m_microop_cache_ptr->Lookup(instr.ip, current_cycle))
     hit = true;
-  if (ideal_ips_to_prefetch[instr.ip])
+  if (auto ideal_hit = ideal_ips_to_prefetch.find(instr.ip); ideal_hit != nullptr)
   {
-    hit = true;
+    if (*ideal_hit)
+      hit = true;
+    *ideal_hit = false;
   }
-  ideal_ips_to_prefetch[instr.ip] = false;
 #endif
 #endif
 
@@ -2473,6 +2607,7 @@ bool O3_CPU::do_fetch_instruction(std::deque<ooo_model_instr>::iterator begin, s
   fetch_packet.instr_id = begin->instr_id;
   fetch_packet.ip = begin->ip;
   fetch_packet.instr_depend_on_me = {begin, end};
+  fetch_packet.instruction = true;
 
   if constexpr (champsim::uop_debug_print)
   {
@@ -2555,7 +2690,9 @@ void O3_CPU::decode_instruction()
       // cout << "Miss found CP " << current_cycle << endl;
     }
 
-    do_dib_update(db_entry, false);
+    // the loop buffer streams without touching the uop cache
+    if (!db_entry.from_loop_buffer)
+      do_dib_update(db_entry, false);
 
     // Resume fetch
     if (db_entry.branch_mispredicted)
@@ -2763,7 +2900,8 @@ void O3_CPU::stream_instruction()
 void O3_CPU::do_dib_update(ooo_model_instr &instr, bool is_prefetch)
 {
   // cout << "Added " << instr.ip << endl;
-  m_microop_cache_ptr->Insert(instr.ip, current_cycle, instr.is_critical, instr.branch_type == BRANCH_DIRECT_JUMP, false, false, instr.is_branch, false); // ADDED NOT alternate path (demand)
+  m_microop_cache_ptr->Insert(instr.ip, current_cycle, instr.is_critical, instr.branch_type == BRANCH_DIRECT_JUMP, false, false, instr.is_branch, false, 0,
+                              MicroOpCache::EstimateUops(instr)); // ADDED NOT alternate path (demand)
 }
 
 void O3_CPU::schedule_instruction()
@@ -3293,9 +3431,9 @@ void O3_CPU::retire_rob()
         get_profiler_ptr->h2p_map[x.ip]++;
         last_h2p_instr_id = x.instr_id;
       }
-    }
 
-    m_h2p_ptr->UpdateBranchHistory(x);
+      m_h2p_ptr->UpdateBranchHistory(x);
+    }
 
     // if (x.instr_id == 78180) {
     //   assert(false);
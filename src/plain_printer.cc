@@ -106,12 +106,82 @@ void champsim::plain_printer::print(CACHE::stats_type stats)
     stream << "ISSUED: " << std::setw(10) << stats.pf_issued << "  ";
     stream << "USEFUL: " << std::setw(10) << stats.pf_useful << "  ";
     stream << "USELESS: " << std::setw(10) << stats.pf_useless << std::endl;
+    stream << stats.name << " PREFETCH  FILTERED RECENT: " << std::setw(10) << stats.pf_filtered_recent << "  ";
+    stream << "UOP CACHE: " << std::setw(10) << stats.pf_filtered_uop_cache << "  ";
+    stream << "UOP MSHR: " << std::setw(10) << stats.pf_filtered_uop_mshr << std::endl;
+    print(stats.pf_telemetry, stats.name);
+
+    if (std::accumulate(std::begin(stats.pf_level_epochs), std::end(stats.pf_level_epochs), uint64_t{0}) > 0) {
+      stream << stats.name << " PREFETCH  THROTTLE UP: " << std::setw(10) << stats.pf_throttle_up << "  ";
+      stream << "DOWN: " << std::setw(10) << stats.pf_throttle_down << "  ";
+      stream << "POLLUTING MISSES: " << std::setw(10) << stats.pf_polluting_misses << "  ";
+      stream << "EPOCHS PER LEVEL:";
+      for (auto epochs : stats.pf_level_epochs)
+        stream << " " << epochs;
+      stream << std::endl;
+    }
+
+    if (std::accumulate(std::begin(stats.repl_duel_victims), std::end(stats.repl_duel_victims), uint64_t{0}) > 0) {
+      stream << stats.name << " REPLACEMENT DUEL VICTIMS:";
+      for (auto victims : stats.repl_duel_victims)
+        stream << " " << std::setw(10) << victims;
+      stream << std::endl;
+    }
+
+    if (stats.code_evicted_by_data + stats.code_evicted_by_code + stats.code_protected > 0) {
+      stream << stats.name << " CODE LINES  FILLS: " << std::setw(10) << stats.code_fills << "  ";
+      stream << "EVICTED BY DATA: " << std::setw(10) << stats.code_evicted_by_data << "  ";
+      stream << "BY CODE: " << std::setw(10) << stats.code_evicted_by_code << "  ";
+      stream << "PROTECTED: " << std::setw(10) << stats.code_protected << std::endl;
+    }
 
     stream << stats.name << " AVERAGE MISS LATENCY: " << std::ceil(stats.total_miss_latency) / std::ceil(TOTAL_MISS) << " cycles" << std::endl;
+
+    stream << stats.name << " MSHR  AVG OCCUPANCY: " << std::setw(10) << (stats.mshr_cycles > 0 ? std::ceil(stats.mshr_occupancy) / stats.mshr_cycles : 0.0) << "  ";
+    stream << "PEAK: " << std::setw(10) << stats.mshr_peak << "  ";
+    stream << "DEMAND FULL CYCLES: " << std::setw(10) << stats.mshr_demand_full_cycles << "  ";
+    stream << "PREFETCH FULL CYCLES: " << std::setw(10) << stats.mshr_prefetch_full_cycles << "  ";
+    stream << "LATE PREFETCH: " << std::setw(10) << stats.mshr_late_prefetch << std::endl;
+    stream << stats.name << " MSHR  FILL BUFFER WAITS: " << std::setw(10) << stats.fill_buffer_waits << "  ";
+    stream << "DEMAND SECTORS PER FILL: " << std::setw(10) << (stats.mshr_fills > 0 ? std::ceil(stats.mshr_demand_sectors) / stats.mshr_fills : 0.0) << "  ";
+    stream << "DECODE BYPASS: " << std::setw(10) << stats.decode_bypass << std::endl;
     // stream << " AVERAGE MISS LATENCY: " << (stats.total_miss_latency)/TOTAL_MISS << " cycles " << stats.total_miss_latency << "/" << TOTAL_MISS<< std::endl;
   }
 }
 
+void champsim::plain_printer::print(const prefetch_telemetry& telemetry, const std::string& name)
+{
+  if (telemetry.empty())
+    return;
+
+  auto print_counters = [this](const prefetch_counters& c) {
+    stream << "ISSUED: " << std::setw(10) << c.issued << "  ";
+    stream << "USEFUL: " << std::setw(10) << c.useful << "  ";
+    stream << "LATE: " << std::setw(10) << c.late << "  ";
+    stream << "EARLY: " << std::setw(10) << c.early << "  ";
+    stream << "REDUNDANT: " << std::setw(10) << c.redundant << std::endl;
+  };
+
+  for (std::size_t i = 0; i < NUM_PREFETCH_SOURCES; ++i) {
+    const auto& c = telemetry[static_cast<prefetch_source>(i)];
+    if (c.issued == 0 && c.useful == 0 && c.redundant == 0)
+      continue;
+
+    stream << name << " PREFETCH " << std::left << std::setw(10) << prefetch_source_names[i] << std::right;
+    print_counters(c);
+    stream << name << " PREFETCH " << std::left << std::setw(10) << prefetch_source_names[i] << std::right << "LEAD TIME (log2 cycles):";
+    for (auto count : c.lead_time)
+      stream << " " << count;
+    stream << std::endl;
+
+    std::size_t epoch = 0;
+    for (const auto& sample : telemetry.series()) {
+      stream << name << " PREFETCH " << std::left << std::setw(10) << prefetch_source_names[i] << std::right << "EPOCH " << std::setw(6) << epoch++ << "  ";
+      print_counters(sample[i]);
+    }
+  }
+}
+
 void champsim::plain_printer::print(DRAM_CHANNEL::stats_type stats)
 {
   stream << stats.name << std::endl;
@@ -126,6 +196,8 @@ void champsim::plain_printer::print(DRAM_CHANNEL::stats_type stats)
   stream << " WQ ROW_BUFFER_HIT: " << std::setw(10) << stats.WQ_ROW_BUFFER_HIT << std::endl;
   stream << "  ROW_BUFFER_MISS: " << std::setw(10) << stats.WQ_ROW_BUFFER_MISS;
   stream << "  FULL: " << std::setw(10) << stats.WQ_FULL << std::endl;
+  stream << " REFRESHES: " << std::setw(10) << stats.REFRESHES << std::endl;
+  stream << " RQ CRITICAL: " << std::setw(10) << stats.RQ_CRITICAL << "  BLACKLISTINGS: " << std::setw(10) << stats.BLACKLISTINGS << std::endl;
   stream << std::endl;
 
   // stream << "UOP_CACHE_HIT: " << double(get_profiler_ptr->uop_cache_hit) / double(get_profiler_ptr->uop_cache_read) * 100.00;
@@ -160,6 +232,8 @@ void champsim::plain_printer::print(champsim::phase_stats& stats)
   for (const auto& stat : stats.roi_cache_stats)
     print(stat);
 
+  print(stats.uop_cache_telemetry, stats.uop_cache_name);
+
   stream << std::endl;
   stream << "DRAM Statistics" << std::endl;
   for (const auto& stat : stats.roi_dram_stats)
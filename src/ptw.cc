@@ -16,6 +16,7 @@
 
 #include "ptw.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "champsim.h"
@@ -25,9 +26,10 @@
 #include "vmem.h"
 
 PageTableWalker::PageTableWalker(std::string v1, uint32_t cpu, double freq_scale, std::vector<std::pair<std::size_t, std::size_t>> pscl_dims, uint32_t v10,
-                                 uint32_t v11, uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem)
+                                 uint32_t v11, uint32_t v12, uint32_t v13, uint64_t latency, MemoryRequestConsumer* ll, VirtualMemory& _vmem,
+                                 std::size_t walkers, bool coalesce)
     : champsim::operable(freq_scale), MemoryRequestProducer(ll), NAME(v1), RQ_SIZE(v10), MSHR_SIZE(v11), MAX_READ(v12), MAX_FILL(v13), HIT_LATENCY(latency),
-      vmem(_vmem), CR3_addr(_vmem.get_pte_pa(cpu, 0, std::size(pscl_dims) + 1).first)
+      vmem(_vmem), CR3_addr(_vmem.get_pte_pa(cpu, 0, std::size(pscl_dims) + 1).first), WALKERS(walkers), coalesce_walks(coalesce)
 {
   auto level = std::size(pscl_dims) + 1;
   for (auto x : pscl_dims) {
@@ -36,14 +38,59 @@ PageTableWalker::PageTableWalker(std::string v1, uint32_t cpu, double freq_scale
   }
 }
 
+bool PageTableWalker::join_walk(const PACKET& handle_pkt, std::size_t start_level)
+{
+  // the deepest in-flight walk whose current read is the PTE line this walk would read at that level
+  // (translation level t reads the entry of the level t+1 table)
+  auto shares_line = [&](const PACKET& x) {
+    auto line_shamt = vmem.shamt(x.translation_level + 1) + champsim::lg2(BLOCK_SIZE / PTE_BYTES);
+    return x.cpu == handle_pkt.cpu && x.event_cycle == std::numeric_limits<uint64_t>::max() && (x.v_address >> line_shamt) == (handle_pkt.address >> line_shamt);
+  };
+  auto leader = std::end(MSHR);
+  for (auto it = std::begin(MSHR); it != std::end(MSHR); ++it) {
+    if (shares_line(*it) && (leader == std::end(MSHR) || it->translation_level < leader->translation_level))
+      leader = it;
+  }
+
+  // a walk that the paging structure caches start deeper than the leader walks on its own
+  if (leader == std::end(MSHR) || leader->translation_level > start_level)
+    return false;
+
+  PACKET follower = handle_pkt;
+  follower.v_address = handle_pkt.address;
+  follower.address = leader->address;
+  follower.translation_level = leader->translation_level;
+  follower.init_translation_level = leader->translation_level;
+  follower.cycle_enqueued = current_cycle;
+  follower.event_cycle = std::numeric_limits<uint64_t>::max();
+  follower.coalesced_walk = true;
+  MSHR.push_back(follower);
+
+  coalesced_walks++;
+  return true;
+}
+
 bool PageTableWalker::handle_read(const PACKET& handle_pkt)
 {
-  pscl_entry walk_init = {handle_pkt.v_address, CR3_addr, std::size(pscl)};
+  // speculative walks of a TLB prefetcher may carry no virtual address, the read queue address is the one translated
+  pscl_entry walk_init = {handle_pkt.address, CR3_addr, std::size(pscl)};
   std::vector<std::optional<pscl_entry>> pscl_hits;
   std::transform(std::begin(pscl), std::end(pscl), std::back_inserter(pscl_hits), [walk_init](auto& x) { return x.check_hit(walk_init); });
   walk_init =
       std::accumulate(std::begin(pscl_hits), std::end(pscl_hits), std::optional<pscl_entry>(walk_init), [](auto x, auto& y) { return y.value_or(*x); }).value();
 
+  if (coalesce_walks && join_walk(handle_pkt, walk_init.level))
+    return true;
+
+  // coalesced walks hold no walker, a read that finds every walker busy is retried the next cycle
+  if (WALKERS > 0) {
+    auto busy_walkers = std::count_if(std::begin(MSHR), std::end(MSHR), [](const auto& x) { return !x.coalesced_walk && !x.page_not_present; });
+    if (static_cast<std::size_t>(busy_walkers) >= WALKERS) {
+      walker_stall_cycles++;
+      return false;
+    }
+  }
+
   auto walk_offset = vmem.get_offset(handle_pkt.address, walk_init.level) * PTE_BYTES;
 
   if constexpr (champsim::debug_print) {
@@ -59,7 +106,10 @@ bool PageTableWalker::handle_read(const PACKET& handle_pkt)
   packet.init_translation_level = walk_init.level;
   packet.cycle_enqueued = current_cycle;
 
-  return step_translation(champsim::splice_bits(walk_init.ptw_addr, walk_offset, LOG2_PAGE_SIZE), packet.init_translation_level, packet);
+  auto success = step_translation(champsim::splice_bits(walk_init.ptw_addr, walk_offset, LOG2_PAGE_SIZE), packet.init_translation_level, packet);
+  if (success)
+    walks++;
+  return success;
 }
 
 bool PageTableWalker::handle_fill(const PACKET& fill_mshr)
@@ -74,7 +124,11 @@ bool PageTableWalker::handle_fill(const PACKET& fill_mshr)
     std::cout << " event: " << fill_mshr.event_cycle << " current: " << current_cycle << std::endl;
   }
 
-  if (fill_mshr.translation_level == 0) {
+  if (fill_mshr.page_not_present) {
+    for (auto ret : fill_mshr.to_return)
+      ret->return_data(fill_mshr);
+    return true;
+  } else if (fill_mshr.translation_level == 0) {
     auto ret_pkt = fill_mshr;
     ret_pkt.address = fill_mshr.v_address;
 
@@ -135,6 +189,29 @@ void PageTableWalker::operate()
   RQ.erase(rq_begin, rq_end);
 }
 
+void PageTableWalker::begin_phase() { walks = coalesced_walks = speculative_walks = dropped_walks = walker_stall_cycles = 0; }
+
+bool PageTableWalker::add_pq(const PACKET& packet)
+{
+  // walking a page that was never touched would map it and charge a fault. The walk is dropped, and the requester is
+  // told that there is no translation to fill.
+  if (!vmem.is_mapped(packet.cpu, packet.address)) {
+    auto dropped = packet;
+    dropped.page_not_present = true;
+    dropped.event_cycle = current_cycle;
+    MSHR.insert(std::find_if(std::begin(MSHR), std::end(MSHR), [cycle = current_cycle](const auto& x) { return x.event_cycle > cycle; }), dropped);
+
+    dropped_walks++;
+    return true;
+  }
+
+  if (!add_rq(packet))
+    return false;
+
+  speculative_walks++;
+  return true;
+}
+
 bool PageTableWalker::add_rq(const PACKET& packet)
 {
   assert(packet.address != 0);
@@ -157,12 +234,18 @@ bool PageTableWalker::add_rq(const PACKET& packet)
 void PageTableWalker::return_data(const PACKET& packet)
 {
   for (auto& mshr_entry : MSHR) {
-    if (eq_addr<PACKET>{packet.address, LOG2_BLOCK_SIZE}(mshr_entry)) {
+    if (!mshr_entry.page_not_present && eq_addr<PACKET>{packet.address, LOG2_BLOCK_SIZE}(mshr_entry)) {
       uint64_t penalty;
-      if (mshr_entry.translation_level == 0)
-        std::tie(mshr_entry.data, penalty) = vmem.va_to_pa(mshr_entry.cpu, mshr_entry.v_address);
-      else
+      auto shift = vmem.page_shift(mshr_entry.cpu, mshr_entry.v_address, mshr_entry.instruction);
+
+      // the entry of a huge page is a leaf, the walk ends early
+      if (mshr_entry.translation_level <= vmem.skipped_levels(shift)) {
+        std::tie(mshr_entry.data, penalty) = vmem.va_to_pa(mshr_entry.cpu, mshr_entry.v_address, mshr_entry.instruction);
+        mshr_entry.page_shift = shift > LOG2_PAGE_SIZE ? static_cast<uint8_t>(shift) : 0;
+        mshr_entry.translation_level = 0;
+      } else {
         std::tie(mshr_entry.data, penalty) = vmem.get_pte_pa(mshr_entry.cpu, mshr_entry.v_address, mshr_entry.translation_level);
+      }
       mshr_entry.event_cycle = current_cycle + (warmup ? 0 : penalty);
 
       if constexpr (champsim::debug_print) {
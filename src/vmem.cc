@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iostream>
 #include <numeric>
 
@@ -26,10 +27,25 @@
 #include "dram_controller.h"
 #include "util.h"
 
-VirtualMemory::VirtualMemory(uint64_t page_table_page_size, std::size_t page_table_levels, uint64_t minor_penalty, MEMORY_CONTROLLER& dram)
-    : next_ppage(VMEM_RESERVE_CAPACITY), last_ppage(1ull << (LOG2_PAGE_SIZE + champsim::lg2(page_table_page_size / PTE_BYTES) * page_table_levels)),
-      minor_fault_penalty(minor_penalty), pt_levels(page_table_levels), pte_page_size(page_table_page_size)
+VirtualMemory::VirtualMemory(uint64_t page_table_page_size, std::size_t page_table_levels, uint64_t minor_penalty, MEMORY_CONTROLLER& dram,
+                             huge_page_spec huge)
+    : huge_pages(std::move(huge)), next_ppage(VMEM_RESERVE_CAPACITY),
+      last_ppage(1ull << (LOG2_PAGE_SIZE + champsim::lg2(page_table_page_size / PTE_BYTES) * page_table_levels)), minor_fault_penalty(minor_penalty),
+      pt_levels(page_table_levels), pte_page_size(page_table_page_size)
 {
+  std::vector<unsigned> shifts;
+  if (huge_pages.policy != huge_page_policy::none)
+    shifts.push_back(huge_pages.shift);
+  for (auto range : huge_pages.ranges)
+    shifts.push_back(range.shift);
+  std::sort(std::begin(shifts), std::end(shifts), std::greater<unsigned>{});
+  shifts.erase(std::unique(std::begin(shifts), std::end(shifts)), std::end(shifts));
+  for (auto shift : shifts) {
+    assert(shift > LOG2_PAGE_SIZE && shift < shamt(page_table_levels));
+    assert((shift - LOG2_PAGE_SIZE) % champsim::lg2(page_table_page_size / PTE_BYTES) == 0);
+    huge_regions.push_back({shift});
+  }
+
   assert(page_table_page_size > 1024);
   assert(page_table_page_size == (1ull << champsim::lg2(page_table_page_size)));
   assert(last_ppage > VMEM_RESERVE_CAPACITY);
@@ -58,15 +74,103 @@ void VirtualMemory::ppage_pop() { next_ppage += PAGE_SIZE; }
 
 std::size_t VirtualMemory::available_ppages() const { return (last_ppage - next_ppage) / PAGE_SIZE; }
 
-std::pair<uint64_t, uint64_t> VirtualMemory::va_to_pa(uint32_t cpu_num, uint64_t vaddr)
+uint64_t VirtualMemory::huge_ppage_pop(unsigned shift)
+{
+  last_ppage = (last_ppage - (1ull << shift)) & ~champsim::bitmask(shift);
+  assert(last_ppage >= next_ppage);
+  huge_pages_mapped++;
+  return last_ppage;
+}
+
+std::size_t VirtualMemory::skipped_levels(unsigned shift) const { return (shift - LOG2_PAGE_SIZE) / champsim::lg2(pte_page_size / PTE_BYTES); }
+
+unsigned VirtualMemory::requested_shift(uint64_t vaddr, bool instruction) const
+{
+  for (auto range : huge_pages.ranges) {
+    if (range.begin <= vaddr && vaddr < range.end)
+      return range.shift;
+  }
+
+  if (huge_pages.policy == huge_page_policy::all || (huge_pages.policy == huge_page_policy::text && instruction))
+    return huge_pages.shift;
+  return LOG2_PAGE_SIZE;
+}
+
+std::tuple<unsigned, uint64_t, bool> VirtualMemory::map_huge_page(uint32_t cpu_num, uint64_t vaddr, bool instruction, bool allocate)
 {
-  auto [ppage, fault] = vpage_to_ppage_map.insert({{cpu_num, vaddr >> LOG2_PAGE_SIZE}, ppage_front()});
+  for (auto& [shift, regions] : huge_regions) {
+    if (auto frame = regions.find({cpu_num, vaddr >> shift}); frame != nullptr && *frame != 0)
+      return {shift, *frame, false};
+  }
+
+  // an already mapped base page pins its regions to small pages
+  if (vpage_to_ppage_map.find({cpu_num, vaddr >> LOG2_PAGE_SIZE}) != nullptr)
+    return {LOG2_PAGE_SIZE, 0, false};
+
+  // the largest requested page whose region is still untouched, the enclosing regions are marked as holding smaller pages
+  auto requested = requested_shift(vaddr, instruction);
+  for (auto& [shift, regions] : huge_regions) {
+    if (!allocate) {
+      if (shift <= requested && regions.find({cpu_num, vaddr >> shift}) == nullptr)
+        return {shift, 0, true};
+    } else if (auto [frame, untouched] = regions.try_emplace({cpu_num, vaddr >> shift}, 0); shift <= requested && untouched) {
+      *frame = huge_ppage_pop(shift);
+      return {shift, *frame, true};
+    }
+  }
+  return {LOG2_PAGE_SIZE, 0, false};
+}
+
+unsigned VirtualMemory::page_shift(uint32_t cpu_num, uint64_t vaddr, bool instruction)
+{
+  if (std::empty(huge_regions))
+    return LOG2_PAGE_SIZE;
+  return std::get<0>(map_huge_page(cpu_num, vaddr, instruction, false));
+}
+
+bool VirtualMemory::is_mapped(uint32_t cpu_num, uint64_t vaddr)
+{
+  auto vpage = vaddr >> LOG2_PAGE_SIZE;
+
+  assert(cpu_num < NUM_CPUS);
+  const auto& recent = recent_translations[cpu_num][vpage % VMEM_RECENT_TRANSLATIONS];
+  if (recent.valid && recent.vpage == vpage)
+    return true;
+
+  for (auto& [shift, regions] : huge_regions) {
+    if (auto frame = regions.find({cpu_num, vaddr >> shift}); frame != nullptr && *frame != 0)
+      return true;
+  }
+
+  return vpage_to_ppage_map.find({cpu_num, vpage}) != nullptr;
+}
+
+std::pair<uint64_t, uint64_t> VirtualMemory::va_to_pa(uint32_t cpu_num, uint64_t vaddr, bool instruction)
+{
+  auto vpage = vaddr >> LOG2_PAGE_SIZE;
+
+  // a hit in the recent translations is never a fault
+  assert(cpu_num < NUM_CPUS);
+  auto& recent = recent_translations[cpu_num][vpage % VMEM_RECENT_TRANSLATIONS];
+  if (recent.valid && recent.vpage == vpage)
+    return {champsim::splice_bits(recent.ppage, vaddr, LOG2_PAGE_SIZE), 0};
+
+  if (!std::empty(huge_regions)) {
+    if (auto [shift, frame, fault] = map_huge_page(cpu_num, vaddr, instruction, true); shift > LOG2_PAGE_SIZE) {
+      auto paddr = champsim::splice_bits(frame, vaddr, shift);
+      recent = {vpage, paddr & ~champsim::bitmask(LOG2_PAGE_SIZE), true};
+      return {paddr, fault ? minor_fault_penalty : 0};
+    }
+  }
+
+  auto [ppage, fault] = vpage_to_ppage_map.try_emplace({cpu_num, vpage}, ppage_front());
 
   // this vpage doesn't yet have a ppage mapping
   if (fault)
     ppage_pop();
 
-  return {champsim::splice_bits(ppage->second, vaddr, LOG2_PAGE_SIZE), fault ? minor_fault_penalty : 0};
+  recent = {vpage, *ppage, true};
+  return {champsim::splice_bits(*ppage, vaddr, LOG2_PAGE_SIZE), fault ? minor_fault_penalty : 0};
 }
 
 std::pair<uint64_t, uint64_t> VirtualMemory::get_pte_pa(uint32_t cpu_num, uint64_t vaddr, std::size_t level)
@@ -76,8 +180,7 @@ std::pair<uint64_t, uint64_t> VirtualMemory::get_pte_pa(uint32_t cpu_num, uint64
     ppage_pop();
   }
 
-  std::tuple key{cpu_num, vaddr >> shamt(level), level};
-  auto [ppage, fault] = page_table.insert({key, next_pte_page});
+  auto [ppage, fault] = page_table.try_emplace({cpu_num, vaddr >> shamt(level), static_cast<uint32_t>(level)}, next_pte_page);
 
   // this PTE doesn't yet have a mapping
   if (fault) {
@@ -89,7 +192,7 @@ std::pair<uint64_t, uint64_t> VirtualMemory::get_pte_pa(uint32_t cpu_num, uint64
   }
 
   auto offset = get_offset(vaddr, level);
-  auto paddr = champsim::splice_bits(ppage->second, offset * PTE_BYTES, champsim::lg2(pte_page_size));
+  auto paddr = champsim::splice_bits(*ppage, offset * PTE_BYTES, champsim::lg2(pte_page_size));
   if constexpr (champsim::debug_print) {
     std::cout << "[VMEM] " << __func__;
     std::cout << " paddr: " << std::hex << paddr;
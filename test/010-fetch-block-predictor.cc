@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include "ooo_cpu.h"
+
+namespace
+{
+O3_CPU make_cpu(std::bitset<O3_CPU::NUM_BTB_MODULES> btb)
+{
+  O3_CPU uut{0,       1.0,     {32, 8, {champsim::lg2(16)}, {champsim::lg2(16)}},
+             32,      8,       16, 64, 32, 32, 352, 128, 72, 6, 6, 6, 128, 4, 2, 2, 5, 1, 1, 1, 0, 0, nullptr, 1, nullptr, 1,
+             O3_CPU::bbranchDbimodal, btb, MicroOpCache::uuop_replacementDlru};
+  uut.impl_initialize_branch_predictor();
+  uut.impl_initialize_btb();
+  return uut;
+}
+} // namespace
+
+SCENARIO("A fetch block ends at the first predicted taken branch")
+{
+  GIVEN("A core whose BTB knows a jump four instructions into the block")
+  {
+    auto uut = make_cpu(O3_CPU::tbtbDittage_64KB);
+    constexpr uint64_t start = 0x401000;
+    uut.impl_update_btb(start + 12, 0x402000, true, BRANCH_DIRECT_JUMP, false);
+
+    WHEN("The block is predicted without a bb size hint")
+    {
+      auto block = uut.predict_fetch_block(start, 2, 16);
+
+      THEN("It holds the instructions up to and including the jump")
+      {
+        REQUIRE(block.branch_ip == start + 12);
+        REQUIRE(block.num_instrs == 4);
+        REQUIRE(block.taken);
+        REQUIRE(block.target == 0x402000);
+        REQUIRE(block.branch_type == BRANCH_DIRECT_JUMP);
+      }
+    }
+
+    WHEN("The hint points past the block at a slot that holds no branch")
+    {
+      auto block = uut.predict_fetch_block(start, 2, 8, 10);
+
+      THEN("The stale hint is not trusted and the jump before it is found")
+      {
+        REQUIRE(block.branch_ip == start + 12);
+        REQUIRE(block.num_instrs == 4);
+      }
+    }
+
+    WHEN("The hint points inside the block at a slot that holds no branch")
+    {
+      auto block = uut.predict_fetch_block(start, 2, 16, 7);
+
+      THEN("The jump before the hinted slot ends the block")
+      {
+        REQUIRE(block.branch_ip == start + 12);
+        REQUIRE(block.num_instrs == 4);
+      }
+    }
+  }
+
+  GIVEN("A core whose BTB knows a jump past the end of the block")
+  {
+    auto uut = make_cpu(O3_CPU::tbtbDittage_64KB);
+    constexpr uint64_t start = 0x501000;
+    uut.impl_update_btb(start + 4 * 9, 0x502000, true, BRANCH_DIRECT_JUMP, false);
+
+    WHEN("The hint confirmed by the BTB lies past the block")
+    {
+      auto block = uut.predict_fetch_block(start, 2, 8, 10);
+
+      THEN("The block is sequential and the rest of the bb size carries over")
+      {
+        REQUIRE(block.branch_ip == 0);
+        REQUIRE(block.num_instrs == 8);
+        REQUIRE(block.next_bb_size == 2);
+      }
+    }
+
+    WHEN("The block is predicted without a hint")
+    {
+      auto block = uut.predict_fetch_block(start, 2, 8);
+
+      THEN("No branch is found inside the block")
+      {
+        REQUIRE(block.branch_ip == 0);
+        REQUIRE(block.num_instrs == 8);
+        REQUIRE(block.next_bb_size == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("The BTB modules report the type of the branches they hold")
+{
+  auto btb = GENERATE(as<unsigned long long>{}, O3_CPU::tbtbDbasic_btb, O3_CPU::tbtbDittage_64KB, O3_CPU::tbtbDtwolevel_btb_1Ke_32Ke_gshare_ittage);
+
+  GIVEN("A core that has seen a call and a conditional branch")
+  {
+    auto uut = make_cpu(btb);
+    constexpr uint64_t call_ip = 0x601000, cond_ip = 0x601040;
+    uut.impl_update_btb(call_ip, 0x603000, true, BRANCH_DIRECT_CALL, false);
+    uut.impl_update_btb(cond_ip, 0x601000, true, BRANCH_CONDITIONAL, false);
+
+    THEN("The tag-only probe returns the stored types")
+    {
+      REQUIRE(uut.impl_get_branch_type(call_ip) == BRANCH_DIRECT_CALL);
+      REQUIRE(uut.impl_get_branch_type(cond_ip) == BRANCH_CONDITIONAL);
+    }
+
+    THEN("Addresses the BTB does not hold are not branches")
+    {
+      REQUIRE(uut.impl_get_branch_type(call_ip + 4) == NOT_BRANCH);
+    }
+  }
+}
@@ -0,0 +1,201 @@
+#include <catch2/catch.hpp>
+
+#include "dram_controller.h"
+
+namespace
+{
+dram_timing_model::cycles_type faw_bound_timing()
+{
+  dram_timing_model::cycles_type t{};
+  t.tRCD = 10;
+  t.tCAS = 10;
+  t.tRAS = 20;
+  t.tRP = 10;
+  t.tCCD_S = 1;
+  t.tCCD_L = 1;
+  t.tRRD_S = 2;
+  t.tRRD_L = 2;
+  t.tFAW = 100;
+  t.burst = 4;
+  return t;
+}
+} // namespace
+
+SCENARIO("The four activate window only throttles after four activates")
+{
+  static_assert(DRAM_BANKS >= 5);
+
+  GIVEN("A rank that has not activated any row yet")
+  {
+    dram_timing_model uut{faw_bound_timing(), dram_refresh::none, dram_page_policy::open};
+
+    WHEN("Four rows of different banks are opened at cycle 0")
+    {
+      std::vector<uint64_t> data_cycles;
+      for (std::size_t bank = 0; bank < 4; ++bank)
+        data_cycles.push_back(uut.access(0, bank, 1, false, true, 0).data_cycle);
+
+      THEN("They are only spaced by tRRD")
+      {
+        REQUIRE(data_cycles == std::vector<uint64_t>{20, 22, 24, 26});
+      }
+
+      AND_WHEN("A fifth row is opened")
+      {
+        auto result = uut.access(0, 4, 1, false, true, 0);
+
+        THEN("It waits for tFAW after the first activate")
+        {
+          REQUIRE_FALSE(result.row_buffer_hit);
+          REQUIRE(result.data_cycle == 100 + 10 + 10);
+        }
+      }
+    }
+  }
+}
+
+namespace
+{
+struct return_recorder : public MemoryRequestProducer {
+  std::vector<uint64_t> returned;
+  void return_data(const PACKET& packet) override { returned.push_back(packet.address); }
+};
+
+// runs the controller until the read returns, the cycle of the return, or 0 if it never does
+uint64_t cycle_of_return(MEMORY_CONTROLLER& uut, return_recorder& requester)
+{
+  for (int i = 0; i < 100000 && std::empty(requester.returned); ++i)
+    uut._operate();
+  return std::empty(requester.returned) ? 0 : uut.current_cycle;
+}
+} // namespace
+
+SCENARIO("A scheduled read drains across a switch to write mode in the detailed mode")
+{
+  dram_timing_spec spec;
+  spec.detailed = true;
+  spec.refresh = dram_refresh::none;
+
+  GIVEN("Two controllers that schedule the same read")
+  {
+    MEMORY_CONTROLLER alone{1, DRAM_IO_FREQ, 12.5, 12.5, 12.5, 0, spec}, with_writes{1, DRAM_IO_FREQ, 12.5, 12.5, 12.5, 0, spec};
+    return_recorder alone_requester, with_writes_requester;
+
+    PACKET read;
+    read.address = 0x100040;
+    for (auto [uut, requester] : {std::pair{&alone, &alone_requester}, std::pair{&with_writes, &with_writes_requester}}) {
+      uut->warmup = false;
+      uut->begin_phase();
+      read.to_return = {requester};
+      uut->add_rq(read);
+      auto& banks = uut->channels[0].bank_request;
+      while (std::none_of(std::begin(banks), std::end(banks), [](const auto& x) { return x.valid; }))
+        uut->_operate();
+    }
+
+    WHEN("Enough writes arrive at one of them to switch it to write mode")
+    {
+      for (uint64_t i = 0; i < DRAM_WQ_SIZE * 7 / 8; ++i) {
+        PACKET write;
+        write.address = 0x10000000 + i * 0x100000;
+        REQUIRE(with_writes.add_wq(write));
+      }
+      with_writes._operate();
+      REQUIRE(with_writes.channels[0].write_mode);
+
+      THEN("The read is not scheduled again, it returns at the same cycle")
+      {
+        auto expected = cycle_of_return(alone, alone_requester);
+        REQUIRE(expected > 0);
+        REQUIRE(cycle_of_return(with_writes, with_writes_requester) == expected);
+        REQUIRE(with_writes.channels[0].sim_stats.back().RQ_ROW_BUFFER_MISS == 1);
+        REQUIRE(with_writes.channels[0].sim_stats.back().RQ_ROW_BUFFER_HIT == 0);
+      }
+    }
+  }
+}
+
+namespace
+{
+// the field extraction of the former fixed layout: | offset | channel | bank | column | rank | row |
+uint64_t baseline_field(uint64_t address, unsigned shift, std::size_t count) { return (address >> shift) & champsim::bitmask(champsim::lg2(count)); }
+} // namespace
+
+SCENARIO("The default DRAM address layout splits an address like the former fixed layout")
+{
+  constexpr unsigned channel_bits = champsim::lg2(DRAM_CHANNELS), bank_bits = champsim::lg2(DRAM_BANKS), column_bits = champsim::lg2(DRAM_COLUMNS),
+                     rank_bits = champsim::lg2(DRAM_RANKS);
+  constexpr dram_address_map uut{make_dram_address_layout(dram_address_mapping::champsim)};
+
+  GIVEN("Addresses with every field in use")
+  {
+    std::vector<uint64_t> addresses{0, 0x40, 0x1fc0, 0x123456789c0, 0xdeadbeefc0, 0xffffffffffc0};
+    for (uint64_t i = 0; i < 64; ++i)
+      addresses.push_back(0x9e3779b97f4a7c15ull * (i + 1));
+
+    THEN("Each field is the one the former layout extracted")
+    {
+      for (auto address : addresses) {
+        REQUIRE(uut.channel(address) == baseline_field(address, LOG2_BLOCK_SIZE, DRAM_CHANNELS));
+        REQUIRE(uut.bank(address) == baseline_field(address, LOG2_BLOCK_SIZE + channel_bits, DRAM_BANKS));
+        REQUIRE(uut.column(address) == baseline_field(address, LOG2_BLOCK_SIZE + channel_bits + bank_bits, DRAM_COLUMNS));
+        REQUIRE(uut.rank(address) == baseline_field(address, LOG2_BLOCK_SIZE + channel_bits + bank_bits + column_bits, DRAM_RANKS));
+        REQUIRE(uut.row(address) == baseline_field(address, LOG2_BLOCK_SIZE + channel_bits + bank_bits + column_bits + rank_bits, DRAM_ROWS));
+      }
+    }
+
+    THEN("The controller uses it when the config asks for no hashing")
+    {
+      if constexpr (DRAM_ADDRESS_MAPPING == 0 && !DRAM_BANK_XOR_HASH && !DRAM_CHANNEL_XOR_HASH) {
+        MEMORY_CONTROLLER controller{1, DRAM_IO_FREQ, 12.5, 12.5, 12.5, 0};
+        for (auto address : addresses) {
+          REQUIRE(controller.dram_get_bank(address) == uut.bank(address));
+          REQUIRE(controller.dram_get_row(address) == uut.row(address));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("The XOR bank hash permutes the bank with the low row bits")
+{
+  static_assert(DRAM_BANKS == 8 && DRAM_ROWS > 0x1235);
+
+  constexpr auto layout = make_dram_address_layout(dram_address_mapping::champsim);
+  constexpr dram_address_map plain{layout}, hashed{layout, true};
+
+  GIVEN("The address of row 0x1235, bank 2, column 7")
+  {
+    constexpr uint64_t address = (uint64_t{0x1235} << layout.row) | (uint64_t{2} << layout.bank) | (uint64_t{7} << layout.column);
+
+    THEN("Without the hash it is in bank 2")
+    {
+      REQUIRE(plain.bank(address) == 2);
+      REQUIRE(plain.row(address) == 0x1235);
+    }
+
+    THEN("With the hash it is in bank 2 ^ 5, the other fields do not change")
+    {
+      REQUIRE(hashed.bank(address) == 7);
+      REQUIRE(hashed.row(address) == 0x1235);
+      REQUIRE(hashed.column(address) == 7);
+      REQUIRE(hashed.rank(address) == plain.rank(address));
+      REQUIRE(hashed.channel(address) == plain.channel(address));
+    }
+  }
+
+  GIVEN("The same column of consecutive rows")
+  {
+    THEN("They all map to one bank without the hash, and to every bank with it")
+    {
+      std::vector<uint32_t> plain_banks, hashed_banks;
+      for (uint64_t row = 0; row < DRAM_BANKS; ++row) {
+        plain_banks.push_back(plain.bank(row << layout.row));
+        hashed_banks.push_back(hashed.bank(row << layout.row));
+      }
+      REQUIRE(std::all_of(std::begin(plain_banks), std::end(plain_banks), [](auto bank) { return bank == 0; }));
+      std::sort(std::begin(hashed_banks), std::end(hashed_banks));
+      REQUIRE(hashed_banks == std::vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7});
+    }
+  }
+}
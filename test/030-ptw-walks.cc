@@ -0,0 +1,209 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+#include "dram_controller.h"
+#include "ptw.h"
+#include "vmem.h"
+
+namespace
+{
+// records the PTE reads of the walker, the test returns them
+struct pte_reads : public MemoryRequestConsumer {
+  std::vector<PACKET> packets;
+
+  bool add_rq(const PACKET&) override { return true; }
+  bool add_wq(const PACKET&) override { return true; }
+  bool add_pq(const PACKET&) override { return true; }
+  bool add_ptwq(const PACKET& packet) override
+  {
+    packets.push_back(packet);
+    return true;
+  }
+  std::size_t get_occupancy(uint8_t, uint64_t) override { return 0; }
+  std::size_t get_size(uint8_t, uint64_t) override { return 0; }
+};
+
+struct finished_walks : public MemoryRequestProducer {
+  std::vector<PACKET> packets;
+  void return_data(const PACKET& packet) override { packets.push_back(packet); }
+};
+
+PACKET walk_of(uint64_t vaddr, finished_walks& receiver)
+{
+  PACKET packet;
+  packet.address = vaddr;
+  packet.v_address = vaddr;
+  packet.cpu = 0;
+  packet.to_return = {&receiver};
+  return packet;
+}
+
+// operates the walker and answers every PTE read it issued, until nothing is left in flight
+void run_walks(PageTableWalker& uut, pte_reads& lower_level, std::size_t& answered)
+{
+  for (int cycle = 0; cycle < 100; ++cycle) {
+    uut._operate();
+    for (; answered < std::size(lower_level.packets); ++answered)
+      uut.return_data(lower_level.packets[answered]);
+  }
+}
+
+const std::vector<std::pair<std::size_t, std::size_t>> pscl_dims{{1, 2}, {1, 4}, {2, 4}, {4, 8}};
+} // namespace
+
+SCENARIO("A speculative walk starts from the paging structure caches")
+{
+  MEMORY_CONTROLLER dram{1.25, 3200, 12.5, 12.5, 12.5, 7.5};
+  VirtualMemory vmem{4096, 5, 200, dram};
+  pte_reads lower_level;
+  finished_walks receiver;
+  PageTableWalker uut{"PTW", 0, 1.0, pscl_dims, 16, 5, 2, 2, 1, &lower_level, vmem};
+  std::size_t answered = 0;
+
+  GIVEN("A walker that has walked a page")
+  {
+    constexpr uint64_t vaddr = 0x7fff12345000;
+    REQUIRE(uut.add_rq(walk_of(vaddr, receiver)));
+    run_walks(uut, lower_level, answered);
+    REQUIRE(std::size(receiver.packets) == 1);
+    REQUIRE(std::size(lower_level.packets) == 5);
+
+    WHEN("A TLB prefetcher asks for the next page, which is mapped, without its virtual address")
+    {
+      vmem.va_to_pa(0, vaddr + 0x1000);
+      auto prefetch = walk_of(vaddr + 0x1000, receiver);
+      prefetch.v_address = 0;
+      REQUIRE(uut.add_pq(prefetch));
+      run_walks(uut, lower_level, answered);
+
+      THEN("Only the last level is read")
+      {
+        REQUIRE(std::size(receiver.packets) == 2);
+        REQUIRE(std::size(lower_level.packets) == 6);
+        REQUIRE(receiver.packets.back().address == vaddr + 0x1000);
+        REQUIRE(uut.speculative_walks == 1);
+      }
+    }
+  }
+}
+
+SCENARIO("A speculative walk of an unmapped page is dropped")
+{
+  MEMORY_CONTROLLER dram{1.25, 3200, 12.5, 12.5, 12.5, 7.5};
+  VirtualMemory vmem{4096, 5, 200, dram};
+  pte_reads lower_level;
+  finished_walks receiver;
+  PageTableWalker uut{"PTW", 0, 1.0, pscl_dims, 16, 5, 2, 2, 1, &lower_level, vmem};
+  std::size_t answered = 0;
+
+  GIVEN("A page that was never touched")
+  {
+    constexpr uint64_t vaddr = 0x7fff12345000;
+    REQUIRE_FALSE(vmem.is_mapped(0, vaddr));
+    const auto free_pages = vmem.available_ppages();
+
+    WHEN("A TLB prefetcher asks for its translation")
+    {
+      REQUIRE(uut.add_pq(walk_of(vaddr, receiver)));
+      run_walks(uut, lower_level, answered);
+
+      THEN("No page table entry is read and no page is mapped")
+      {
+        REQUIRE(std::empty(lower_level.packets));
+        REQUIRE(vmem.available_ppages() == free_pages);
+        REQUIRE_FALSE(vmem.is_mapped(0, vaddr));
+        REQUIRE(uut.dropped_walks == 1);
+        REQUIRE(uut.speculative_walks == 0);
+      }
+
+      THEN("The requester is told there is no translation")
+      {
+        REQUIRE(std::size(receiver.packets) == 1);
+        REQUIRE(receiver.packets.front().page_not_present);
+        REQUIRE(receiver.packets.front().address == vaddr);
+      }
+    }
+  }
+}
+
+SCENARIO("A walk only joins an in-flight walk that is as deep as its own start")
+{
+  MEMORY_CONTROLLER dram{1.25, 3200, 12.5, 12.5, 12.5, 7.5};
+  VirtualMemory vmem{4096, 5, 200, dram};
+  pte_reads lower_level;
+  finished_walks receiver;
+  PageTableWalker uut{"PTW", 0, 1.0, pscl_dims, 16, 5, 2, 2, 1, &lower_level, vmem, 0, true};
+  std::size_t answered = 0;
+
+  GIVEN("A walked page, and an in-flight walk that reads the level 4 table entry line of its neighbour")
+  {
+    constexpr uint64_t vaddr = 0x7fff12345000;
+    REQUIRE(uut.add_rq(walk_of(vaddr, receiver)));
+    run_walks(uut, lower_level, answered);
+    REQUIRE(std::size(lower_level.packets) == 5);
+
+    REQUIRE(uut.add_rq(walk_of(vaddr ^ (1ull << 40), receiver)));
+    uut._operate();
+    REQUIRE(std::size(lower_level.packets) == 6);
+
+    WHEN("The neighbouring page is walked, the paging structure caches start it at the last level")
+    {
+      REQUIRE(uut.add_rq(walk_of(vaddr + 0x1000, receiver)));
+      uut._operate();
+
+      THEN("It does not join the shallower walk, it reads its last level entry")
+      {
+        REQUIRE(uut.coalesced_walks == 0);
+        REQUIRE(uut.walks == 3);
+        REQUIRE(std::size(lower_level.packets) == 7);
+      }
+    }
+  }
+}
+
+SCENARIO("Coalesced walks do not hold a walker")
+{
+  MEMORY_CONTROLLER dram{1.25, 3200, 12.5, 12.5, 12.5, 7.5};
+  VirtualMemory vmem{4096, 5, 200, dram};
+  pte_reads lower_level;
+  finished_walks receiver;
+  PageTableWalker uut{"PTW", 0, 1.0, pscl_dims, 16, 5, 2, 2, 1, &lower_level, vmem, 2, true};
+
+  GIVEN("Two walkers, one busy with a walk that another walk joined")
+  {
+    constexpr uint64_t vaddr = 0x7fff12345000;
+    REQUIRE(uut.add_rq(walk_of(vaddr, receiver)));
+    uut._operate();
+    REQUIRE(uut.add_rq(walk_of(vaddr + 0x1000, receiver)));
+    uut._operate();
+    REQUIRE(uut.walks == 1);
+    REQUIRE(uut.coalesced_walks == 1);
+
+    WHEN("A walk of an unrelated part of the address space arrives")
+    {
+      REQUIRE(uut.add_rq(walk_of(vaddr ^ (1ull << 55) ^ (1ull << 46), receiver)));
+      uut._operate();
+
+      THEN("It takes the second walker")
+      {
+        REQUIRE(uut.walks == 2);
+        REQUIRE(uut.walker_stall_cycles == 0);
+        REQUIRE(std::size(lower_level.packets) == 2);
+      }
+
+      AND_WHEN("A third unrelated walk arrives")
+      {
+        REQUIRE(uut.add_rq(walk_of(vaddr ^ (1ull << 54) ^ (1ull << 45), receiver)));
+        uut._operate();
+        uut._operate();
+
+        THEN("It waits for a walker, the stall is counted every cycle")
+        {
+          REQUIRE(uut.walks == 2);
+          REQUIRE(uut.walker_stall_cycles == 2);
+        }
+      }
+    }
+  }
+}
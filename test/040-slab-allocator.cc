@@ -0,0 +1,92 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <set>
+
+#include "msl/slab_allocator.h"
+
+using champsim::msl::slab_pool;
+
+SCENARIO("The slab pool hands out aligned, disjoint blocks and recycles freed ones")
+{
+  GIVEN("An empty pool")
+  {
+    slab_pool uut;
+
+    WHEN("Many blocks of one size class are allocated")
+    {
+      constexpr std::size_t bytes = 40; // rounded up to 48
+      std::vector<std::byte*> blocks;
+      for (std::size_t i = 0; i < 2 * slab_pool::SLAB_BYTES / 48; ++i)
+        blocks.push_back(static_cast<std::byte*>(uut.allocate(bytes)));
+
+      THEN("Every block is aligned to the granule")
+      {
+        REQUIRE(std::all_of(std::begin(blocks), std::end(blocks),
+                            [](auto p) { return reinterpret_cast<std::uintptr_t>(p) % slab_pool::GRANULE == 0; }));
+      }
+
+      THEN("No two blocks overlap, across several slabs")
+      {
+        std::sort(std::begin(blocks), std::end(blocks));
+        std::ptrdiff_t min_gap = std::numeric_limits<std::ptrdiff_t>::max();
+        for (std::size_t i = 1; i < std::size(blocks); ++i)
+          min_gap = std::min(min_gap, blocks[i] - blocks[i - 1]);
+        REQUIRE(min_gap >= 48);
+      }
+
+      AND_WHEN("A block is freed")
+      {
+        auto freed = blocks[7];
+        uut.deallocate(freed, bytes);
+
+        THEN("The next allocation of the same size class reuses it")
+        {
+          REQUIRE(uut.allocate(33) == freed);
+        }
+
+        THEN("An allocation of another size class does not")
+        {
+          REQUIRE(uut.allocate(64) != freed);
+        }
+      }
+    }
+
+    WHEN("A block larger than the largest size class is allocated")
+    {
+      auto p = uut.allocate(slab_pool::MAX_BLOCK + 1);
+
+      THEN("It comes from the heap and can be returned")
+      {
+        REQUIRE(p != nullptr);
+        uut.deallocate(p, slab_pool::MAX_BLOCK + 1);
+      }
+    }
+  }
+}
+
+SCENARIO("A container over the slab allocator keeps its contents")
+{
+  struct node {
+    uint64_t payload[80]; // larger than a deque node, one allocation per element
+  };
+
+  std::deque<node, champsim::msl::slab_allocator<node>> uut;
+  for (uint64_t round = 0; round < 4; ++round) {
+    for (uint64_t i = 0; i < 1000; ++i)
+      uut.push_back(node{{round * 1000 + i}});
+    for (uint64_t i = 0; i < 500; ++i)
+      uut.pop_front();
+  }
+
+  REQUIRE(std::size(uut) == 2000);
+  std::set<uint64_t> seen;
+  for (const auto& x : uut)
+    seen.insert(x.payload[0]);
+  REQUIRE(std::size(seen) == 2000);
+  REQUIRE(*std::begin(seen) == 2000); // the 2000 oldest elements were popped
+  REQUIRE(*std::rbegin(seen) == 3999);
+}
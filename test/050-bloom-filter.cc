@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include "msl/bloom_filter.h"
+
+using champsim::msl::bloom_filter;
+
+SCENARIO("The Bloom filter rounds its size up to a power of two")
+{
+  REQUIRE(bloom_filter{1}.bits() == 64);
+  REQUIRE(bloom_filter{4096}.bits() == 4096);
+  REQUIRE(bloom_filter{5000}.bits() == 8192);
+}
+
+SCENARIO("The Bloom filter has no false negatives and few false positives")
+{
+  GIVEN("A filter sized like the L1I prefetch filter, loaded with a window of line addresses")
+  {
+    bloom_filter uut{8192, 3};
+    constexpr uint64_t first_line = 0x40000;
+    constexpr uint64_t window = 1024;
+    for (uint64_t line = first_line; line < first_line + window; ++line)
+      uut.insert(line);
+
+    THEN("Every inserted key is found")
+    {
+      bool all_found = true;
+      for (uint64_t line = first_line; line < first_line + window; ++line)
+        all_found = all_found && uut.contains(line);
+      REQUIRE(all_found);
+      REQUIRE(uut.size() == window);
+    }
+
+    THEN("The false positive rate stays close to (1 - e^(-kn/m))^k, about 3%")
+    {
+      constexpr uint64_t probes = 100000;
+      uint64_t false_positives = 0;
+      for (uint64_t line = first_line + window; line < first_line + window + probes; ++line)
+        false_positives += uut.contains(line) ? 1 : 0;
+      REQUIRE(false_positives < probes * 6 / 100);
+    }
+
+    WHEN("The filter is cleared")
+    {
+      uut.clear();
+
+      THEN("It is empty")
+      {
+        bool any_found = false;
+        for (uint64_t line = first_line; line < first_line + window; ++line)
+          any_found = any_found || uut.contains(line);
+        REQUIRE_FALSE(any_found);
+        REQUIRE(uut.size() == 0);
+      }
+    }
+  }
+}
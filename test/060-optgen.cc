@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+
+#include "optgen.h"
+
+using champsim::optgen;
+
+SCENARIO("OPTgen tells whether OPT would have kept a reused line")
+{
+  GIVEN("A one way set")
+  {
+    optgen uut{1, 8};
+
+    WHEN("Two lines are accessed for the first time")
+    {
+      auto first = uut.access(0xa, 1);
+      auto second = uut.access(0xb, 2);
+
+      THEN("There is no decision yet")
+      {
+        REQUIRE_FALSE(first.has_value());
+        REQUIRE_FALSE(second.has_value());
+      }
+
+      AND_WHEN("Both lines are reused in the same order")
+      {
+        auto reuse_a = uut.access(0xa, 3);
+        auto reuse_b = uut.access(0xb, 4);
+
+        THEN("OPT keeps the first one, which then holds the only way across the reuse of the second")
+        {
+          REQUIRE(reuse_a.has_value());
+          REQUIRE(reuse_a->signature == 1);
+          REQUIRE(reuse_a->opt_hit);
+
+          REQUIRE(reuse_b.has_value());
+          REQUIRE(reuse_b->signature == 2);
+          REQUIRE_FALSE(reuse_b->opt_hit);
+
+          REQUIRE(uut.accesses == 4);
+          REQUIRE(uut.hits == 1);
+        }
+      }
+    }
+  }
+
+  GIVEN("A two way set with a window of four accesses")
+  {
+    optgen uut{2, 4};
+    REQUIRE_FALSE(uut.access(0xa, 1).has_value());
+
+    WHEN("Three other lines fill the window")
+    {
+      for (uint64_t line : {0xb, 0xc, 0xd})
+        REQUIRE_FALSE(uut.access(line, 2).has_value());
+
+      AND_WHEN("A fifth line is accessed")
+      {
+        auto outcome = uut.access(0xe, 2);
+
+        THEN("The first line left the window without a reuse, OPT would not have kept it")
+        {
+          REQUIRE(outcome.has_value());
+          REQUIRE(outcome->signature == 1);
+          REQUIRE_FALSE(outcome->opt_hit);
+        }
+
+        AND_THEN("Its reuse is a miss with no decision left to take")
+        {
+          REQUIRE(uut.access(0xa, 3)->signature == 2);
+          REQUIRE(uut.hits == 0);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("OPTgen keeps part of a loop larger than the set, where LRU keeps nothing")
+{
+  GIVEN("A four way set and a loop over five lines")
+  {
+    optgen uut{4, 32};
+
+    WHEN("The loop runs five times")
+    {
+      for (int i = 0; i < 5; ++i)
+        for (uint64_t line = 0; line < 5; ++line)
+          uut.access(line, line);
+
+      THEN("OPT, which may bypass, misses one reuse per run after the first")
+      {
+        REQUIRE(uut.accesses == 25);
+        REQUIRE(uut.hits == 16);
+      }
+    }
+  }
+}
@@ -0,0 +1,100 @@
+#include <catch2/catch.hpp>
+
+#include "micro_op_cache.h"
+
+namespace
+{
+ooo_model_instr instr_with(std::vector<uint8_t> sources, std::vector<uint8_t> results, std::size_t loads, std::size_t stores)
+{
+  ooo_model_instr instr;
+  instr.source_registers = sources;
+  instr.destination_registers = results;
+  instr.source_memory.assign(loads, 0x1000);
+  instr.destination_memory.assign(stores, 0x2000);
+  return instr;
+}
+} // namespace
+
+SCENARIO("The uops of an instruction are estimated from its memory and register operands")
+{
+  THEN("A register operation or a load is one uop")
+  {
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2}, {1}, 0, 0)) == 1);
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1}, {2}, 1, 0)) == 1);
+  }
+
+  THEN("A read-modify-write is two")
+  {
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1}, {}, 1, 1)) == 2);
+  }
+
+  THEN("Each register result beyond the first takes a uop")
+  {
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2}, {1, 3}, 0, 0)) == 2);
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2}, {1, 3, 4}, 0, 0)) == 3);
+  }
+
+  THEN("More than three register sources take a uop")
+  {
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2, 3}, {1}, 0, 0)) == 1);
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2, 3, 4}, {1}, 0, 0)) == 2);
+  }
+
+  THEN("The stack pointer, the flags and the instruction pointer are not counted")
+  {
+    // pop, a conditional branch
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({champsim::REG_STACK_POINTER}, {champsim::REG_STACK_POINTER, 1}, 1, 0)) == 1);
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({champsim::REG_FLAGS, champsim::REG_INSTRUCTION_POINTER}, {champsim::REG_INSTRUCTION_POINTER}, 0, 0)) == 1);
+  }
+
+  THEN("Longer instructions are capped, the microcode ROM sequences them")
+  {
+    REQUIRE(MicroOpCache::EstimateUops(instr_with({1, 2, 3, 4}, {1, 2, 3}, 2, 2)) == UOP_CACHE_MAX_UOPS_PER_INSTR);
+  }
+}
+
+SCENARIO("A window is kept in as many ways as its uops need, up to a limit")
+{
+  GIVEN("An empty uop cache of 6 uops per way, and up to 3 ways or 18 uops per window")
+  {
+    MicroOpCache uut{{6, 3, 18}};
+    uut.uop_repl_type = MicroOpCache::uuop_replacementDlru;
+    uut.impl_uop_initialize_replacement();
+
+    constexpr uint64_t window = 0x401000;
+    const auto continuation_ways = get_profiler_ptr->uop_capacity.continuation_ways;
+    const auto uncacheable_windows = get_profiler_ptr->uop_capacity.uncacheable_windows;
+
+    WHEN("A prefetch brings the first instruction of a window, and three more of four uops each are decoded")
+    {
+      uut.Insert(window, 1, false, false, true, false, false, false, 0, 4);
+      uut.Insert(window + 4, 2, false, false, false, false, false, false, 0, 4);
+      uut.Insert(window + 8, 3, false, false, false, false, false, false, 0, 4);
+
+      THEN("The second and third instruction each take one more way")
+      {
+        REQUIRE(get_profiler_ptr->uop_capacity.continuation_ways - continuation_ways == 2);
+        REQUIRE(uut.Ishit(window));
+      }
+
+      AND_WHEN("The fourth instruction needs a fourth way")
+      {
+        uut.Insert(window + 12, 4, false, false, false, false, false, false, 0, 4);
+
+        THEN("The window is dropped, its prefetched way is evicted unused")
+        {
+          REQUIRE_FALSE(uut.Ishit(window));
+          REQUIRE(get_profiler_ptr->uop_capacity.uncacheable_windows - uncacheable_windows == 1);
+          REQUIRE(uut.pref_telemetry[champsim::prefetch_source::UOP_CACHE].issued == 1);
+          REQUIRE(uut.pref_telemetry[champsim::prefetch_source::UOP_CACHE].early == 1);
+        }
+
+        THEN("It is no longer inserted")
+        {
+          uut.Insert(window, 5, false, false, false, false, false, false, 0, 1);
+          REQUIRE_FALSE(uut.Ishit(window));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include "../branch/hashed_perceptron/hashed_perceptron_kernel.h"
+
+namespace
+{
+using namespace hashed_perceptron;
+
+// the former per-table loops of the predictor
+struct reference {
+  static void compute_indices(const unsigned int* ghist_words, uint64_t pc, uint64_t* indices)
+  {
+    for (int i = 0; i < NTABLES; i++) {
+      uint64_t x = 0;
+      int j;
+      for (j = 0; j < history_lengths[i] / LOG_TABLE_SIZE; j++)
+        x ^= ghist_words[j];
+      x ^= ghist_words[j] & ((1 << (history_lengths[i] % LOG_TABLE_SIZE)) - 1);
+      indices[i] = (x ^ pc) & (TABLE_SIZE - 1);
+    }
+  }
+
+  static int sum(const weight_tables& tables, const uint64_t* indices)
+  {
+    int yout = 0;
+    for (int i = 0; i < NTABLES; i++)
+      yout += tables[i][indices[i]];
+    return yout;
+  }
+
+  static void train(weight_tables& tables, const uint64_t* indices, bool taken)
+  {
+    for (int i = 0; i < NTABLES; i++) {
+      int* c = &tables[i][indices[i]];
+      if (taken) {
+        if (*c < 127)
+          (*c)++;
+      } else {
+        if (*c > -128)
+          (*c)--;
+      }
+    }
+  }
+};
+
+struct tables_type {
+  weight_tables weights;
+};
+
+bool same_weights(const tables_type& lhs, const tables_type& rhs)
+{
+  for (int i = 0; i < NTABLES; i++)
+    for (int j = 0; j < TABLE_SIZE; j++)
+      if (lhs.weights[i][j] != rhs.weights[i][j])
+        return false;
+  return true;
+}
+} // namespace
+
+SCENARIO("The hashed perceptron kernels match the scalar predictor")
+{
+  std::mt19937_64 rng{0x5eed};
+  std::uniform_int_distribution<int> weight{WEIGHT_MIN, WEIGHT_MAX};
+  std::uniform_int_distribution<unsigned> word{0, (1u << LOG_TABLE_SIZE) - 1};
+
+  // the tables are too large for the stack
+  auto uut = std::make_unique<tables_type>();
+  auto expected = std::make_unique<tables_type>();
+
+  GIVEN("Tables of random weights, with the extreme weights near the saturation points")
+  {
+    for (int i = 0; i < NTABLES; i++) {
+      for (int j = 0; j < TABLE_SIZE; j++) {
+        auto w = (j % 7 == 0) ? WEIGHT_MAX : (j % 7 == 1) ? WEIGHT_MIN : weight(rng);
+        uut->weights[i][j] = expected->weights[i][j] = w;
+      }
+    }
+
+    WHEN("Random histories are predicted and trained")
+    {
+      bool indices_match = true, sums_match = true, weights_match = true;
+      for (int n = 0; n < 20000; n++) {
+        unsigned ghist_words[NGHIST_WORDS];
+        for (auto& w : ghist_words)
+          w = word(rng);
+        uint64_t pc = rng();
+        bool taken = rng() & 1;
+
+        uint64_t indices[NTABLES], expected_indices[NTABLES];
+        compute_indices(ghist_words, pc, indices);
+        reference::compute_indices(ghist_words, pc, expected_indices);
+        indices_match = indices_match && std::equal(std::begin(indices), std::end(indices), std::begin(expected_indices));
+
+        sums_match = sums_match && sum(uut->weights, indices) == reference::sum(expected->weights, expected_indices)
+                     && sum_scalar(uut->weights, indices) == reference::sum(expected->weights, expected_indices);
+
+        train(uut->weights, indices, taken);
+        reference::train(expected->weights, expected_indices, taken);
+      }
+      weights_match = same_weights(*uut, *expected);
+
+      THEN("The indices, the sums and the trained weights are the same")
+      {
+        REQUIRE(indices_match);
+        REQUIRE(sums_match);
+        REQUIRE(weights_match);
+      }
+    }
+
+    WHEN("A weight at a saturation point is trained past it")
+    {
+      uint64_t indices[NTABLES];
+      for (int i = 0; i < NTABLES; i++)
+        indices[i] = 7 * static_cast<uint64_t>(i) + (i % 2); // WEIGHT_MAX in the even tables, WEIGHT_MIN in the odd ones
+
+      train(uut->weights, indices, true);
+      train(uut->weights, indices, false);
+      train(uut->weights, indices, false);
+      train(uut->weights, indices, true);
+
+      THEN("It saturates like the scalar update")
+      {
+        for (int i = 0; i < NTABLES; i++)
+          REQUIRE(uut->weights[i][indices[i]] == ((i % 2) ? WEIGHT_MIN + 1 : WEIGHT_MAX - 1));
+      }
+    }
+  }
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch.hpp>
+
+#include "prefetch_controller.h"
+
+namespace
+{
+// an epoch of 100 prefetches with this many useful and late ones, and this many polluting misses out of 100
+prefetch_controller::epoch_sample epoch_of(uint64_t useful, uint64_t late, uint64_t polluting, double dram_occupancy = 0)
+{
+  prefetch_controller::epoch_sample sample;
+  sample.issued = 100;
+  sample.useful = useful;
+  sample.late = late;
+  sample.demand_misses = 100;
+  sample.polluting_misses = polluting;
+  sample.dram_occupancy = dram_occupancy;
+  return sample;
+}
+
+int first_epoch(const prefetch_controller::epoch_sample& sample)
+{
+  prefetch_controller uut;
+  return uut.end_epoch(sample);
+}
+} // namespace
+
+SCENARIO("The prefetch controller follows the decision table of feedback directed prefetching")
+{
+  GIVEN("An accurate prefetcher")
+  {
+    THEN("It is made more aggressive if it is late")
+    {
+      REQUIRE(first_epoch(epoch_of(80, 10, 0)) == 1);
+      REQUIRE(first_epoch(epoch_of(80, 10, 10)) == 1);
+    }
+    THEN("It is made less aggressive if it pollutes and is not late")
+    {
+      REQUIRE(first_epoch(epoch_of(80, 0, 10)) == -1);
+    }
+    THEN("It keeps its level otherwise")
+    {
+      REQUIRE(first_epoch(epoch_of(80, 0, 0)) == 0);
+    }
+  }
+
+  GIVEN("A prefetcher of medium accuracy")
+  {
+    THEN("It is made more aggressive if it is late and does not pollute")
+    {
+      REQUIRE(first_epoch(epoch_of(50, 10, 0)) == 1);
+    }
+    THEN("It is made less aggressive if it pollutes")
+    {
+      REQUIRE(first_epoch(epoch_of(50, 10, 10)) == -1);
+      REQUIRE(first_epoch(epoch_of(50, 0, 10)) == -1);
+    }
+    THEN("It keeps its level otherwise")
+    {
+      REQUIRE(first_epoch(epoch_of(50, 0, 0)) == 0);
+    }
+  }
+
+  GIVEN("An inaccurate prefetcher")
+  {
+    THEN("It is made less aggressive if it is late or pollutes")
+    {
+      REQUIRE(first_epoch(epoch_of(20, 1, 0)) == -1);
+      REQUIRE(first_epoch(epoch_of(20, 0, 10)) == -1);
+    }
+    THEN("It keeps its level otherwise")
+    {
+      REQUIRE(first_epoch(epoch_of(20, 0, 0)) == 0);
+    }
+  }
+
+  GIVEN("A busy DRAM read queue")
+  {
+    THEN("Only an accurate prefetcher is not made less aggressive")
+    {
+      REQUIRE(first_epoch(epoch_of(50, 10, 0, 0.9)) == -1);
+      REQUIRE(first_epoch(epoch_of(80, 10, 0, 0.9)) == 1);
+    }
+  }
+
+  GIVEN("A prefetcher that issued nothing")
+  {
+    prefetch_controller::epoch_sample idle;
+    idle.demand_misses = 100;
+    idle.polluting_misses = 10;
+
+    THEN("It keeps its level")
+    {
+      REQUIRE(first_epoch(idle) == 0);
+    }
+  }
+}
+
+SCENARIO("The prefetch controller moves one level at a time within its range")
+{
+  GIVEN("A controller at its nominal level")
+  {
+    prefetch_controller uut;
+    REQUIRE(uut.level() == prefetch_controller::NOMINAL_LEVEL);
+    REQUIRE(uut.degree(4) == 4);
+    REQUIRE(uut.distance(4) == 4);
+
+    WHEN("Every epoch is accurate and late")
+    {
+      for (unsigned i = 0; i < prefetch_controller::NUM_LEVELS; i++)
+        uut.end_epoch(epoch_of(80, 10, 0));
+
+      THEN("It stops at the most aggressive level")
+      {
+        REQUIRE(uut.level() == prefetch_controller::NUM_LEVELS - 1);
+        REQUIRE(uut.end_epoch(epoch_of(80, 10, 0)) == 0);
+        REQUIRE(uut.degree(4) == 8);
+        REQUIRE(uut.distance(4) == 16);
+      }
+    }
+
+    WHEN("Every epoch pollutes")
+    {
+      for (unsigned i = 0; i < prefetch_controller::NUM_LEVELS; i++)
+        uut.end_epoch(epoch_of(20, 0, 10));
+
+      THEN("It stops at the most conservative level, and still prefetches")
+      {
+        REQUIRE(uut.level() == 0);
+        REQUIRE(uut.end_epoch(epoch_of(20, 0, 10)) == 0);
+        REQUIRE(uut.degree(4) == 2);
+        REQUIRE(uut.distance(4) == 1);
+        REQUIRE(uut.degree(1) == 1);
+      }
+    }
+
+    WHEN("An accurate, late and polluting epoch follows an inaccurate one")
+    {
+      REQUIRE(first_epoch(epoch_of(100, 10, 20)) == 1);
+
+      uut.end_epoch(epoch_of(0, 0, 0));
+      auto change = uut.end_epoch(epoch_of(100, 10, 20));
+
+      THEN("The averaged accuracy is only medium, the pollution makes it less aggressive")
+      {
+        REQUIRE(change == -1);
+      }
+    }
+  }
+}
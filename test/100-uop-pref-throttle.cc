@@ -0,0 +1,170 @@
+#include <catch2/catch.hpp>
+
+#include "uop_pref_throttle.h"
+
+namespace
+{
+constexpr uint64_t branch = 0x401000;
+
+// resolves this many prefetches of the branch as used and unused, and ends the epoch
+void run_epoch(UopPrefThrottle& uut, uint64_t& cycle, unsigned used, unsigned unused, unsigned demand_evicted = 0)
+{
+  for (unsigned i = 0; i < used + unused; i++)
+    uut.OnPrefetchFill();
+  for (unsigned i = 0; i < used; i++)
+    uut.OnPrefetchUsed(branch);
+  for (unsigned i = 0; i < unused; i++)
+    uut.OnPrefetchUnused(branch);
+  for (unsigned i = 0; i < demand_evicted; i++)
+    uut.OnDemandEvicted(branch);
+
+  cycle += UOP_PREF_THROTTLE_EPOCH;
+  uut.Operate(cycle);
+}
+} // namespace
+
+SCENARIO("The uop cache prefetch throttle sets its level from the accuracy and the pollution of an epoch")
+{
+  GIVEN("A throttle at the most aggressive level")
+  {
+    UopPrefThrottle uut;
+    uint64_t cycle = 0;
+    const auto stats = get_profiler_ptr->uop_throttle_stats;
+
+    REQUIRE(uut.MaxIpCheck() == MAX_IP_CHECK);
+    REQUIRE(uut.EndThreshold() == H2P_T);
+
+    WHEN("An epoch resolves too few prefetches")
+    {
+      run_epoch(uut, cycle, 0, UOP_PREF_THROTTLE_MIN_SAMPLES - 1);
+
+      THEN("The level does not change")
+      {
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.epochs - stats.epochs == 1);
+        REQUIRE(uut.MaxIpCheck() == MAX_IP_CHECK);
+        REQUIRE_FALSE(uut.LowPriorityInsert(branch + 4));
+      }
+    }
+
+    WHEN("An epoch is inaccurate")
+    {
+      run_epoch(uut, cycle, 10, 90);
+
+      THEN("The alternate paths are halved and inserted at low priority")
+      {
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.throttle_up - stats.throttle_up == 1);
+        REQUIRE(uut.MaxIpCheck() == MAX_IP_CHECK / 2);
+        REQUIRE(uut.EndThreshold() == H2P_T / 2);
+        REQUIRE(uut.LowPriorityInsert(branch + 4));
+      }
+
+      AND_WHEN("The next epoch is accurate and does not pollute")
+      {
+        run_epoch(uut, cycle, 90, 10);
+
+        THEN("The level is restored")
+        {
+          REQUIRE(get_profiler_ptr->uop_throttle_stats.throttle_down - stats.throttle_down == 1);
+          REQUIRE(uut.MaxIpCheck() == MAX_IP_CHECK);
+          REQUIRE_FALSE(uut.LowPriorityInsert(branch + 4));
+        }
+      }
+    }
+
+    WHEN("An epoch is accurate but its prefetches evict demand windows")
+    {
+      run_epoch(uut, cycle, 90, 10, 30);
+
+      THEN("The level is lowered")
+      {
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.throttle_up - stats.throttle_up == 1);
+        REQUIRE(uut.MaxIpCheck() == MAX_IP_CHECK / 2);
+        REQUIRE_FALSE(uut.LowPriorityInsert(branch + 4));
+      }
+    }
+
+    WHEN("Every epoch is inaccurate")
+    {
+      for (unsigned i = 0; i <= UOP_PREF_THROTTLE_LEVELS; i++)
+        run_epoch(uut, cycle, 0, 100);
+
+      THEN("It stops at the least aggressive level, each epoch is counted at its level")
+      {
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.throttle_up - stats.throttle_up == UOP_PREF_THROTTLE_LEVELS - 1);
+        REQUIRE(uut.MaxIpCheck() == std::max<uint64_t>(MAX_IP_CHECK >> (UOP_PREF_THROTTLE_LEVELS - 1), UOP_PREF_THROTTLE_MIN_IP_CHECK));
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.epochs_at_level[UOP_PREF_THROTTLE_LEVELS - 1] - stats.epochs_at_level[UOP_PREF_THROTTLE_LEVELS - 1] == 2);
+        for (std::size_t i = 0; i < UOP_PREF_THROTTLE_LEVELS - 1; i++)
+          REQUIRE(get_profiler_ptr->uop_throttle_stats.epochs_at_level[i] - stats.epochs_at_level[i] == 1);
+      }
+    }
+  }
+}
+
+SCENARIO("The uop cache prefetch throttle disables the branches whose alternate paths are not used")
+{
+  GIVEN("A throttle that has seen a branch once")
+  {
+    UopPrefThrottle uut;
+    uint64_t cycle = 0;
+    const auto stats = get_profiler_ptr->uop_throttle_stats;
+
+    REQUIRE(uut.AllowPrefetch(branch));
+    REQUIRE_FALSE(uut.LowPriorityInsert(branch));
+
+    WHEN("Two of its prefetches are not used")
+    {
+      uut.OnPrefetchUnused(branch);
+      uut.OnPrefetchUnused(branch);
+
+      THEN("It still prefetches, at low priority")
+      {
+        REQUIRE(uut.AllowPrefetch(branch));
+        REQUIRE(uut.LowPriorityInsert(branch));
+      }
+
+      AND_WHEN("One more is used")
+      {
+        uut.OnPrefetchUsed(branch);
+
+        THEN("It is confident again")
+        {
+          REQUIRE_FALSE(uut.LowPriorityInsert(branch));
+        }
+      }
+    }
+
+    WHEN("Its prefetches keep evicting demand windows")
+    {
+      for (int i = 0; i < 4; i++)
+        uut.OnDemandEvicted(branch);
+
+      THEN("It is disabled")
+      {
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.branch_disabled - stats.branch_disabled == 1);
+        REQUIRE_FALSE(uut.AllowPrefetch(branch));
+        REQUIRE(get_profiler_ptr->uop_throttle_stats.blocked_lookups - stats.blocked_lookups == 1);
+      }
+
+      AND_WHEN("The epoch ends")
+      {
+        cycle += UOP_PREF_THROTTLE_EPOCH;
+        uut.Operate(cycle);
+
+        THEN("It is given another chance, at low priority")
+        {
+          REQUIRE(get_profiler_ptr->uop_throttle_stats.branch_reenabled - stats.branch_reenabled == 1);
+          REQUIRE(uut.AllowPrefetch(branch));
+          REQUIRE(uut.LowPriorityInsert(branch));
+        }
+      }
+    }
+
+    WHEN("Another branch has not been seen")
+    {
+      THEN("It is not at low priority")
+      {
+        REQUIRE_FALSE(uut.LowPriorityInsert(branch + 4));
+      }
+    }
+  }
+}
@@ -0,0 +1,142 @@
+#include <catch2/catch.hpp>
+
+#include "loop_buffer.h"
+
+namespace
+{
+constexpr uint64_t loop_start = 0x401000;
+
+// an instruction of uops uops, see MicroOpCache::EstimateUops()
+ooo_model_instr instr_at(uint64_t ip, unsigned uops)
+{
+  ooo_model_instr instr;
+  instr.ip = ip;
+  instr.source_registers = {1, 2};
+  for (uint8_t reg = 1; reg <= uops; reg++)
+    instr.destination_registers.push_back(reg);
+  return instr;
+}
+
+ooo_model_instr backward_branch_at(uint64_t ip, uint64_t target)
+{
+  ooo_model_instr instr = instr_at(ip, 1);
+  instr.is_branch = true;
+  instr.branch_taken = true;
+  instr.branch_target = target;
+  return instr;
+}
+
+// one iteration of a loop body of this many instructions of uops uops each, closed by a backward branch
+void run_iteration(LoopStreamDetector& uut, unsigned body_instrs, unsigned uops)
+{
+  for (unsigned i = 0; i < body_instrs; i++)
+    uut.Observe(instr_at(loop_start + 4 * i, uops));
+  uut.Observe(backward_branch_at(loop_start + 4 * body_instrs, loop_start));
+}
+} // namespace
+
+SCENARIO("The loop stream detector locks a loop after a number of iterations")
+{
+  GIVEN("A loop of 4 instructions of one uop")
+  {
+    LoopStreamDetector uut;
+    const auto locks = get_profiler_ptr->loop_buffer.locks;
+    const auto exits = get_profiler_ptr->loop_buffer.exits;
+
+    // the first iteration makes the loop a candidate
+    run_iteration(uut, 3, 1);
+
+    WHEN("It iterates one time less than needed")
+    {
+      for (unsigned i = 0; i < LOOP_BUFFER_MIN_ITERATIONS - 1; i++)
+        run_iteration(uut, 3, 1);
+
+      THEN("It does not stream from the loop buffer")
+      {
+        REQUIRE_FALSE(uut.Streams(loop_start));
+        REQUIRE(get_profiler_ptr->loop_buffer.locks == locks);
+      }
+    }
+
+    WHEN("It iterates as many times as needed")
+    {
+      for (unsigned i = 0; i < LOOP_BUFFER_MIN_ITERATIONS; i++)
+        run_iteration(uut, 3, 1);
+
+      THEN("Its body streams from the loop buffer")
+      {
+        REQUIRE(get_profiler_ptr->loop_buffer.locks - locks == 1);
+        REQUIRE(uut.Streams(loop_start));
+        REQUIRE(uut.Streams(loop_start + 12));
+        REQUIRE_FALSE(uut.Streams(loop_start + 16));
+        REQUIRE_FALSE(uut.Streams(loop_start - 4));
+      }
+
+      AND_WHEN("The next instruction is outside of the body")
+      {
+        uut.Observe(instr_at(loop_start + 16, 1));
+
+        THEN("The loop is unlocked")
+        {
+          REQUIRE(get_profiler_ptr->loop_buffer.exits - exits == 1);
+          REQUIRE_FALSE(uut.Streams(loop_start));
+        }
+
+        AND_WHEN("The loop is entered again")
+        {
+          run_iteration(uut, 3, 1);
+
+          THEN("It has to iterate again to be locked")
+          {
+            REQUIRE_FALSE(uut.Streams(loop_start));
+          }
+        }
+      }
+    }
+
+    WHEN("An iteration leaves the body")
+    {
+      for (unsigned i = 0; i < LOOP_BUFFER_MIN_ITERATIONS - 1; i++)
+        run_iteration(uut, 3, 1);
+      uut.Observe(instr_at(loop_start + 0x100, 1));
+      uut.Observe(backward_branch_at(loop_start + 12, loop_start));
+
+      THEN("The iterations are counted again")
+      {
+        REQUIRE_FALSE(uut.Streams(loop_start));
+      }
+    }
+  }
+}
+
+SCENARIO("The loop stream detector only locks a loop whose iterations fit in the loop buffer")
+{
+  static_assert(LOOP_BUFFER_UOPS % 4 == 0);
+
+  GIVEN("A loop whose iterations fit in the loop buffer")
+  {
+    LoopStreamDetector uut;
+
+    // instructions of 4 uops, and the one uop branch
+    for (unsigned i = 0; i <= LOOP_BUFFER_MIN_ITERATIONS; i++)
+      run_iteration(uut, LOOP_BUFFER_UOPS / 4 - 1, 4);
+
+    THEN("It is locked")
+    {
+      REQUIRE(uut.Streams(loop_start));
+    }
+  }
+
+  GIVEN("A loop whose iterations take one uop more than the loop buffer holds")
+  {
+    LoopStreamDetector uut;
+
+    for (unsigned i = 0; i <= LOOP_BUFFER_MIN_ITERATIONS; i++)
+      run_iteration(uut, LOOP_BUFFER_UOPS / 4, 4);
+
+    THEN("It is not locked")
+    {
+      REQUIRE_FALSE(uut.Streams(loop_start));
+    }
+  }
+}
@@ -0,0 +1,166 @@
+#include <catch2/catch.hpp>
+
+#include "msl/bounded_hash_map.h"
+
+// with as many probe slots as slots every key can use every slot, the table is fully associative
+using small_map = champsim::msl::bounded_hash_map<uint64_t, int, 8, 8>;
+using direct_mapped_map = champsim::msl::bounded_hash_map<uint64_t, int, 8, 8, false>;
+
+SCENARIO("A bounded hash map finds the keys it holds")
+{
+  GIVEN("An empty map")
+  {
+    small_map uut;
+    REQUIRE(uut.empty());
+    REQUIRE(uut.find(1) == nullptr);
+
+    WHEN("Keys are inserted")
+    {
+      uut[1] = 10;
+      uut[2] = 20;
+
+      THEN("They are found with their values")
+      {
+        REQUIRE(uut.size() == 2);
+        REQUIRE(uut.contains(1));
+        REQUIRE(*uut.find(1) == 10);
+        REQUIRE(*uut.find(2) == 20);
+        REQUIRE_FALSE(uut.contains(3));
+      }
+
+      THEN("Inserting a key again updates its value")
+      {
+        uut[1] = 11;
+        REQUIRE(uut.size() == 2);
+        REQUIRE(*uut.find(1) == 11);
+      }
+
+      THEN("Looking up a key does not insert it")
+      {
+        REQUIRE(uut.find(3) == nullptr);
+        REQUIRE(uut.size() == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("A full bounded hash map evicts its least recently used key")
+{
+  GIVEN("A full map")
+  {
+    small_map uut;
+    for (uint64_t key = 0; key < small_map::capacity(); key++)
+      uut[key] = static_cast<int>(key);
+    REQUIRE(uut.size() == small_map::capacity());
+
+    WHEN("A new key is inserted")
+    {
+      uut[100] = 100;
+
+      THEN("The first key is evicted")
+      {
+        REQUIRE(uut.size() == small_map::capacity());
+        REQUIRE(uut.evictions() == 1);
+        REQUIRE_FALSE(uut.contains(0));
+        REQUIRE(*uut.find(100) == 100);
+        for (uint64_t key = 1; key < small_map::capacity(); key++)
+          REQUIRE(uut.contains(key));
+      }
+    }
+
+    WHEN("The first key is used before a new key is inserted")
+    {
+      REQUIRE(*uut.find(0) == 0);
+      uut[100] = 100;
+
+      THEN("The second key is evicted instead")
+      {
+        REQUIRE(uut.contains(0));
+        REQUIRE_FALSE(uut.contains(1));
+      }
+    }
+  }
+
+  GIVEN("A full direct mapped map")
+  {
+    direct_mapped_map uut;
+    for (uint64_t key = 0; key < direct_mapped_map::capacity(); key++)
+      uut[key] = static_cast<int>(key);
+
+    WHEN("A new key is inserted")
+    {
+      uut[100] = 100;
+
+      THEN("One key is evicted")
+      {
+        REQUIRE(uut.size() == direct_mapped_map::capacity());
+        REQUIRE(uut.evictions() == 1);
+        REQUIRE(uut.contains(100));
+      }
+    }
+  }
+}
+
+SCENARIO("A key erased from a bounded hash map leaves a slot that does not hide the other keys")
+{
+  GIVEN("A full map")
+  {
+    small_map uut;
+    for (uint64_t key = 0; key < small_map::capacity(); key++)
+      uut[key] = static_cast<int>(key);
+
+    WHEN("A key is erased")
+    {
+      REQUIRE(uut.erase(3));
+
+      THEN("It is no longer found, and the keys probed past its slot still are")
+      {
+        REQUIRE(uut.size() == small_map::capacity() - 1);
+        REQUIRE_FALSE(uut.contains(3));
+        for (uint64_t key = 0; key < small_map::capacity(); key++) {
+          if (key != 3)
+            REQUIRE(*uut.find(key) == static_cast<int>(key));
+        }
+      }
+
+      THEN("Erasing it again fails")
+      {
+        REQUIRE_FALSE(uut.erase(3));
+      }
+
+      AND_WHEN("A new key is inserted")
+      {
+        uut[100] = 100;
+
+        THEN("It takes the freed slot without evicting")
+        {
+          REQUIRE(uut.evictions() == 0);
+          REQUIRE(uut.size() == small_map::capacity());
+          REQUIRE(uut.contains(0));
+        }
+      }
+
+      AND_WHEN("It is inserted again")
+      {
+        auto& value = uut[3];
+
+        THEN("Its value starts over")
+        {
+          REQUIRE(value == 0);
+          REQUIRE(uut.evictions() == 0);
+        }
+      }
+    }
+
+    WHEN("The map is cleared")
+    {
+      uut.clear();
+
+      THEN("It holds nothing")
+      {
+        REQUIRE(uut.empty());
+        REQUIRE_FALSE(uut.contains(0));
+      }
+    }
+  }
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+#include "replacement_state.h"
+
+namespace
+{
+// the first set that cpu leads for policy
+std::size_t leader_set(const champsim::set_dueling& uut, std::size_t num_sets, uint32_t cpu, std::size_t policy)
+{
+  for (std::size_t set = 0; set < num_sets; ++set) {
+    if (uut.is_leader(cpu, set) && uut.policy(cpu, set) == policy)
+      return set;
+  }
+  return num_sets;
+}
+} // namespace
+
+SCENARIO("The sampled sets are distinct and the same every time")
+{
+  GIVEN("A sample of 64 sets of 2048")
+  {
+    auto sets = champsim::sample_sets(2048, 64);
+
+    THEN("They are distinct sets of the cache, in ascending order")
+    {
+      REQUIRE(std::size(sets) == 64);
+      REQUIRE(std::is_sorted(std::begin(sets), std::end(sets)));
+      REQUIRE(std::adjacent_find(std::begin(sets), std::end(sets)) == std::end(sets));
+      REQUIRE(sets.back() < 2048);
+    }
+
+    THEN("Another sample is the same")
+    {
+      REQUIRE(champsim::sample_sets(2048, 64) == sets);
+    }
+  }
+
+  GIVEN("A sample of more sets than the cache has")
+  {
+    auto sets = champsim::sample_sets(16, 32);
+
+    THEN("Every set is sampled once")
+    {
+      std::vector<std::size_t> all(16);
+      std::iota(std::begin(all), std::end(all), 0);
+      REQUIRE(sets == all);
+    }
+  }
+}
+
+SCENARIO("The way metadata of a set is contiguous")
+{
+  GIVEN("The metadata of 4 sets of 8 ways")
+  {
+    champsim::way_metadata<int> uut{4, 8, -1};
+
+    THEN("Every way starts with the initial value")
+    {
+      REQUIRE(uut(0, 0) == -1);
+      REQUIRE(uut(3, 7) == -1);
+    }
+
+    WHEN("The ways of a set are written through its span")
+    {
+      auto [begin, end] = uut.set_span(2);
+      std::iota(begin, end, 0);
+
+      THEN("They are read back by set and way, the other sets are untouched")
+      {
+        REQUIRE(std::distance(begin, end) == 8);
+        for (std::size_t way = 0; way < 8; ++way)
+          REQUIRE(uut(2, way) == static_cast<int>(way));
+        REQUIRE(uut(1, 7) == -1);
+        REQUIRE(uut(3, 0) == -1);
+      }
+
+      THEN("The way of an element of the span is its position in the set")
+      {
+        auto victim = std::max_element(begin, end);
+        REQUIRE(uut.way_of(2, victim) == 7);
+        REQUIRE(uut.way_of(2, begin) == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("Set dueling gives every core its own leader sets and PSEL counter")
+{
+  constexpr std::size_t num_sets = 2048;
+
+  GIVEN("A cache of 2048 sets shared by 4 cores, with 32 leader sets per policy")
+  {
+    champsim::set_dueling uut{num_sets, 4, 32, 4};
+
+    THEN("Every core leads 32 sets of each policy, no set leads for two cores")
+    {
+      REQUIRE(uut.leader_sets() == 32);
+      std::size_t leaders = 0;
+      for (std::size_t set = 0; set < num_sets; ++set) {
+        unsigned cores = 0;
+        for (uint32_t cpu = 0; cpu < 4; ++cpu)
+          cores += uut.is_leader(cpu, set);
+        REQUIRE(cores <= 1);
+        leaders += cores;
+      }
+      REQUIRE(leaders == 4 * 2 * 32);
+
+      for (uint32_t cpu = 0; cpu < 4; ++cpu) {
+        for (std::size_t policy = 0; policy < 2; ++policy) {
+          std::size_t count = 0;
+          for (std::size_t set = 0; set < num_sets; ++set)
+            count += uut.is_leader(cpu, set) && uut.policy(cpu, set) == policy;
+          REQUIRE(count == 32);
+        }
+      }
+    }
+
+    THEN("The followers start with the first policy")
+    {
+      for (uint32_t cpu = 0; cpu < 4; ++cpu)
+        REQUIRE(uut.winner(cpu) == 0);
+    }
+
+    WHEN("A core misses in a leader set of the first policy")
+    {
+      uut.record_miss(1, leader_set(uut, num_sets, 1, 0));
+
+      THEN("Its followers switch to the second policy, the other cores do not")
+      {
+        REQUIRE(uut.winner(1) == 1);
+        REQUIRE(uut.winner(0) == 0);
+        REQUIRE(uut.winner(2) == 0);
+      }
+
+      THEN("Its leader sets keep their own policy")
+      {
+        REQUIRE(uut.policy(1, leader_set(uut, num_sets, 1, 0)) == 0);
+      }
+    }
+
+    WHEN("A core misses in a leader set of another core")
+    {
+      uut.record_miss(1, leader_set(uut, num_sets, 2, 0));
+
+      THEN("Its counter does not move")
+      {
+        REQUIRE(uut.winner(1) == 0);
+        REQUIRE(uut.winner(2) == 0);
+      }
+    }
+
+    WHEN("A core misses many times in a leader set of the first policy")
+    {
+      for (int i = 0; i < 100; ++i)
+        uut.record_miss(0, leader_set(uut, num_sets, 0, 0));
+
+      THEN("Its 4 bit counter saturates, half of its range of misses in the other leaders switches it back")
+      {
+        for (int i = 0; i < 7; ++i)
+          uut.record_miss(0, leader_set(uut, num_sets, 0, 1));
+        REQUIRE(uut.winner(0) == 1);
+        uut.record_miss(0, leader_set(uut, num_sets, 0, 1));
+        REQUIRE(uut.winner(0) == 0);
+      }
+    }
+
+    WHEN("A core misses many times in a leader set of the second policy")
+    {
+      for (int i = 0; i < 100; ++i)
+        uut.record_miss(0, leader_set(uut, num_sets, 0, 1));
+
+      THEN("Its counter saturates at zero")
+      {
+        REQUIRE(uut.winner(0) == 0);
+        for (int i = 0; i < 7; ++i)
+          uut.record_miss(0, leader_set(uut, num_sets, 0, 0));
+        REQUIRE(uut.winner(0) == 0);
+        uut.record_miss(0, leader_set(uut, num_sets, 0, 0));
+        REQUIRE(uut.winner(0) == 1);
+      }
+    }
+  }
+
+  GIVEN("A small cache with many cores")
+  {
+    champsim::set_dueling uut{64, 4, 32};
+
+    THEN("The leader sets of each policy are limited so that some sets follow")
+    {
+      REQUIRE(uut.leader_sets() == 4);
+      std::size_t followers = 0;
+      for (std::size_t set = 0; set < 64; ++set) {
+        bool leads = false;
+        for (uint32_t cpu = 0; cpu < 4; ++cpu)
+          leads = leads || uut.is_leader(cpu, set);
+        followers += !leads;
+      }
+      REQUIRE(followers == 64 - 4 * 2 * 4);
+    }
+  }
+}
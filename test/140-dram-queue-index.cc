@@ -0,0 +1,262 @@
+#include <catch2/catch.hpp>
+
+#include "dram_controller.h"
+
+namespace
+{
+// the slots of the bank that f is called for by for_each_ready()
+std::vector<std::size_t> ready_slots(const dram_queue_index& uut, std::size_t bank, uint64_t cycle)
+{
+  std::vector<std::size_t> slots;
+  uut.for_each_ready(bank, cycle, [&](std::size_t slot) { slots.push_back(slot); });
+  return slots;
+}
+} // namespace
+
+SCENARIO("The DRAM queue index follows the occupancy of the queue")
+{
+  GIVEN("The index of a queue of 100 slots")
+  {
+    dram_queue_index uut{100, 4};
+    REQUIRE(uut.size() == 0);
+    REQUIRE(uut.free_slot() == 0);
+
+    WHEN("Every slot is taken")
+    {
+      for (std::size_t slot = 0; slot < 100; ++slot) {
+        REQUIRE(uut.free_slot() == slot);
+        uut.insert(slot, 0x1000 + slot, slot % 4, 0);
+      }
+
+      THEN("There is no free slot, not even past the end of the queue")
+      {
+        REQUIRE(uut.size() == 100);
+        REQUIRE(uut.free_slot() == dram_queue_index::NONE);
+      }
+
+      AND_WHEN("A slot is erased")
+      {
+        uut.erase(70);
+
+        THEN("It is the free slot")
+        {
+          REQUIRE(uut.size() == 99);
+          REQUIRE(uut.free_slot() == 70);
+        }
+      }
+
+      AND_WHEN("The index is cleared")
+      {
+        uut.clear();
+
+        THEN("It is empty")
+        {
+          REQUIRE(uut.size() == 0);
+          REQUIRE(uut.free_slot() == 0);
+          REQUIRE(uut.find(0x1000) == dram_queue_index::NONE);
+          REQUIRE(uut.oldest_ready() == dram_queue_index::NONE);
+          REQUIRE(uut.take_unchecked().empty());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("The DRAM queue index finds the slots of a block address")
+{
+  GIVEN("Three packets of one block and one of another")
+  {
+    dram_queue_index uut{64, 4};
+    uut.insert(2, 0xabc, 0, 0);
+    uut.insert(5, 0xabc, 1, 0);
+    uut.insert(9, 0xabc, 2, 0);
+    uut.insert(4, 0xdef, 0, 0);
+
+    THEN("The lowest slot of the block is found, within the range asked for")
+    {
+      REQUIRE(uut.find(0xabc) == 2);
+      REQUIRE(uut.find(0xabc, 0, 2) == dram_queue_index::NONE);
+      REQUIRE(uut.find(0xabc, 3) == 5);
+      REQUIRE(uut.find(0xabc, 6, 10) == 9);
+      REQUIRE(uut.find(0xdef) == 4);
+      REQUIRE(uut.find(0x123) == dram_queue_index::NONE);
+    }
+
+    WHEN("The packets of the block are erased from the middle and the head of its chain")
+    {
+      uut.erase(5);
+
+      THEN("The others are still found")
+      {
+        REQUIRE(uut.find(0xabc, 3) == 9);
+        REQUIRE(uut.find(0xabc) == 2);
+      }
+
+      AND_WHEN("The rest is erased")
+      {
+        uut.erase(2);
+        uut.erase(9);
+
+        THEN("The block is no longer found, the other one still is")
+        {
+          REQUIRE(uut.find(0xabc) == dram_queue_index::NONE);
+          REQUIRE(uut.find(0xdef) == 4);
+        }
+      }
+    }
+
+    THEN("The inserted slots are checked for collisions once, in slot order")
+    {
+      REQUIRE(uut.take_unchecked() == std::vector<std::size_t>{2, 4, 5, 9});
+      REQUIRE(uut.take_unchecked().empty());
+    }
+  }
+}
+
+SCENARIO("The ready lists of the DRAM queue index follow scheduling")
+{
+  GIVEN("Two packets of a bank ready at cycle 10 and one of another bank ready at cycle 5")
+  {
+    dram_queue_index uut{64, 4};
+    uut.insert(3, 0x1, 0, 10);
+    uut.insert(1, 0x2, 0, 10);
+    uut.insert(2, 0x3, 1, 5);
+
+    THEN("They are ready from their cycle, oldest first then by slot")
+    {
+      REQUIRE(uut.oldest_ready() == 2);
+      REQUIRE(ready_slots(uut, 0, 9).empty());
+      REQUIRE(ready_slots(uut, 0, 10) == std::vector<std::size_t>{1, 3});
+      REQUIRE(ready_slots(uut, 1, 10) == std::vector<std::size_t>{2});
+      REQUIRE(uut.any_ready(0, [](std::size_t slot) { return slot == 3; }));
+      REQUIRE_FALSE(uut.any_ready(2, [](std::size_t) { return true; }));
+    }
+
+    WHEN("A packet is scheduled")
+    {
+      uut.remove_ready(2);
+
+      THEN("It is no longer ready")
+      {
+        REQUIRE(uut.oldest_ready() == 1);
+        REQUIRE(ready_slots(uut, 1, 100).empty());
+        REQUIRE_FALSE(uut.any_ready(1, [](std::size_t) { return true; }));
+      }
+
+      AND_WHEN("A mode switch puts it back")
+      {
+        uut.make_ready(2, 20);
+
+        THEN("It is ready again from the cycle of the switch, once")
+        {
+          REQUIRE(ready_slots(uut, 1, 19).empty());
+          REQUIRE(ready_slots(uut, 1, 20) == std::vector<std::size_t>{2});
+          REQUIRE(uut.oldest_ready() == 1);
+        }
+
+        AND_WHEN("It is scheduled and put back again")
+        {
+          uut.remove_ready(2);
+          uut.make_ready(2, 30);
+
+          THEN("Only its last ready entry counts")
+          {
+            REQUIRE(ready_slots(uut, 1, 100) == std::vector<std::size_t>{2});
+          }
+        }
+      }
+
+      AND_WHEN("It is erased")
+      {
+        uut.erase(2);
+
+        THEN("The index holds the others")
+        {
+          REQUIRE(uut.size() == 2);
+          REQUIRE(uut.find(0x3) == dram_queue_index::NONE);
+          REQUIRE(uut.oldest_ready() == 1);
+        }
+      }
+    }
+
+    WHEN("A ready packet is erased and its slot is reused")
+    {
+      uut.erase(1);
+      uut.insert(1, 0x4, 0, 40);
+
+      THEN("Only the new packet of the slot is ready")
+      {
+        REQUIRE(ready_slots(uut, 0, 10) == std::vector<std::size_t>{3});
+        REQUIRE(ready_slots(uut, 0, 40) == std::vector<std::size_t>{3, 1});
+        REQUIRE(uut.find(0x2) == dram_queue_index::NONE);
+        REQUIRE(uut.find(0x4) == 1);
+      }
+
+      THEN("The oldest ready packets are those still waiting")
+      {
+        REQUIRE(uut.oldest_ready() == 2);
+        uut.remove_ready(2);
+        REQUIRE(uut.oldest_ready() == 3);
+        uut.remove_ready(3);
+        REQUIRE(uut.oldest_ready() == 1);
+        uut.remove_ready(1);
+        REQUIRE(uut.oldest_ready() == dram_queue_index::NONE);
+      }
+    }
+  }
+}
+
+namespace
+{
+struct return_counter : public MemoryRequestProducer {
+  std::size_t returned = 0;
+  void return_data(const PACKET&) override { ++returned; }
+};
+} // namespace
+
+SCENARIO("The ready lists of the DRAM queue index stay within the queue under a non fcfs scheduler")
+{
+  dram_scheduler_spec scheduling;
+  scheduling.policy = dram_scheduler::frfcfs;
+  scheduling.priority = dram_priority::critical;
+
+  GIVEN("A controller with a frfcfs scheduler")
+  {
+    MEMORY_CONTROLLER uut{1, DRAM_IO_FREQ, 12.5, 12.5, 12.5, 0, {}, scheduling};
+    return_counter requester;
+    uut.warmup = false;
+    uut.begin_phase();
+
+    WHEN("Many more reads than the queue holds are scheduled")
+    {
+      const std::size_t num_reads = 8 * DRAM_RQ_SIZE;
+      std::size_t sent = 0;
+      std::size_t max_listed = 0;
+      for (int i = 0; i < 1000000 && requester.returned < num_reads; ++i) {
+        if (sent < num_reads) {
+          PACKET read;
+          read.address = 0x100000 + sent * 0x2040;
+          read.to_return = {&requester};
+          if (uut.add_rq(read))
+            ++sent;
+        }
+        uut._operate();
+        for (std::size_t bank = 0; bank < DRAM_RANKS * DRAM_BANKS; ++bank)
+          max_listed = std::max(max_listed, uut.channels[0].RQ_index.num_ready(bank));
+      }
+
+      THEN("Every read returns and no ready list ever outgrew the queue")
+      {
+        REQUIRE(requester.returned == num_reads);
+        REQUIRE(max_listed > 0);
+        REQUIRE(max_listed <= DRAM_RQ_SIZE);
+      }
+
+      THEN("The ready lists are empty once the queue is drained")
+      {
+        for (std::size_t bank = 0; bank < DRAM_RANKS * DRAM_BANKS; ++bank)
+          REQUIRE(uut.channels[0].RQ_index.num_ready(bank) == 0);
+      }
+    }
+  }
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch.hpp>
+
+#include <numeric>
+
+#include "msl/small_vector.h"
+
+using small_vector = champsim::msl::small_vector<int, 4>;
+
+namespace
+{
+small_vector filled(int count)
+{
+  small_vector uut;
+  for (int i = 0; i < count; ++i)
+    uut.push_back(i);
+  return uut;
+}
+
+bool holds_first(const small_vector& uut, int count)
+{
+  if (static_cast<int>(std::size(uut)) != count)
+    return false;
+  for (int i = 0; i < count; ++i) {
+    if (uut[static_cast<std::size_t>(i)] != i)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+SCENARIO("A small vector keeps its first elements inline and spills the rest to the heap")
+{
+  GIVEN("A small vector filled up to its inline capacity")
+  {
+    auto uut = filled(4);
+
+    THEN("It has not grown")
+    {
+      REQUIRE(uut.capacity() == small_vector::inline_capacity());
+      REQUIRE(holds_first(uut, 4));
+    }
+
+    WHEN("One more element is added")
+    {
+      const auto* inline_data = uut.data();
+      uut.push_back(4);
+
+      THEN("It moves to a larger heap buffer with its elements")
+      {
+        REQUIRE(uut.capacity() >= 5);
+        REQUIRE(uut.data() != inline_data);
+        REQUIRE(holds_first(uut, 5));
+      }
+    }
+
+    WHEN("One of its own elements is added")
+    {
+      uut.push_back(uut.front());
+
+      THEN("The element is copied before the buffer it lives in is replaced")
+      {
+        REQUIRE(std::size(uut) == 5);
+        REQUIRE(uut.back() == 0);
+      }
+    }
+  }
+
+  GIVEN("A small vector that spilled to the heap")
+  {
+    auto uut = filled(9);
+    REQUIRE(holds_first(uut, 9));
+    const auto capacity = uut.capacity();
+
+    WHEN("It is copied")
+    {
+      small_vector copy = uut;
+      copy[0] = 100;
+
+      THEN("The copy has its own buffer")
+      {
+        REQUIRE(holds_first(uut, 9));
+        REQUIRE(std::size(copy) == 9);
+        REQUIRE(copy[0] == 100);
+      }
+    }
+
+    WHEN("It is moved")
+    {
+      const auto* heap = uut.data();
+      small_vector moved = std::move(uut);
+
+      THEN("The heap buffer is taken, the source is left empty and inline")
+      {
+        REQUIRE(moved.data() == heap);
+        REQUIRE(holds_first(moved, 9));
+        REQUIRE(uut.empty());
+        REQUIRE(uut.capacity() == small_vector::inline_capacity());
+      }
+    }
+
+    WHEN("It is cleared and refilled")
+    {
+      uut.clear();
+      uut = {0, 1, 2};
+
+      THEN("It keeps its heap buffer")
+      {
+        REQUIRE(uut.capacity() == capacity);
+        REQUIRE(holds_first(uut, 3));
+      }
+    }
+
+    WHEN("Elements are erased")
+    {
+      uut.erase(std::next(uut.cbegin()), std::next(uut.cbegin(), 3));
+      uut.erase(uut.cbegin());
+
+      THEN("The rest close the gap in order")
+      {
+        REQUIRE(std::size(uut) == 6);
+        REQUIRE(uut.front() == 3);
+        REQUIRE(uut.back() == 8);
+        REQUIRE(std::is_sorted(uut.begin(), uut.end()));
+      }
+    }
+  }
+
+  GIVEN("An inline small vector")
+  {
+    auto uut = filled(3);
+
+    WHEN("It is moved")
+    {
+      small_vector moved = std::move(uut);
+
+      THEN("Its elements are copied")
+      {
+        REQUIRE(holds_first(moved, 3));
+        REQUIRE(moved.capacity() == small_vector::inline_capacity());
+        REQUIRE(uut.empty());
+      }
+    }
+
+    WHEN("Space is reserved past its inline capacity")
+    {
+      uut.reserve(16);
+
+      THEN("It keeps its elements in a heap buffer of that capacity")
+      {
+        REQUIRE(uut.capacity() == 16);
+        REQUIRE(holds_first(uut, 3));
+      }
+    }
+
+    WHEN("Space is reserved within its inline capacity")
+    {
+      uut.reserve(2);
+
+      THEN("It does not grow")
+      {
+        REQUIRE(uut.capacity() == small_vector::inline_capacity());
+      }
+    }
+  }
+}
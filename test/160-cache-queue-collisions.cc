@@ -0,0 +1,175 @@
+#include <catch2/catch.hpp>
+
+#include "cache.h"
+
+namespace
+{
+// a translated packet of the address, for the instruction
+PACKET packet_of(uint64_t address, ooo_model_instr& instr)
+{
+  PACKET packet;
+  packet.address = address;
+  packet.v_address = address + 0x100000;
+  packet.instr_id = instr.instr_id;
+  packet.instr_depend_on_me.push_back(instr);
+  return packet;
+}
+
+std::vector<uint64_t> dependents_of(const PACKET& packet)
+{
+  std::vector<uint64_t> ids;
+  for (const ooo_model_instr& instr : packet.instr_depend_on_me)
+    ids.push_back(instr.instr_id);
+  return ids;
+}
+} // namespace
+
+SCENARIO("The line index of a cache queue keeps the first position of a line")
+{
+  GIVEN("An index of a queue of 4 packets")
+  {
+    queue_line_index uut;
+    uut.reset(4);
+    uut.insert(0xa, 0);
+    uut.insert(0xb, 1);
+    uut.insert(0xa, 2);
+
+    THEN("A line is found at its first position")
+    {
+      REQUIRE(uut.find(0xa) == 0);
+      REQUIRE(uut.find(0xb) == 1);
+      REQUIRE(uut.find(0xc) == queue_line_index::NONE);
+    }
+
+    WHEN("It is reset for a larger queue")
+    {
+      uut.reset(64);
+      for (uint64_t line = 0; line < 64; ++line)
+        uut.insert(0x1000 + line, static_cast<std::size_t>(63 - line));
+
+      THEN("The former lines are forgotten and every new one is found")
+      {
+        REQUIRE(uut.find(0xa) == queue_line_index::NONE);
+        for (uint64_t line = 0; line < 64; ++line)
+          REQUIRE(uut.find(0x1000 + line) == 63 - line);
+      }
+    }
+  }
+}
+
+SCENARIO("The collision check of the cache queues merges a packet with the first one of its line")
+{
+  std::array<ooo_model_instr, 8> instrs;
+  for (std::size_t i = 0; i < std::size(instrs); ++i)
+    instrs[i].instr_id = i + 1;
+
+  GIVEN("A read queue with two packets of different lines")
+  {
+    CACHE::NonTranslatingQueues uut{1, 32, 32, 32, 32, 0, LOG2_BLOCK_SIZE, false};
+    uut.begin_phase();
+    uut.add_rq(packet_of(0x1000, instrs[0]));
+    uut.add_rq(packet_of(0x2000, instrs[1]));
+    uut.operate();
+
+    WHEN("A packet of the first line is added")
+    {
+      uut.add_rq(packet_of(0x1010, instrs[2]));
+      uut.operate();
+
+      THEN("It is merged into the first packet")
+      {
+        REQUIRE(std::size(uut.RQ) == 2);
+        REQUIRE(uut.sim_stats.back().RQ_MERGED == 1);
+        REQUIRE(dependents_of(uut.RQ[0]) == std::vector<uint64_t>{1, 3});
+        REQUIRE(dependents_of(uut.RQ[1]) == std::vector<uint64_t>{2});
+      }
+    }
+
+    WHEN("Two packets of the second line are added in the same cycle")
+    {
+      uut.add_rq(packet_of(0x2008, instrs[2]));
+      uut.add_rq(packet_of(0x2010, instrs[3]));
+      uut.operate();
+
+      THEN("Both are merged into it")
+      {
+        REQUIRE(std::size(uut.RQ) == 2);
+        REQUIRE(dependents_of(uut.RQ[1]) == std::vector<uint64_t>{2, 3, 4});
+      }
+    }
+
+    WHEN("The first packet leaves the queue and a packet of the second line is added")
+    {
+      uut.RQ.pop_front();
+      uut.add_rq(packet_of(0x2008, instrs[2]));
+      uut.operate();
+
+      THEN("It is merged into the second packet at its new position")
+      {
+        REQUIRE(std::size(uut.RQ) == 1);
+        REQUIRE(dependents_of(uut.RQ[0]) == std::vector<uint64_t>{2, 3});
+      }
+
+      AND_WHEN("A packet of the line that left is added")
+      {
+        uut.add_rq(packet_of(0x1000, instrs[3]));
+        uut.operate();
+
+        THEN("It is not merged")
+        {
+          REQUIRE(std::size(uut.RQ) == 2);
+          REQUIRE(dependents_of(uut.RQ[1]) == std::vector<uint64_t>{4});
+        }
+      }
+    }
+
+    WHEN("A packet is merged, the packet before it leaves and another one of the line is added")
+    {
+      uut.add_rq(packet_of(0x2010, instrs[2]));
+      uut.operate();
+      uut.RQ.pop_front();
+      uut.add_rq(packet_of(0x2020, instrs[3]));
+      uut.operate();
+
+      THEN("Every packet of the line ends up in the remaining one")
+      {
+        REQUIRE(std::size(uut.RQ) == 1);
+        REQUIRE(uut.sim_stats.back().RQ_MERGED == 2);
+        REQUIRE(dependents_of(uut.RQ[0]) == std::vector<uint64_t>{2, 3, 4});
+      }
+    }
+  }
+
+  GIVEN("A write queue with a packet")
+  {
+    CACHE::NonTranslatingQueues uut{1, 32, 32, 32, 32, 0, LOG2_BLOCK_SIZE, false};
+    uut.begin_phase();
+    uut.add_wq(packet_of(0x3000, instrs[0]));
+    uut.operate();
+
+    WHEN("A read of its line is added")
+    {
+      uut.add_rq(packet_of(0x3008, instrs[1]));
+      uut.operate();
+
+      THEN("The read is served by the write and leaves the queue")
+      {
+        REQUIRE(std::empty(uut.RQ));
+        REQUIRE(uut.sim_stats.back().WQ_FORWARD == 1);
+        REQUIRE(std::size(uut.WQ) == 1);
+      }
+    }
+
+    WHEN("Another write of its line is added")
+    {
+      uut.add_wq(packet_of(0x3008, instrs[1]));
+      uut.operate();
+
+      THEN("It is merged")
+      {
+        REQUIRE(std::size(uut.WQ) == 1);
+        REQUIRE(uut.sim_stats.back().WQ_MERGED == 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,170 @@
+#include <catch2/catch.hpp>
+
+#include "micro_op_cache.h"
+
+namespace
+{
+// windows that all map to set 0
+constexpr uint64_t window_in_set(uint64_t i) { return 0x400000 + i * UOP_CACHE_NUM_SETS * SIZE_WINDOWS; }
+
+template <typename T>
+void use_policy(MicroOpCache& uut, T policy)
+{
+  uut.uop_repl_type = policy;
+  uut.impl_uop_initialize_replacement();
+}
+
+void insert_demand(MicroOpCache& uut, uint64_t ip, uint64_t cycle) { uut.Insert(ip, cycle, false, false, false, false, false, false); }
+void insert_alternate_path(MicroOpCache& uut, uint64_t ip, uint64_t cycle) { uut.Insert(ip, cycle, false, false, true, false, false, true); }
+} // namespace
+
+SCENARIO("The lru uop cache module evicts like EvictLRU_AlternatePath")
+{
+  static_assert(NUM_WAYS > 4);
+
+  GIVEN("A set filled with demand windows, one per cycle")
+  {
+    MicroOpCache uut;
+    use_policy(uut, MicroOpCache::uuop_replacementDlru);
+    for (uint64_t i = 0; i < NUM_WAYS; ++i)
+      insert_demand(uut, window_in_set(i), i + 1);
+
+    THEN("Every window is resident")
+    {
+      for (uint64_t i = 0; i < NUM_WAYS; ++i)
+        REQUIRE(uut.Ishit(window_in_set(i)));
+    }
+
+    WHEN("Another window is inserted")
+    {
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("The least recently used window is evicted")
+      {
+        REQUIRE_FALSE(uut.Ishit(window_in_set(0)));
+        for (uint64_t i = 1; i <= NUM_WAYS; ++i)
+          REQUIRE(uut.Ishit(window_in_set(i)));
+      }
+    }
+
+    WHEN("The least recently used window is looked up before another window is inserted")
+    {
+      REQUIRE(uut.Lookup(window_in_set(0), 50));
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("The next least recently used window is evicted")
+      {
+        REQUIRE(uut.Ishit(window_in_set(0)));
+        REQUIRE_FALSE(uut.Ishit(window_in_set(1)));
+      }
+    }
+  }
+
+  GIVEN("A set where the fourth least recently used window is an alternate path prefetch")
+  {
+    MicroOpCache uut;
+    use_policy(uut, MicroOpCache::uuop_replacementDlru);
+    for (uint64_t i = 0; i < NUM_WAYS; ++i) {
+      if (i == 3)
+        insert_alternate_path(uut, window_in_set(i), i + 1);
+      else
+        insert_demand(uut, window_in_set(i), i + 1);
+    }
+
+    WHEN("Another window is inserted")
+    {
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("The prefetched window goes before the least recently used one")
+      {
+        REQUIRE(uut.Ishit(window_in_set(0)));
+        REQUIRE_FALSE(uut.Ishit(window_in_set(3)));
+      }
+    }
+
+    WHEN("The prefetched window is looked up before another window is inserted")
+    {
+      REQUIRE(uut.Lookup(window_in_set(3), 4));
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("It lost its priority, the least recently used window is evicted")
+      {
+        REQUIRE(uut.Ishit(window_in_set(3)));
+        REQUIRE_FALSE(uut.Ishit(window_in_set(0)));
+      }
+    }
+  }
+
+  GIVEN("A set where the only alternate path prefetch is not among the four least recently used windows")
+  {
+    MicroOpCache uut;
+    use_policy(uut, MicroOpCache::uuop_replacementDlru);
+    for (uint64_t i = 0; i < NUM_WAYS; ++i) {
+      if (i == 4)
+        insert_alternate_path(uut, window_in_set(i), i + 1);
+      else
+        insert_demand(uut, window_in_set(i), i + 1);
+    }
+
+    WHEN("Another window is inserted")
+    {
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("The least recently used window is evicted")
+      {
+        REQUIRE_FALSE(uut.Ishit(window_in_set(0)));
+        REQUIRE(uut.Ishit(window_in_set(4)));
+      }
+    }
+  }
+}
+
+SCENARIO("The srrip uop cache module inserts with a long re-reference and ages the set")
+{
+  GIVEN("A set filled with demand windows, the first of which is hit")
+  {
+    MicroOpCache uut;
+    use_policy(uut, MicroOpCache::uuop_replacementDsrrip);
+    for (uint64_t i = 0; i < NUM_WAYS; ++i)
+      insert_demand(uut, window_in_set(i), i + 1);
+    REQUIRE(uut.Lookup(window_in_set(0), 50));
+
+    WHEN("Another window is inserted")
+    {
+      insert_demand(uut, window_in_set(NUM_WAYS), 100);
+
+      THEN("The set is aged once and the first way with a distant re-reference is evicted")
+      {
+        REQUIRE(uut.Ishit(window_in_set(0)));
+        REQUIRE_FALSE(uut.Ishit(window_in_set(1)));
+        for (uint64_t i = 2; i <= NUM_WAYS; ++i)
+          REQUIRE(uut.Ishit(window_in_set(i)));
+      }
+
+      AND_WHEN("The other windows of the set are replaced as well")
+      {
+        for (uint64_t i = 1; i < NUM_WAYS - 1; ++i)
+          insert_demand(uut, window_in_set(NUM_WAYS + i), 100 + i);
+
+        THEN("The distant windows went in way order without aging the hit window out")
+        {
+          for (uint64_t i = 1; i < NUM_WAYS; ++i)
+            REQUIRE_FALSE(uut.Ishit(window_in_set(i)));
+          REQUIRE(uut.Ishit(window_in_set(0)));
+        }
+
+        AND_WHEN("One more window is inserted")
+        {
+          insert_demand(uut, window_in_set(2 * NUM_WAYS - 1), 200);
+
+          THEN("The set is aged again, the inserted windows reach a distant re-reference before the hit window")
+          {
+            REQUIRE(uut.Ishit(window_in_set(0)));
+            REQUIRE_FALSE(uut.Ishit(window_in_set(NUM_WAYS)));
+            REQUIRE(uut.Ishit(window_in_set(NUM_WAYS + 1)));
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,19 @@
+#include <algorithm>
+
+#include "micro_op_cache.h"
+
+void MicroOpCache::uop_initialize_replacement() {}
+
+// the coldest window, hotness counts the cycles with a hit and decays every UOP_CACHE_NUM_TICKS cycles
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  auto victim = std::min_element(current_set, current_set + ways,
+                                 [](const uop_cache_entry_t& a, const uop_cache_entry_t& b) { return a.hotness < b.hotness; });
+  return static_cast<uint64_t>(std::distance(current_set, victim));
+}
+
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle) {}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority) {}
+
+void MicroOpCache::uop_replacement_final_stats() {}
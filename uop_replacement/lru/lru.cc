@@ -0,0 +1,35 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "micro_op_cache.h"
+
+void MicroOpCache::uop_initialize_replacement() {}
+
+// LRU among the 4 least recently used windows, a window prefetched on the alternate path of a branch (and not used
+// since) goes first
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  std::vector<std::pair<uint64_t, uint64_t>> entries; // way, last_used
+
+  for (uint64_t way = 0; way < ways; ++way)
+    entries.push_back({way, current_set[way].last_used});
+
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+  auto lru4_end = entries.begin() + std::min(4UL, entries.size());
+
+  auto victim = std::min_element(entries.begin(), lru4_end, [current_set](const auto& a, const auto& b) {
+    if (current_set[a.first].alternate_path_prefetch != current_set[b.first].alternate_path_prefetch)
+      return current_set[a.first].alternate_path_prefetch;
+    return a.second < b.second;
+  });
+
+  return victim->first;
+}
+
+// last_used is kept by the uop cache itself
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle) {}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority) {}
+
+void MicroOpCache::uop_replacement_final_stats() {}
@@ -0,0 +1,34 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "micro_op_cache.h"
+
+void MicroOpCache::uop_initialize_replacement() {}
+
+// the least recently used of the 4 LRU windows off the critical path, then the least recently used critical window
+// whose criticality is not confident, then the least recently used window
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  std::vector<uint64_t> order(ways);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [current_set](uint64_t a, uint64_t b) { return current_set[a].last_used < current_set[b].last_used; });
+
+  auto least_4_end = std::next(order.begin(), std::min<long>(4, static_cast<long>(ways)));
+  auto victim = std::find_if(order.begin(), least_4_end, [current_set](uint64_t way) { return !current_set[way].is_critical; });
+  if (victim != least_4_end)
+    return *victim;
+
+  victim = std::find_if(order.begin(), order.end(),
+                        [current_set](uint64_t way) { return current_set[way].is_critical && !current_set[way].critical_hotness.confident(); });
+  if (victim != order.end())
+    return *victim;
+
+  return order.front();
+}
+
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle) {}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority) {}
+
+void MicroOpCache::uop_replacement_final_stats() {}
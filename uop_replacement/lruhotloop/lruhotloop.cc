@@ -0,0 +1,33 @@
+#include <algorithm>
+#include <vector>
+
+#include "micro_op_cache.h"
+
+void MicroOpCache::uop_initialize_replacement() {}
+
+// the coldest of the 4 least recently used windows
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  std::vector<uint64_t> last_used_vector;
+  for (uint64_t way = 0; way < ways; ++way)
+    last_used_vector.push_back(current_set[way].last_used);
+
+  std::sort(last_used_vector.begin(), last_used_vector.end());
+  std::vector<uint64_t> least_4(last_used_vector.begin(), last_used_vector.begin() + 4);
+
+  uint64_t victim = 0;
+  for (uint64_t way = 0; way < ways; ++way) {
+    for (auto& x : least_4) {
+      if (current_set[way].last_used == x && current_set[way].hotness < current_set[victim].hotness)
+        victim = way;
+    }
+  }
+
+  return victim;
+}
+
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle) {}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority) {}
+
+void MicroOpCache::uop_replacement_final_stats() {}
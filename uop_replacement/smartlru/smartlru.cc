@@ -0,0 +1,24 @@
+#include <algorithm>
+
+#include "micro_op_cache.h"
+
+void MicroOpCache::uop_initialize_replacement() {}
+
+// an invalidated window if there is one, the least recently used otherwise
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  auto begin = current_set;
+  auto end = current_set + ways;
+
+  auto victim = std::find_if(begin, end, [](const uop_cache_entry_t& x) { return !x.is_valid; });
+  if (victim == end)
+    victim = std::min_element(begin, end, [](const uop_cache_entry_t& a, const uop_cache_entry_t& b) { return a.last_used < b.last_used; });
+
+  return static_cast<uint64_t>(std::distance(begin, victim));
+}
+
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle) {}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority) {}
+
+void MicroOpCache::uop_replacement_final_stats() {}
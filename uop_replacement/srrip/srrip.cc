@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <iostream>
+
+#include "micro_op_cache.h"
+
+/*
+ * SRRIP (Jaleel et al., ISCA 2010) for the uop cache windows. Windows are inserted with a long re-reference
+ * prediction, the low priority windows of the prefetch throttle with a distant one. A hit predicts a near re-reference.
+ */
+
+namespace
+{
+constexpr unsigned maxRRPV = 3;
+
+struct uop_srrip_state {
+  champsim::way_metadata<unsigned> rrpv;
+  uint64_t distant_inserts = 0;
+
+  uop_srrip_state(std::size_t sets, std::size_t ways) : rrpv(sets, ways, maxRRPV) {}
+};
+} // namespace
+
+void MicroOpCache::uop_initialize_replacement() { emplace_replacement_state<uop_srrip_state>(sets, ways); }
+
+uint64_t MicroOpCache::uop_find_victim(uint64_t set, const uop_cache_entry_t* current_set, uint64_t ip, bool critical, bool pref)
+{
+  auto& rrpv = replacement_state<uop_srrip_state>().rrpv;
+  auto [begin, end] = rrpv.set_span(set);
+
+  auto victim = std::find(begin, end, ::maxRRPV);
+  while (victim == end) {
+    for (auto it = begin; it != end; ++it)
+      ++(*it);
+
+    victim = std::find(begin, end, ::maxRRPV);
+  }
+
+  return rrpv.way_of(set, victim);
+}
+
+void MicroOpCache::uop_update_on_hit(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle)
+{
+  replacement_state<uop_srrip_state>().rrpv(set, way) = 0;
+}
+
+void MicroOpCache::uop_update_on_insert(uint64_t set, uint64_t way, uint64_t ip, uint64_t current_cycle, bool pref, bool low_priority)
+{
+  auto& state = replacement_state<uop_srrip_state>();
+  if (low_priority) {
+    state.rrpv(set, way) = ::maxRRPV;
+    state.distant_inserts++;
+  } else {
+    state.rrpv(set, way) = ::maxRRPV - 1;
+  }
+}
+
+void MicroOpCache::uop_replacement_final_stats()
+{
+  std::cout << "UOP CACHE SRRIP DISTANT INSERTS: " << replacement_state<uop_srrip_state>().distant_inserts << std::endl;
+}